@@ -0,0 +1,229 @@
+#include "arreglo.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define CAPACIDAD_MINIMA 8
+#define FACTOR_CRECIMIENTO 2
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+struct arreglo{
+	char* datos;
+	size_t tam_elemento;
+	size_t largo;
+	size_t capacidad;
+};
+
+/*******************************************************************
+ *                        FUNCIONES AUXILIARES                     *
+ ******************************************************************/
+
+// Cambia la capacidad del arreglo. Devuelve false si no pudo, dejando
+// el arreglo intacto.
+// Pre: capacidad >= largo.
+static bool arreglo_redimensionar(arreglo_t* arreglo, size_t capacidad){
+	if (capacidad > SIZE_MAX / arreglo->tam_elemento) return false;
+
+	// realloc(p, 0) puede devolver NULL sin que sea un error.
+	size_t bytes = capacidad * arreglo->tam_elemento;
+	char* datos_nuevo = realloc(arreglo->datos, bytes ? bytes : 1);
+	if (!datos_nuevo) return false;
+
+	arreglo->datos = datos_nuevo;
+	arreglo->capacidad = capacidad;
+	return true;
+}
+
+// Hace lugar para n elementos mas. Es el unico lugar donde el arreglo
+// crece: siempre multiplica la capacidad, asi agregar es O(1) amortizado.
+static bool arreglo_hacer_lugar(arreglo_t* arreglo, size_t n){
+	if (n > SIZE_MAX - arreglo->largo) return false;
+	size_t necesario = arreglo->largo + n;
+	if (necesario <= arreglo->capacidad) return true;
+
+	size_t capacidad = arreglo->capacidad < CAPACIDAD_MINIMA ? CAPACIDAD_MINIMA : arreglo->capacidad;
+	while (capacidad < necesario){
+		if (capacidad > SIZE_MAX / FACTOR_CRECIMIENTO){
+			capacidad = necesario;
+			break;
+		}
+		capacidad *= FACTOR_CRECIMIENTO;
+	}
+	return arreglo_redimensionar(arreglo, capacidad);
+}
+
+/*******************************************************************
+ *                        IMPLEMENTACION                           *
+ ******************************************************************/
+
+// Crea un arreglo vacio de elementos de tam_elemento bytes.
+// Pre: tam_elemento es mayor a 0.
+// Post: devuelve un arreglo vacio o NULL en caso de error.
+arreglo_t* arreglo_crear(size_t tam_elemento){
+	return arreglo_crear_con_capacidad(tam_elemento, CAPACIDAD_MINIMA);
+}
+
+// Crea un arreglo vacio con lugar para capacidad elementos sin redimensionar.
+// Pre: tam_elemento es mayor a 0.
+// Post: devuelve un arreglo vacio o NULL en caso de error.
+arreglo_t* arreglo_crear_con_capacidad(size_t tam_elemento, size_t capacidad){
+	arreglo_t* arreglo = malloc(sizeof(arreglo_t));
+	if (!arreglo) return NULL;
+
+	arreglo->datos = NULL;
+	arreglo->tam_elemento = tam_elemento;
+	arreglo->largo = 0;
+	arreglo->capacidad = 0;
+	if (!arreglo_redimensionar(arreglo, capacidad)){
+		free(arreglo);
+		return NULL;
+	}
+	return arreglo;
+}
+
+// Destruye el arreglo. Si se recibe la funcion destruir_elemento, se la llama
+// con un puntero a cada uno de los elementos guardados.
+// Pre: el arreglo fue creado.
+// Post: se eliminaron todos los elementos del arreglo.
+void arreglo_destruir(arreglo_t* arreglo, void destruir_elemento(void*)){
+	if (destruir_elemento)
+		for (size_t i = 0; i < arreglo->largo; i++)
+			destruir_elemento(arreglo->datos + i * arreglo->tam_elemento);
+
+	free(arreglo->datos);
+	free(arreglo);
+}
+
+// Devuelve la cantidad de elementos guardados.
+// Pre: el arreglo fue creado.
+size_t arreglo_largo(const arreglo_t* arreglo){
+	return arreglo->largo;
+}
+
+// Devuelve verdadero si el arreglo no tiene elementos.
+// Pre: el arreglo fue creado.
+bool arreglo_esta_vacio(const arreglo_t* arreglo){
+	return arreglo->largo == 0;
+}
+
+// Devuelve cuantos elementos entran sin tener que redimensionar.
+// Pre: el arreglo fue creado.
+size_t arreglo_capacidad(const arreglo_t* arreglo){
+	return arreglo->capacidad;
+}
+
+// Se asegura de que entren al menos capacidad elementos sin redimensionar.
+// Nunca achica el arreglo.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si no se pudo reservar la memoria (el arreglo
+// queda intacto).
+bool arreglo_reservar(arreglo_t* arreglo, size_t capacidad){
+	if (capacidad <= arreglo->capacidad) return true;
+	return arreglo_redimensionar(arreglo, capacidad);
+}
+
+// Libera la memoria sobrante, dejando la capacidad igual al largo.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si no se pudo achicar (el arreglo queda intacto).
+bool arreglo_ajustar(arreglo_t* arreglo){
+	if (arreglo->capacidad == arreglo->largo) return true;
+	return arreglo_redimensionar(arreglo, arreglo->largo);
+}
+
+// Agrega una copia del elemento al final del arreglo. O(1) amortizado.
+// Pre: el arreglo fue creado. elemento apunta a tam_elemento bytes.
+// Post: devuelve false en caso de error.
+bool arreglo_agregar(arreglo_t* arreglo, const void* elemento){
+	if (arreglo->largo == arreglo->capacidad && !arreglo_hacer_lugar(arreglo, 1))
+		return false;
+
+	memcpy(arreglo->datos + arreglo->largo * arreglo->tam_elemento, elemento, arreglo->tam_elemento);
+	arreglo->largo++;
+	return true;
+}
+
+// Saca el ultimo elemento del arreglo y, si elemento no es NULL, lo copia ahi.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si el arreglo estaba vacio.
+bool arreglo_sacar(arreglo_t* arreglo, void* elemento){
+	if (arreglo->largo == 0) return false;
+
+	arreglo->largo--;
+	if (elemento)
+		memcpy(elemento, arreglo->datos + arreglo->largo * arreglo->tam_elemento, arreglo->tam_elemento);
+	return true;
+}
+
+// Agrega al final una copia de los n elementos consecutivos de elementos.
+// Pre: el arreglo fue creado.
+// Post: devuelve false en caso de error (el arreglo queda intacto).
+bool arreglo_agregar_n(arreglo_t* arreglo, const void* elementos, size_t n){
+	return arreglo_insertar_n(arreglo, arreglo->largo, elementos, n);
+}
+
+// Inserta una copia de los n elementos en la posicion pos, corriendo
+// los que estaban desde pos en adelante.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si pos > largo o en caso de error.
+bool arreglo_insertar_n(arreglo_t* arreglo, size_t pos, const void* elementos, size_t n){
+	if (pos > arreglo->largo) return false;
+	if (!arreglo_hacer_lugar(arreglo, n)) return false;
+
+	size_t tam = arreglo->tam_elemento;
+	char* destino = arreglo->datos + pos * tam;
+	memmove(destino + n * tam, destino, (arreglo->largo - pos) * tam);
+	memcpy(destino, elementos, n * tam);
+	arreglo->largo += n;
+	return true;
+}
+
+// Borra los n elementos a partir de la posicion pos, corriendo los siguientes.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si el rango no esta dentro del arreglo.
+bool arreglo_borrar_n(arreglo_t* arreglo, size_t pos, size_t n){
+	if (pos > arreglo->largo || n > arreglo->largo - pos) return false;
+
+	size_t tam = arreglo->tam_elemento;
+	char* destino = arreglo->datos + pos * tam;
+	memmove(destino, destino + n * tam, (arreglo->largo - pos - n) * tam);
+	arreglo->largo -= n;
+	return true;
+}
+
+// Copia en elemento el dato guardado en la posicion pos.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si la posicion es invalida.
+bool arreglo_obtener(const arreglo_t* arreglo, size_t pos, void* elemento){
+	if (pos >= arreglo->largo) return false;
+
+	memcpy(elemento, arreglo->datos + pos * arreglo->tam_elemento, arreglo->tam_elemento);
+	return true;
+}
+
+// Guarda una copia de elemento en la posicion pos.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si la posicion es invalida.
+bool arreglo_guardar(arreglo_t* arreglo, size_t pos, const void* elemento){
+	if (pos >= arreglo->largo) return false;
+
+	memcpy(arreglo->datos + pos * arreglo->tam_elemento, elemento, arreglo->tam_elemento);
+	return true;
+}
+
+// Devuelve un puntero al elemento de la posicion pos, sin chequear el rango.
+// Pre: el arreglo fue creado. pos < arreglo_largo(arreglo).
+// Post: el puntero es valido hasta la proxima modificacion del arreglo.
+void* arreglo_ver(const arreglo_t* arreglo, size_t pos){
+	return arreglo->datos + pos * arreglo->tam_elemento;
+}
+
+// Devuelve un puntero al comienzo de los elementos (memoria contigua).
+// Pre: el arreglo fue creado.
+// Post: el puntero es valido hasta la proxima modificacion del arreglo.
+void* arreglo_datos(const arreglo_t* arreglo){
+	return arreglo->datos;
+}
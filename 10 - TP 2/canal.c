@@ -0,0 +1,178 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include "canal.h"
+#include "cola_spsc.h"
+
+// Intentos cediendo el procesador antes de dormir.
+#define INTENTOS_ANTES_DE_ESPERAR 64
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+// esperando y cerrado se leen sin el mutex, con operaciones atomicas.
+struct canal
+{
+	cola_spsc_t* cola;
+	pthread_mutex_t mutex;
+	pthread_cond_t cambio;
+	size_t esperando;
+	bool cerrado;
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Despierta al otro hilo si esta durmiendo.
+static void avisar(canal_t* canal)
+{
+	// Lo que se encolo (o desencolo) tiene que verse antes de leer
+	// esperando; el que duerme incrementa esperando antes de volver a mirar
+	// la cola. Asi alguno de los dos ve al otro.
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&canal->esperando, __ATOMIC_RELAXED) == 0) return;
+
+	pthread_mutex_lock(&canal->mutex);
+	pthread_cond_broadcast(&canal->cambio);
+	pthread_mutex_unlock(&canal->mutex);
+}
+
+static bool esta_cerrado(canal_t* canal)
+{
+	return __atomic_load_n(&canal->cerrado, __ATOMIC_SEQ_CST);
+}
+
+// Intenta encolar el dato. Si el canal esta cerrado no lo encola.
+// Post: Devuelve true si termino (lo encolo o el canal esta cerrado).
+static bool intentar_enviar(canal_t* canal, void* dato, bool* enviado)
+{
+	*enviado = false;
+	if (esta_cerrado(canal)) return true;
+	*enviado = cola_spsc_encolar(canal->cola, dato);
+	return *enviado;
+}
+
+// Intenta desencolar. Si la cola esta vacia y el canal cerrado, termina
+// sin dato.
+// Post: Devuelve true si termino.
+static bool intentar_recibir(canal_t* canal, void** dato)
+{
+	*dato = cola_spsc_desencolar(canal->cola);
+	if (*dato) return true;
+	// Si se cerro despues de encolar lo ultimo, todavia puede haber algo.
+	if (!esta_cerrado(canal)) return false;
+	*dato = cola_spsc_desencolar(canal->cola);
+	return true;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Crea un canal con lugar para al menos capacidad datos.
+// Pre: capacidad es mayor a 0.
+// Post: Devuelve el canal o NULL en caso de error.
+canal_t* canal_crear(size_t capacidad)
+{
+	canal_t* canal = malloc(sizeof(canal_t));
+	cola_spsc_t* cola = cola_spsc_crear(capacidad);
+	if (!canal || !cola)
+	{
+		free(canal);
+		if (cola) cola_spsc_destruir(cola, NULL);
+		return NULL;
+	}
+	canal->cola = cola;
+	pthread_mutex_init(&canal->mutex, NULL);
+	pthread_cond_init(&canal->cambio, NULL);
+	canal->esperando = 0;
+	canal->cerrado = false;
+	return canal;
+}
+
+// Destruye el canal. Si se recibe destruir_dato, la llama con cada dato
+// que no se llego a recibir.
+// Pre: el canal fue creado y ningun hilo lo esta usando.
+void canal_destruir(canal_t* canal, void destruir_dato(void*))
+{
+	cola_spsc_destruir(canal->cola, destruir_dato);
+	pthread_mutex_destroy(&canal->mutex);
+	pthread_cond_destroy(&canal->cambio);
+	free(canal);
+}
+
+// Envia el dato, esperando si el canal esta lleno.
+// Pre: el canal fue creado, dato no es NULL. Solo lo llama el hilo que
+// envia.
+// Post: Devuelve false (y el dato no se envia) si el canal esta cerrado.
+bool canal_enviar(canal_t* canal, void* dato)
+{
+	bool enviado;
+	for (int i = 0; i < INTENTOS_ANTES_DE_ESPERAR; i++)
+	{
+		if (intentar_enviar(canal, dato, &enviado)) break;
+		sched_yield();
+	}
+	if (!enviado && !esta_cerrado(canal))
+	{
+		pthread_mutex_lock(&canal->mutex);
+		__atomic_add_fetch(&canal->esperando, 1, __ATOMIC_SEQ_CST);
+		while (!intentar_enviar(canal, dato, &enviado))
+			pthread_cond_wait(&canal->cambio, &canal->mutex);
+		__atomic_sub_fetch(&canal->esperando, 1, __ATOMIC_RELAXED);
+		pthread_mutex_unlock(&canal->mutex);
+	}
+	if (enviado) avisar(canal);
+	return enviado;
+}
+
+// Recibe el proximo dato, esperando si el canal esta vacio.
+// Pre: el canal fue creado. Solo lo llama el hilo que recibe.
+// Post: Devuelve el dato, o NULL si el canal se cerro y no quedan datos.
+void* canal_recibir(canal_t* canal)
+{
+	void* dato;
+	bool listo = false;
+	for (int i = 0; i < INTENTOS_ANTES_DE_ESPERAR && !listo; i++)
+	{
+		listo = intentar_recibir(canal, &dato);
+		if (!listo) sched_yield();
+	}
+	if (!listo)
+	{
+		pthread_mutex_lock(&canal->mutex);
+		__atomic_add_fetch(&canal->esperando, 1, __ATOMIC_SEQ_CST);
+		while (!intentar_recibir(canal, &dato))
+			pthread_cond_wait(&canal->cambio, &canal->mutex);
+		__atomic_sub_fetch(&canal->esperando, 1, __ATOMIC_RELAXED);
+		pthread_mutex_unlock(&canal->mutex);
+	}
+	if (dato) avisar(canal);
+	return dato;
+}
+
+// Como canal_recibir, pero sin esperar: devuelve NULL si no hay datos.
+// Pre: el canal fue creado. Solo lo llama el hilo que recibe.
+void* canal_intentar_recibir(canal_t* canal)
+{
+	void* dato = cola_spsc_desencolar(canal->cola);
+	if (dato) avisar(canal);
+	return dato;
+}
+
+// Cierra el canal: los que esperan dejan de esperar y no se puede enviar
+// mas. Lo que ya se envio se puede seguir recibiendo.
+// Pre: el canal fue creado.
+void canal_cerrar(canal_t* canal)
+{
+	__atomic_store_n(&canal->cerrado, true, __ATOMIC_SEQ_CST);
+	pthread_mutex_lock(&canal->mutex);
+	pthread_cond_broadcast(&canal->cambio);
+	pthread_mutex_unlock(&canal->mutex);
+}
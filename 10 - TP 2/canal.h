@@ -0,0 +1,55 @@
+#ifndef CANAL_H
+#define CANAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* Un canal pasa punteros de un hilo a otro, en orden. Es una cola_spsc (un
+ * solo hilo envia y un solo hilo recibe) que sabe esperar: si esta llena,
+ * enviar espera a que el otro hilo reciba, y si esta vacia, recibir espera
+ * a que le envien algo. Antes de dormir se reintenta un poco cediendo el
+ * procesador, que es mucho mas barato si el otro hilo esta por llegar.
+ * Cualquiera de los dos hilos puede cerrarlo, para que el otro deje de
+ * esperar. No se pueden enviar datos NULL. */
+
+typedef struct canal canal_t;
+
+/* ******************************************************************
+ *                    PRIMITIVAS DEL CANAL
+ * *****************************************************************/
+
+// Crea un canal con lugar para al menos capacidad datos.
+// Pre: capacidad es mayor a 0.
+// Post: Devuelve el canal o NULL en caso de error.
+canal_t* canal_crear(size_t capacidad);
+
+// Destruye el canal. Si se recibe destruir_dato, la llama con cada dato
+// que no se llego a recibir.
+// Pre: el canal fue creado y ningun hilo lo esta usando.
+void canal_destruir(canal_t* canal, void destruir_dato(void*));
+
+// Envia el dato, esperando si el canal esta lleno.
+// Pre: el canal fue creado, dato no es NULL. Solo lo llama el hilo que
+// envia.
+// Post: Devuelve false (y el dato no se envia) si el canal esta cerrado.
+bool canal_enviar(canal_t* canal, void* dato);
+
+// Recibe el proximo dato, esperando si el canal esta vacio.
+// Pre: el canal fue creado. Solo lo llama el hilo que recibe.
+// Post: Devuelve el dato, o NULL si el canal se cerro y no quedan datos.
+void* canal_recibir(canal_t* canal);
+
+// Como canal_recibir, pero sin esperar: devuelve NULL si no hay datos.
+// Pre: el canal fue creado. Solo lo llama el hilo que recibe.
+void* canal_intentar_recibir(canal_t* canal);
+
+// Cierra el canal: los que esperan dejan de esperar y no se puede enviar
+// mas. Lo que ya se envio se puede seguir recibiendo.
+// Pre: el canal fue creado.
+void canal_cerrar(canal_t* canal);
+
+#endif //CANAL_H
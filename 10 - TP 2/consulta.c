@@ -0,0 +1,196 @@
+#include <stdlib.h>
+#include <string.h>
+#include "consulta.h"
+#include "heap.h"
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+// Con OPERADOR_O, el heap tiene los cursores que no llegaron al final.
+struct consulta
+{
+	operador_t operador;
+	posteos_cursor_t** cursores;
+	size_t cantidad;
+	heap_t* heap;
+	bool fallo;
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Funcion de comparacion para el heap: primero el cursor con mayor id.
+static int comparar_cursores(const void* a, const void* b)
+{
+	size_t id_a = posteos_cursor_ver_actual(a);
+	size_t id_b = posteos_cursor_ver_actual(b);
+	return (id_a > id_b) - (id_a < id_b);
+}
+
+// consulta_siguiente con OPERADOR_Y.
+static bool siguiente_interseccion(consulta_t* consulta, size_t* id)
+{
+	posteos_cursor_t** cursores = consulta->cursores;
+	if (posteos_cursor_al_final(cursores[0])) return false;
+
+	// Se recorren los cursores en ronda llevando a cada uno hasta el
+	// candidato; si alguno no lo tiene, el candidato pasa a ser su id.
+	size_t candidato = posteos_cursor_ver_actual(cursores[0]);
+	size_t coinciden = 1;
+	for (size_t i = 1 % consulta->cantidad; coinciden < consulta->cantidad; i = (i + 1) % consulta->cantidad)
+	{
+		if (!posteos_cursor_buscar(cursores[i], candidato)) return false;
+		size_t actual = posteos_cursor_ver_actual(cursores[i]);
+		if (actual == candidato)
+			coinciden++;
+		else
+		{
+			candidato = actual;
+			coinciden = 1;
+		}
+	}
+
+	// Todos estan en el candidato: alcanza con mover uno para que el
+	// proximo candidato sea menor.
+	*id = candidato;
+	posteos_cursor_avanzar(cursores[0]);
+	return true;
+}
+
+// consulta_siguiente con OPERADOR_O.
+static bool siguiente_union(consulta_t* consulta, size_t* id)
+{
+	if (heap_esta_vacio(consulta->heap)) return false;
+	*id = posteos_cursor_ver_actual(heap_ver_max(consulta->heap));
+
+	// Se avanzan todos los cursores que estan en el id. Si no se puede
+	// volver a encolar uno, sus ids se perderian: la consulta falla.
+	while (!heap_esta_vacio(consulta->heap) &&
+	       posteos_cursor_ver_actual(heap_ver_max(consulta->heap)) == *id)
+	{
+		posteos_cursor_t* cursor = heap_desencolar(consulta->heap);
+		posteos_cursor_avanzar(cursor);
+		if (!posteos_cursor_al_final(cursor) && !heap_encolar(consulta->heap, cursor))
+		{
+			consulta->fallo = true;
+			return false;
+		}
+	}
+	return true;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Devuelve true si la cadena es un usuario o un hashtag.
+bool consulta_es_termino(const char* cadena)
+{
+	return *cadena == '@' || *cadena == '#';
+}
+
+// Cuenta los terminos de una busqueda: varios usuarios o hashtags unidos
+// todos por '&' (estan en todos) o todos por '|' (estan en alguno), como
+// #a&#b o @x|#y. Si la busqueda no se puede separar asi (por ejemplo, un
+// hashtag que tiene un '&' en el medio), es un solo termino.
+// Post: guarda en operador como se unen.
+size_t consulta_contar_terminos(const char* busqueda, operador_t* operador)
+{
+	bool hay_y = strchr(busqueda, '&') != NULL;
+	bool hay_o = strchr(busqueda, '|') != NULL;
+	*operador = hay_o ? OPERADOR_O : OPERADOR_Y;
+	if (hay_y == hay_o) return 1;
+
+	char separador = hay_y ? '&' : '|';
+	size_t cantidad = 1;
+	for (const char* c = busqueda; *c; c++)
+		if (*c == separador)
+		{
+			if (!consulta_es_termino(c + 1)) return 1;
+			cantidad++;
+		}
+	return cantidad;
+}
+
+// Separa la busqueda en sus cantidad terminos, cortandola en cada
+// separador.
+// Pre: cantidad y operador son los que devolvio consulta_contar_terminos.
+void consulta_separar_terminos(char* busqueda, char** terminos, size_t cantidad, operador_t operador)
+{
+	char separador = operador == OPERADOR_Y ? '&' : '|';
+	terminos[0] = busqueda;
+	for (size_t i = 1; i < cantidad; i++)
+	{
+		busqueda = strchr(busqueda, separador);
+		*busqueda++ = '\0';
+		terminos[i] = busqueda;
+	}
+}
+
+// Crea una consulta sobre las cantidad listas recibidas.
+// Pre: cantidad es mayor a 0. Las listas no cambian mientras se use la
+// consulta.
+// Post: Devuelve la consulta o NULL en caso de error.
+consulta_t* consulta_crear(const posteos_t** listas, size_t cantidad, operador_t operador)
+{
+	consulta_t* consulta = malloc(sizeof(consulta_t));
+	posteos_cursor_t** cursores = calloc(cantidad, sizeof(posteos_cursor_t*));
+	heap_t* heap = operador == OPERADOR_O ? heap_crear(comparar_cursores) : NULL;
+	if (!consulta || !cursores || (operador == OPERADOR_O && !heap))
+	{
+		free(consulta);
+		free(cursores);
+		if (heap) heap_destruir(heap, NULL);
+		return NULL;
+	}
+	consulta->operador = operador;
+	consulta->cursores = cursores;
+	consulta->cantidad = cantidad;
+	consulta->heap = heap;
+	consulta->fallo = false;
+
+	for (size_t i = 0; i < cantidad; i++)
+	{
+		cursores[i] = posteos_cursor_crear(listas[i]);
+		if (!cursores[i] || (heap && !posteos_cursor_al_final(cursores[i]) && !heap_encolar(heap, cursores[i])))
+		{
+			consulta_destruir(consulta);
+			return NULL;
+		}
+	}
+	return consulta;
+}
+
+// Destruye la consulta.
+// Pre: la consulta fue creada.
+void consulta_destruir(consulta_t* consulta)
+{
+	for (size_t i = 0; i < consulta->cantidad; i++)
+		if (consulta->cursores[i]) posteos_cursor_destruir(consulta->cursores[i]);
+	if (consulta->heap) heap_destruir(consulta->heap, NULL);
+	free(consulta->cursores);
+	free(consulta);
+}
+
+// Guarda en id el proximo resultado (el mayor que todavia no entrego).
+// Pre: la consulta fue creada.
+// Post: Devuelve false si no hay mas resultados o en caso de error (ver
+// consulta_fallo).
+bool consulta_siguiente(consulta_t* consulta, size_t* id)
+{
+	if (consulta->fallo) return false;
+	if (consulta->operador == OPERADOR_Y) return siguiente_interseccion(consulta, id);
+	return siguiente_union(consulta, id);
+}
+
+// Devuelve true si la consulta dejo de dar resultados por un error, y no
+// porque no hubiera mas.
+// Pre: la consulta fue creada.
+bool consulta_fallo(const consulta_t* consulta)
+{
+	return consulta->fallo;
+}
@@ -0,0 +1,72 @@
+#ifndef CONSULTA_H
+#define CONSULTA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "posteos.h"
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* Una consulta combina varias listas de posteos y entrega, de a uno y del
+ * mayor al menor, los ids que estan en todas (OPERADOR_Y) o en alguna
+ * (OPERADOR_O). Solo avanza sobre las listas lo necesario para el proximo
+ * id, asi que se puede cortar en cualquier momento sin recorrerlas enteras.
+ * - Y: cada lista salta hasta el candidato actual con posteos_cursor_buscar
+ *   (que usa las cabeceras de los bloques), y el candidato baja hasta que
+ *   todas coinciden.
+ * - O: un heap de cursores ordenado por su id actual. */
+
+typedef enum operador
+{
+	OPERADOR_Y, OPERADOR_O
+} operador_t;
+
+typedef struct consulta consulta_t;
+
+/* ******************************************************************
+ *                  PRIMITIVAS DE LOS TERMINOS
+ * *****************************************************************/
+
+// Devuelve true si la cadena es un usuario o un hashtag.
+bool consulta_es_termino(const char* cadena);
+
+// Cuenta los terminos de una busqueda: varios usuarios o hashtags unidos
+// todos por '&' (estan en todos) o todos por '|' (estan en alguno), como
+// #a&#b o @x|#y. Si la busqueda no se puede separar asi (por ejemplo, un
+// hashtag que tiene un '&' en el medio), es un solo termino.
+// Post: guarda en operador como se unen.
+size_t consulta_contar_terminos(const char* busqueda, operador_t* operador);
+
+// Separa la busqueda en sus cantidad terminos, cortandola en cada
+// separador.
+// Pre: cantidad y operador son los que devolvio consulta_contar_terminos.
+void consulta_separar_terminos(char* busqueda, char** terminos, size_t cantidad, operador_t operador);
+
+/* ******************************************************************
+ *                  PRIMITIVAS DE LA CONSULTA
+ * *****************************************************************/
+
+// Crea una consulta sobre las cantidad listas recibidas.
+// Pre: cantidad es mayor a 0. Las listas no cambian mientras se use la
+// consulta.
+// Post: Devuelve la consulta o NULL en caso de error.
+consulta_t* consulta_crear(const posteos_t** listas, size_t cantidad, operador_t operador);
+
+// Destruye la consulta.
+// Pre: la consulta fue creada.
+void consulta_destruir(consulta_t* consulta);
+
+// Guarda en id el proximo resultado (el mayor que todavia no entrego).
+// Pre: la consulta fue creada.
+// Post: Devuelve false si no hay mas resultados o en caso de error (ver
+// consulta_fallo).
+bool consulta_siguiente(consulta_t* consulta, size_t* id);
+
+// Devuelve true si la consulta dejo de dar resultados por un error, y no
+// porque no hubiera mas.
+// Pre: la consulta fue creada.
+bool consulta_fallo(const consulta_t* consulta);
+
+#endif //CONSULTA_H
@@ -2,11 +2,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <unistd.h>
 #include "entrada.h"
+#include "lector.h"
 
-#define TAMANIO_INICIAL_BUFFER 20
-#define FIN_LINEA '\n'
-#define FIN_STRING '\0'
 #define TAM_INICIAL_PARAMETROS 10
 #define ARG_DELIM "\a\b\r\n \r\v\t\f"
 
@@ -17,8 +16,8 @@
 struct entrada
 {
 	size_t pos_comando;
-	char* buffer;
-	size_t tam_buffer;
+	lector_t* lector;
+	char* buffer;      // la linea actual, dentro del buffer del lector
 	size_t buffer_len; // buffer[buffer_len] == \0 == final
 	char* comando;
 	char** parametros;
@@ -33,31 +32,36 @@ struct entrada
 /*******************************************************************
  *                       Funciones auxiliares                      */
 
-// Funcion auxiliar para ingreso de texto por teclado.
-// Guarda la linea que se leyo hasta el enter en el buffer de la entrada.
+// Toma la proxima linea del lector como buffer de la entrada.
 // Pre: la entrada fue creada.
 // Post: Devuelve falso en caso de llegar al EOF. True si leyo correctamente.
 static bool leer_linea(entrada_t* entrada)
 {
-	int c;
-	size_t i;
+	entrada->buffer = lector_linea(entrada->lector, &entrada->buffer_len);
+	return entrada->buffer != NULL;
+}
 
-	for(i = 0; (c = getchar()) != FIN_LINEA; i++)  //leo hasta el enter
+// Crea la entrada con el lector recibido.
+static entrada_t* entrada_crear_con_lector(lector_t* lector, size_t pos_comando)
+{
+	entrada_t* entrada = malloc(sizeof(entrada_t));
+	char** parametros = malloc(TAM_INICIAL_PARAMETROS*sizeof(char*));
+	if (!lector || !entrada || !parametros)
 	{
-		if (c == EOF) return false;
-
-		if (i + 1 == entrada->tam_buffer)  // si llego al tamanio de mi cadena
-		{
-			char* aux = realloc(entrada->buffer, (entrada->tam_buffer*2) * sizeof(char));
-			if (!aux) break;  // si falla realloc, termino aca
-			entrada->buffer = aux;
-			entrada->tam_buffer *= 2;
-		}
-		entrada->buffer[i] = (char)c;
+		if (lector) lector_destruir(lector);
+		free(entrada);
+		free(parametros);
+		return NULL;
 	}
-	entrada->buffer[i] = FIN_STRING; // es necesario cerrar el string
-	entrada->buffer_len = i; // guardo el largo
-	return true;
+	entrada->parametros = parametros;
+	entrada->tam_parametros = TAM_INICIAL_PARAMETROS;
+	entrada->cant_parametros = 0;
+	entrada->comando = NULL;
+	entrada->pos_comando = pos_comando;
+	entrada->lector = lector;
+	entrada->buffer = NULL;
+	entrada->buffer_len = 0;
+	return entrada;
 }
 
 // Recibe una cadena y los caracteres iniciales a ignorar.
@@ -105,25 +109,16 @@ static void eliminar_caracteres_finales(char* cadena, size_t largo, char* caract
 // Post: Devuelve la entrada o NULL en caso de error.
 entrada_t* entrada_crear(size_t pos_comando)
 {
-	entrada_t* entrada = malloc(sizeof(entrada_t));
-	char* buffer = malloc(TAMANIO_INICIAL_BUFFER*sizeof(char));
-	char** parametros = malloc(TAM_INICIAL_PARAMETROS*sizeof(char*));
-	if (!entrada || !buffer || !parametros)
-	{
-		free(entrada);
-		free(buffer);
-		free(parametros);
-		return NULL;
-	}
-	entrada->parametros = parametros;
-	entrada->tam_parametros = TAM_INICIAL_PARAMETROS;
-	entrada->cant_parametros = 0;
-	entrada->comando = NULL;
-	entrada->pos_comando = pos_comando;
-	entrada->buffer = buffer;
-	entrada->tam_buffer = TAMANIO_INICIAL_BUFFER;
-	entrada->buffer_len = 0;
-	return entrada;
+	return entrada_crear_con_lector(lector_crear(STDIN_FILENO), pos_comando);
+}
+
+// Crea una entrada que lee las lineas del archivo ruta en lugar de la
+// entrada estandar.
+// Pre: Posicion del comando es un numero positivo.
+// Post: Devuelve la entrada o NULL en caso de error.
+entrada_t* entrada_abrir(const char* ruta, size_t pos_comando)
+{
+	return entrada_crear_con_lector(lector_abrir(ruta), pos_comando);
 }
 
 // Destruye la entrada
@@ -131,7 +126,7 @@ entrada_t* entrada_crear(size_t pos_comando)
 void entrada_destruir(entrada_t* entrada)
 {
 	free(entrada->parametros);
-	free(entrada->buffer);
+	lector_destruir(entrada->lector);
 	free(entrada);
 }
 
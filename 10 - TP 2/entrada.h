@@ -26,11 +26,17 @@ typedef int (*max_cant_param_t)(char* comando, bool* eliminar_chars_finales, voi
 // Post: Devuelve la entrada o NULL en caso de error.
 entrada_t* entrada_crear(size_t pos_comando);
 
+// Crea una entrada que lee las lineas del archivo ruta en lugar de la
+// entrada estandar.
+// Pre: Posicion del comando es un numero positivo.
+// Post: Devuelve la entrada o NULL en caso de error.
+entrada_t* entrada_abrir(const char* ruta, size_t pos_comando);
+
 // Destruye la entrada
 // Pre: la entrada fue creada.
 void entrada_destruir(entrada_t* entrada);
 
-// Lee la linea de la entrada estandar y la divide en los argumentos correspondientes.
+// Lee la proxima linea de la entrada y la divide en los argumentos correspondientes.
 // Recibe, opcionalmente, una funcion del tipo max_cant_param_t (explicada arriba)
 // que se llamara apenas se lea el comando, para definir el procedimiento
 // a llevar a cabo con los proximos parametros.
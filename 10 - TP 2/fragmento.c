@@ -0,0 +1,177 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "fragmento.h"
+#include "hash.h"
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+// Lo que se guarda de cada usuario o hashtag: los ids de sus tweets,
+// desde que alguno tiene favoritos el ranking de los que tienen, y su nodo
+// en el trie (cuya frecuencia es la cantidad de tweets).
+struct palabra
+{
+	posteos_t* posteos;
+	ranking_t* ranking;
+	trie_nodo_t* nodo;
+};
+
+struct fragmento
+{
+	hash_t* palabras; // de palabra_t*
+	trie_t* trie; // las mismas palabras, para buscarlas por prefijo
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+ /*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Funcion de destruccion de las palabras del hash (puede haber claves con
+// dato NULL, ver obtener_palabra).
+static void palabra_destruir(void* dato)
+{
+	palabra_t* palabra = dato;
+	if (!palabra) return;
+	posteos_destruir(palabra->posteos);
+	if (palabra->ranking) ranking_destruir(palabra->ranking);
+	free(palabra);
+}
+
+// Crea una palabra sin tweets.
+// Devuelve NULL en caso de error.
+static palabra_t* palabra_crear(void)
+{
+	palabra_t* palabra = malloc(sizeof(palabra_t));
+	posteos_t* posteos = posteos_crear();
+	if (!palabra || !posteos)
+	{
+		free(palabra);
+		if (posteos) posteos_destruir(posteos);
+		return NULL;
+	}
+	palabra->posteos = posteos;
+	palabra->ranking = NULL;
+	palabra->nodo = NULL;
+	return palabra;
+}
+
+// Devuelve la palabra con la clave formada por los primeros largo
+// caracteres de clave, creandola (tambien en el trie) si no existia. Hace
+// una sola busqueda en el hash. Si falla al crearla, la clave queda en el
+// hash con dato NULL, como si no existiera.
+// Devuelve NULL en caso de error.
+static palabra_t* obtener_palabra(fragmento_t* fragmento, const char* clave, size_t largo)
+{
+	void** dato = hash_obtener_o_insertar(fragmento->palabras, clave, largo, NULL);
+	if (!dato) return NULL;
+	if (*dato) return *dato;
+
+	palabra_t* palabra = palabra_crear();
+	if (!palabra) return NULL;
+	palabra->nodo = trie_agregar(fragmento->trie, clave, largo);
+	if (!palabra->nodo)
+	{
+		palabra_destruir(palabra);
+		return NULL;
+	}
+	*dato = palabra;
+	return palabra;
+}
+
+// Agrega el tweet al ranking de la palabra la primera vez, y despues lo
+// sube.
+// Devuelve false en caso de error.
+static bool rankear(fragmento_t* fragmento, const cambio_t* cambio)
+{
+	ubicacion_t* ubicacion = cambio->ubicacion;
+	if (ubicacion->ranking) return ranking_incrementar(ubicacion->ranking, ubicacion->ref);
+
+	palabra_t* palabra = obtener_palabra(fragmento, cambio->clave, cambio->largo);
+	if (!palabra) return false;
+	if (!palabra->ranking) palabra->ranking = ranking_crear();
+	if (!palabra->ranking) return false;
+	ubicacion->ref = ranking_agregar(palabra->ranking, cambio->id);
+	if (!ubicacion->ref) return false;
+	ubicacion->ranking = palabra->ranking;
+	return true;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Crea un fragmento sin palabras.
+// Post: Devuelve el fragmento o NULL en caso de error.
+fragmento_t* fragmento_crear(void)
+{
+	fragmento_t* fragmento = malloc(sizeof(fragmento_t));
+	hash_t* palabras = hash_crear(palabra_destruir);
+	trie_t* trie = trie_crear();
+	if (!fragmento || !palabras || !trie)
+	{
+		free(fragmento);
+		if (palabras) hash_destruir(palabras);
+		if (trie) trie_destruir(trie);
+		return NULL;
+	}
+	fragmento->palabras = palabras;
+	fragmento->trie = trie;
+	return fragmento;
+}
+
+// Destruye el fragmento y sus palabras.
+// Pre: el fragmento fue creado.
+void fragmento_destruir(fragmento_t* fragmento)
+{
+	hash_destruir(fragmento->palabras);
+	trie_destruir(fragmento->trie);
+	free(fragmento);
+}
+
+// Aplica el cambio, creando la palabra si no existia.
+// Pre: el fragmento fue creado. Los tweets de una palabra llegan en orden
+// de id, y sus favoritos en el orden en que se dieron.
+// Post: Devuelve false en caso de error.
+bool fragmento_aplicar(fragmento_t* fragmento, const cambio_t* cambio)
+{
+	if (cambio->tipo == CAMBIO_FAVORITO) return rankear(fragmento, cambio);
+
+	palabra_t* palabra = obtener_palabra(fragmento, cambio->clave, cambio->largo);
+	return palabra && posteos_agregar(palabra->posteos, cambio->id) &&
+		trie_incrementar(palabra->nodo, cambio->marca);
+}
+
+// Devuelve la palabra con la clave, o NULL si no existe.
+// Pre: el fragmento fue creado.
+const palabra_t* fragmento_buscar(const fragmento_t* fragmento, const char* clave)
+{
+	return hash_obtener(fragmento->palabras, clave);
+}
+
+// Guarda en sugerencias las hasta cantidad palabras del fragmento que
+// empiezan con prefijo y estan en mas tweets (ver trie_completar).
+// Pre: el fragmento fue creado. cantidad no es mayor a TRIE_TOP.
+// Post: Devuelve cuantas guardo.
+size_t fragmento_completar(const fragmento_t* fragmento, const char* prefijo, size_t cantidad, trie_sugerencia_t* sugerencias)
+{
+	return trie_completar(fragmento->trie, prefijo, cantidad, sugerencias);
+}
+
+// Devuelve los ids de los tweets de la palabra.
+// Pre: la palabra fue devuelta por fragmento_buscar.
+const posteos_t* palabra_posteos(const palabra_t* palabra)
+{
+	return palabra->posteos;
+}
+
+// Devuelve el ranking de los tweets con favoritos de la palabra, o NULL si
+// ninguno tiene.
+// Pre: la palabra fue devuelta por fragmento_buscar.
+const ranking_t* palabra_ranking(const palabra_t* palabra)
+{
+	return palabra->ranking;
+}
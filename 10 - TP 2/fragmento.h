@@ -0,0 +1,89 @@
+#ifndef FRAGMENTO_H
+#define FRAGMENTO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "posteos.h"
+#include "ranking.h"
+#include "trie.h"
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* Un fragmento tiene una parte de las palabras (usuarios y hashtags) del
+ * twitter: para cada una, los ids de sus tweets, el ranking de los que
+ * tienen favoritos y su frecuencia en un trie propio. El twitter decide en
+ * que fragmento va cada palabra; como los fragmentos no comparten nada,
+ * cada uno se puede modificar en un hilo distinto. */
+
+typedef struct fragmento fragmento_t;
+typedef struct palabra palabra_t;
+
+// Donde esta un tweet con favoritos en el ranking de una de sus palabras.
+// ranking es NULL hasta que el tweet entra al ranking, y despues ref es
+// su referencia en el.
+typedef struct ubicacion
+{
+	ranking_t* ranking;
+	ranking_ref_t* ref;
+} ubicacion_t;
+
+typedef enum tipo_cambio
+{
+	CAMBIO_TWEET, CAMBIO_FAVORITO
+} tipo_cambio_t;
+
+// Un cambio en una palabra del fragmento: el tweet id la menciona (y marca
+// es la del incremento de su frecuencia en el trie), o el tweet id recibio
+// un favorito (y ubicacion es donde esta en el ranking de la palabra).
+// clave puede no terminar en '\0'; con un favorito solo hace falta la
+// primera vez, cuando ubicacion->ranking es NULL.
+typedef struct cambio
+{
+	tipo_cambio_t tipo;
+	const char* clave;
+	size_t largo;
+	size_t id;
+	size_t marca;
+	ubicacion_t* ubicacion;
+} cambio_t;
+
+/* ******************************************************************
+ *                   PRIMITIVAS DEL FRAGMENTO
+ * *****************************************************************/
+
+// Crea un fragmento sin palabras.
+// Post: Devuelve el fragmento o NULL en caso de error.
+fragmento_t* fragmento_crear(void);
+
+// Destruye el fragmento y sus palabras.
+// Pre: el fragmento fue creado.
+void fragmento_destruir(fragmento_t* fragmento);
+
+// Aplica el cambio, creando la palabra si no existia.
+// Pre: el fragmento fue creado. Los tweets de una palabra llegan en orden
+// de id, y sus favoritos en el orden en que se dieron.
+// Post: Devuelve false en caso de error.
+bool fragmento_aplicar(fragmento_t* fragmento, const cambio_t* cambio);
+
+// Devuelve la palabra con la clave, o NULL si no existe.
+// Pre: el fragmento fue creado.
+const palabra_t* fragmento_buscar(const fragmento_t* fragmento, const char* clave);
+
+// Guarda en sugerencias las hasta cantidad palabras del fragmento que
+// empiezan con prefijo y estan en mas tweets (ver trie_completar).
+// Pre: el fragmento fue creado. cantidad no es mayor a TRIE_TOP.
+// Post: Devuelve cuantas guardo.
+size_t fragmento_completar(const fragmento_t* fragmento, const char* prefijo, size_t cantidad, trie_sugerencia_t* sugerencias);
+
+// Devuelve los ids de los tweets de la palabra.
+// Pre: la palabra fue devuelta por fragmento_buscar.
+const posteos_t* palabra_posteos(const palabra_t* palabra);
+
+// Devuelve el ranking de los tweets con favoritos de la palabra, o NULL si
+// ninguno tiene.
+// Pre: la palabra fue devuelta por fragmento_buscar.
+const ranking_t* palabra_ranking(const palabra_t* palabra);
+
+#endif //FRAGMENTO_H
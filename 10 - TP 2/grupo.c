@@ -0,0 +1,158 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "grupo.h"
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+// Cada grupo_ejecutar es una vuelta: los hilos esperan a que cambie vuelta,
+// toman indices de siguiente (con operaciones atomicas) hasta pasarse de
+// cantidad, y el ultimo en terminar despierta al que llamo.
+struct grupo
+{
+	pthread_t* hilos;
+	size_t cant_hilos;
+	pthread_mutex_t mutex;
+	pthread_cond_t hay_trabajo;
+	pthread_cond_t terminado;
+	size_t vuelta;
+	bool fin;
+	bool ocupado; // lo esta usando algun grupo_ejecutar (es atomico)
+
+	grupo_tarea_t tarea;
+	void* extra;
+	size_t cantidad;
+	size_t siguiente;
+	size_t trabajando; // hilos del grupo que no terminaron la vuelta
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Hace tareas de la vuelta actual hasta que no quedan indices.
+static void repartir(grupo_t* grupo)
+{
+	size_t i;
+	while ((i = __atomic_fetch_add(&grupo->siguiente, 1, __ATOMIC_RELAXED)) < grupo->cantidad)
+		grupo->tarea(i, grupo->extra);
+}
+
+// Funcion de los hilos del grupo.
+static void* trabajar(void* dato)
+{
+	grupo_t* grupo = dato;
+	size_t vista = 0;
+	pthread_mutex_lock(&grupo->mutex);
+	while (true)
+	{
+		while (grupo->vuelta == vista && !grupo->fin)
+			pthread_cond_wait(&grupo->hay_trabajo, &grupo->mutex);
+		if (grupo->fin) break;
+		vista = grupo->vuelta;
+
+		pthread_mutex_unlock(&grupo->mutex);
+		repartir(grupo);
+		pthread_mutex_lock(&grupo->mutex);
+		if (--grupo->trabajando == 0) pthread_cond_signal(&grupo->terminado);
+	}
+	pthread_mutex_unlock(&grupo->mutex);
+	return NULL;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Crea un grupo con hilos hilos, ademas del que llama a grupo_ejecutar
+// (con 0 las tareas se hacen en ese hilo, una atras de otra).
+// Post: Devuelve el grupo o NULL en caso de error.
+grupo_t* grupo_crear(size_t hilos)
+{
+	grupo_t* grupo = malloc(sizeof(grupo_t));
+	pthread_t* vector = malloc((hilos ? hilos : 1) * sizeof(pthread_t));
+	if (!grupo || !vector)
+	{
+		free(grupo);
+		free(vector);
+		return NULL;
+	}
+	grupo->hilos = vector;
+	grupo->cant_hilos = 0;
+	pthread_mutex_init(&grupo->mutex, NULL);
+	pthread_cond_init(&grupo->hay_trabajo, NULL);
+	pthread_cond_init(&grupo->terminado, NULL);
+	grupo->vuelta = 0;
+	grupo->fin = false;
+	grupo->ocupado = false;
+	grupo->cantidad = 0;
+	grupo->siguiente = 0;
+	grupo->trabajando = 0;
+
+	for (; grupo->cant_hilos < hilos; grupo->cant_hilos++)
+		if (pthread_create(&grupo->hilos[grupo->cant_hilos], NULL, trabajar, grupo) != 0)
+		{
+			grupo_destruir(grupo);
+			return NULL;
+		}
+	return grupo;
+}
+
+// Termina los hilos y destruye el grupo.
+// Pre: el grupo fue creado y no se esta ejecutando.
+void grupo_destruir(grupo_t* grupo)
+{
+	pthread_mutex_lock(&grupo->mutex);
+	grupo->fin = true;
+	pthread_cond_broadcast(&grupo->hay_trabajo);
+	pthread_mutex_unlock(&grupo->mutex);
+	for (size_t i = 0; i < grupo->cant_hilos; i++)
+		pthread_join(grupo->hilos[i], NULL);
+
+	pthread_mutex_destroy(&grupo->mutex);
+	pthread_cond_destroy(&grupo->hay_trabajo);
+	pthread_cond_destroy(&grupo->terminado);
+	free(grupo->hilos);
+	free(grupo);
+}
+
+// Ejecuta tarea(i, extra) para cada i entre 0 y cantidad - 1, en
+// cualquier orden y en paralelo. Si otro hilo esta usando el grupo, las
+// tareas se hacen en el que llama, una atras de otra.
+// Pre: el grupo fue creado. La tarea se puede ejecutar en varios hilos al
+// mismo tiempo.
+// Post: Se hicieron todas las tareas.
+void grupo_ejecutar(grupo_t* grupo, size_t cantidad, grupo_tarea_t tarea, void* extra)
+{
+	// Para una sola tarea no vale la pena despertar a nadie.
+	if (grupo->cant_hilos == 0 || cantidad < 2 ||
+		__atomic_exchange_n(&grupo->ocupado, true, __ATOMIC_ACQUIRE))
+	{
+		for (size_t i = 0; i < cantidad; i++)
+			tarea(i, extra);
+		return;
+	}
+
+	pthread_mutex_lock(&grupo->mutex);
+	grupo->tarea = tarea;
+	grupo->extra = extra;
+	grupo->cantidad = cantidad;
+	grupo->siguiente = 0;
+	grupo->trabajando = grupo->cant_hilos;
+	grupo->vuelta++;
+	pthread_cond_broadcast(&grupo->hay_trabajo);
+	pthread_mutex_unlock(&grupo->mutex);
+
+	repartir(grupo);
+
+	pthread_mutex_lock(&grupo->mutex);
+	while (grupo->trabajando > 0)
+		pthread_cond_wait(&grupo->terminado, &grupo->mutex);
+	pthread_mutex_unlock(&grupo->mutex);
+	__atomic_store_n(&grupo->ocupado, false, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,42 @@
+#ifndef GRUPO_H
+#define GRUPO_H
+
+#include <stddef.h>
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* Un grupo de hilos ejecuta una tarea para cada indice entre 0 y
+ * cantidad - 1, repartiendo los indices entre sus hilos y el hilo que lo
+ * llama, y vuelve cuando estan todos hechos. Entre una ejecucion y la
+ * siguiente los hilos duermen. Lo pueden usar varios hilos: el que lo
+ * encuentra ocupado hace sus tareas solo. */
+
+typedef struct grupo grupo_t;
+
+// La tarea recibe el indice a hacer y el puntero extra de grupo_ejecutar.
+typedef void (*grupo_tarea_t)(size_t indice, void* extra);
+
+/* ******************************************************************
+ *                    PRIMITIVAS DEL GRUPO
+ * *****************************************************************/
+
+// Crea un grupo con hilos hilos, ademas del que llama a grupo_ejecutar
+// (con 0 las tareas se hacen en ese hilo, una atras de otra).
+// Post: Devuelve el grupo o NULL en caso de error.
+grupo_t* grupo_crear(size_t hilos);
+
+// Termina los hilos y destruye el grupo.
+// Pre: el grupo fue creado y no se esta ejecutando.
+void grupo_destruir(grupo_t* grupo);
+
+// Ejecuta tarea(i, extra) para cada i entre 0 y cantidad - 1, en
+// cualquier orden y en paralelo. Si otro hilo esta usando el grupo, las
+// tareas se hacen en el que llama, una atras de otra.
+// Pre: el grupo fue creado. La tarea se puede ejecutar en varios hilos al
+// mismo tiempo.
+// Post: Se hicieron todas las tareas.
+void grupo_ejecutar(grupo_t* grupo, size_t cantidad, grupo_tarea_t tarea, void* extra);
+
+#endif //GRUPO_H
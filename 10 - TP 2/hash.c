@@ -4,7 +4,6 @@
 #include <stddef.h>
 #include "hash.h"
 #include "lista.h"
-char *strdup(const char *s);
 
 #define TAM_INICIAL 97
 #define PROMEDIO_IDEAL 0.8
@@ -94,6 +93,60 @@ nodo_hash_t* buscar_nodo(const hash_t* hash, const char* clave, bool borrar_de_l
 	return nodo;
 }
 
+void determinar_redimension(hash_t* hash);
+
+// Lo que busca visitar_clave en una lista: una clave de largo conocido,
+// que no necesita terminar en '\0'.
+typedef struct busqueda{
+	const char* clave;
+	size_t largo;
+	nodo_hash_t* nodo;
+} busqueda_t;
+
+// Funcion para lista_iterar: se detiene en el nodo con la clave buscada.
+bool visitar_clave(void* dato, void* extra)
+{
+	nodo_hash_t* nodo = dato;
+	busqueda_t* busqueda = extra;
+	if (strncmp(nodo->clave, busqueda->clave, busqueda->largo) != 0 ||
+		nodo->clave[busqueda->largo] != '\0') return true;
+	busqueda->nodo = nodo;
+	return false;
+}
+
+// Agrega un nodo con una copia de los primeros largo caracteres de clave
+// y el dato, sin fijarse si la clave ya estaba.
+// Pre: indice es el de la clave (el que devuelve f_hash).
+// Post: Devuelve el nodo o NULL en caso de error.
+nodo_hash_t* insertar_nodo(hash_t* hash, const char* clave, size_t largo, size_t indice, void* dato)
+{
+	if (!hash->listas[indice]) //no existia la lista todavia.
+	{
+		hash->listas[indice] = lista_crear();
+		if (!hash->listas[indice]) return NULL;
+	}
+	nodo_hash_t* nodo = malloc(sizeof(nodo_hash_t));
+	char* copia_clave = malloc(largo + 1);
+	if (!nodo || !copia_clave || !lista_insertar_ultimo(hash->listas[indice], nodo)){
+		free(nodo);
+		free(copia_clave);
+		if (lista_esta_vacia(hash->listas[indice])) // la creamos recien
+		{
+			lista_destruir(hash->listas[indice], NULL);
+			hash->listas[indice] = NULL;
+		}
+		return NULL;
+	}
+
+	memcpy(copia_clave, clave, largo);
+	copia_clave[largo] = '\0';
+	nodo->clave = copia_clave;
+	nodo->dato = dato;
+	hash->cant++;
+	determinar_redimension(hash);
+	return nodo;
+}
+
 // Destruye el arreglo de listas.
 // Recibe opcionalmente funcion de destruccion de nodos y de datos.
 void destruir_listas(lista_t** listas, size_t tam, dest_nodo destruir_nodo, hash_destruir_dato_t destruir_dato)
@@ -112,8 +165,6 @@ void destruir_listas(lista_t** listas, size_t tam, dest_nodo destruir_nodo, hash
 	free(listas);
 }
 
-void determinar_redimension(hash_t* hash);
-
  /*                       Fin de f. auxiliares                     *
  *******************************************************************/
 
@@ -152,29 +203,26 @@ bool hash_guardar(hash_t *hash, const char *clave, void *dato)
 	}
 
 	// Si estamos aca, entonces no estaba la clave
-	size_t indice = f_hash(clave, strlen(clave), hash->tam);
+	size_t largo = strlen(clave);
+	return insertar_nodo(hash, clave, largo, f_hash(clave, largo, hash->tam), dato) != NULL;
+}
 
-	if (!hash->listas[indice]) //no existia la lista todavia.
-	{
-		hash->listas[indice] = lista_crear();
-		if (!hash->listas[indice]) return false;
-	}
-	nodo = malloc(sizeof(nodo_hash_t));
-	char* copia_clave = strdup(clave);
-	if (!nodo || !copia_clave){
-		free(nodo);
-		free(copia_clave);
-		if (lista_esta_vacia(hash->listas[indice])) // la creamos recien
-			lista_destruir(hash->listas[indice], NULL);
-		return false;	
-	}
+// Busca la clave formada por los primeros largo caracteres de clave (que
+// no necesita terminar en '\0'), y si no estaba la guarda con dato NULL.
+// Recorre la lista de la clave una sola vez, sin pedir memoria si ya estaba.
+// Si nueva no es NULL guarda ahi si la clave se acaba de agregar.
+// Pre: El hash fue creado.
+// Post: Devuelve el lugar del dato asociado a la clave, que vale mientras
+// la clave este en el hash, o NULL en caso de error.
+void **hash_obtener_o_insertar(hash_t *hash, const char *clave, size_t largo, bool *nueva)
+{
+	busqueda_t busqueda = {clave, largo, NULL};
+	size_t indice = f_hash(clave, largo, hash->tam);
+	if (hash->listas[indice]) lista_iterar(hash->listas[indice], visitar_clave, &busqueda);
 
-	nodo->clave = copia_clave;
-	nodo->dato = dato;
-	lista_insertar_ultimo(hash->listas[indice], nodo);
-	hash->cant++;
-	determinar_redimension(hash);
-	return true;
+	if (nueva) *nueva = !busqueda.nodo;
+	if (!busqueda.nodo) busqueda.nodo = insertar_nodo(hash, clave, largo, indice, NULL);
+	return busqueda.nodo ? &busqueda.nodo->dato : NULL;
 }
 
 // Borra la clave y devuelve su dato asociado.
@@ -346,15 +394,14 @@ bool redimensionar(hash_t* hash, size_t nuevo_tam)
 		size_t indice = f_hash(nodo->clave, strlen(nodo->clave), nuevo_tam);
 
 		if (!listas_nuevas[indice]) //no existia la lista todavia.
-		{
 			listas_nuevas[indice] = lista_crear();
-			if (!listas_nuevas[indice]) // fallo, borro lo nuevo manteniendo lo viejo.
-			{
-				destruir_listas(listas_nuevas, nuevo_tam, NULL, NULL); //sin dest. nodos
-				return false;	
-			}
+		// Si falla, borro lo nuevo manteniendo lo viejo.
+		if (!listas_nuevas[indice] || !lista_insertar_ultimo(listas_nuevas[indice], nodo))
+		{
+			destruir_listas(listas_nuevas, nuevo_tam, NULL, NULL); //sin dest. nodos
+			hash_iter_destruir(iter);
+			return false;
 		}
-		lista_insertar_ultimo(listas_nuevas[indice], nodo);
 		hash_iter_avanzar(iter);
 	}
 	destruir_listas(hash->listas, hash->tam, NULL, NULL); //sin dest. nodos!
@@ -27,6 +27,15 @@ hash_t *hash_crear(hash_destruir_dato_t destruir_dato);
 // Post: devuelve true si pudo guardar, false si no.
 bool hash_guardar(hash_t *hash, const char *clave, void *dato);
 
+// Busca la clave formada por los primeros largo caracteres de clave (que
+// no necesita terminar en '\0'), y si no estaba la guarda con dato NULL.
+// Hace una sola busqueda, en lugar de hash_obtener y despues hash_guardar.
+// Si nueva no es NULL guarda ahi si la clave se acaba de agregar.
+// Pre: El hash fue creado.
+// Post: Devuelve el lugar del dato asociado a la clave, que vale mientras
+// la clave este en el hash, o NULL en caso de error.
+void **hash_obtener_o_insertar(hash_t *hash, const char *clave, size_t largo, bool *nueva);
+
 // Borra la clave y devuelve su dato asociado.
 // Pre: El hash fue creado.
 // Post: Devuelve el dato asociado a la clave o NULL si
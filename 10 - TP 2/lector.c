@@ -0,0 +1,227 @@
+#define _DEFAULT_SOURCE // madvise
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "lector.h"
+
+#define TAM_BLOQUE (64 * 1024)
+#define LIBERAR_CADA (16 * 1024 * 1024)
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+// Leyendo con read, datos es un buffer de tam bytes con fin bytes validos.
+// Mapeado, datos es el archivo entero (tam == fin) y fd es -1.
+// En los dos casos, lo que falta entregar empieza en datos[inicio].
+struct lector
+{
+	int fd;
+	bool cerrar_fd;     // si el fd lo abrio el lector
+	char* datos;
+	size_t tam;
+	size_t inicio;
+	size_t fin;
+	size_t revisado;    // hasta donde se sabe que no hay '\n'
+	bool eof;
+	size_t liberado;    // mapeado: paginas ya devueltas al sistema
+	char* ultima;       // mapeado: copia de la ultima linea sin '\n'
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Entrega la linea que empieza en inicio y termina en fin_linea (donde hay
+// un '\n' o, al final de un buffer, lugar para el '\0').
+static char* entregar(lector_t* lector, size_t fin_linea, size_t* largo)
+{
+	char* linea = lector->datos + lector->inicio;
+	lector->datos[fin_linea] = '\0';
+	if (largo) *largo = fin_linea - lector->inicio;
+	lector->inicio = fin_linea + 1;
+	lector->revisado = lector->inicio;
+	return linea;
+}
+
+// Lee mas datos al buffer, corriendo al principio lo que falta entregar y
+// agrandandolo si la linea no entra.
+// Post: devuelve false en caso de error de memoria.
+static bool leer_bloque(lector_t* lector)
+{
+	if (lector->inicio > 0)
+	{
+		size_t pendiente = lector->fin - lector->inicio;
+		memmove(lector->datos, lector->datos + lector->inicio, pendiente);
+		lector->revisado -= lector->inicio;
+		lector->fin = pendiente;
+		lector->inicio = 0;
+	}
+	if (lector->fin + 1 >= lector->tam)
+	{
+		char* aux = realloc(lector->datos, lector->tam * 2);
+		if (!aux) return false;
+		lector->datos = aux;
+		lector->tam *= 2;
+	}
+	// Se deja siempre un byte libre para el '\0' de una ultima linea sin '\n'.
+	ssize_t leidos;
+	do leidos = read(lector->fd, lector->datos + lector->fin, lector->tam - lector->fin - 1);
+	while (leidos < 0 && errno == EINTR);
+
+	if (leidos <= 0) lector->eof = true;
+	else lector->fin += (size_t)leidos;
+	return true;
+}
+
+// lector_linea para un lector que usa read.
+static char* linea_leida(lector_t* lector, size_t* largo)
+{
+	while (true)
+	{
+		char* salto = memchr(lector->datos + lector->revisado, '\n', lector->fin - lector->revisado);
+		if (salto) return entregar(lector, (size_t)(salto - lector->datos), largo);
+		lector->revisado = lector->fin;
+
+		if (lector->eof)
+		{
+			if (lector->inicio == lector->fin) return NULL;
+			// Ultima linea sin '\n': queda el byte libre para el '\0'.
+			char* linea = entregar(lector, lector->fin, largo);
+			lector->inicio = lector->revisado = lector->fin;
+			return linea;
+		}
+		if (!leer_bloque(lector)) return NULL;
+	}
+}
+
+// lector_linea para un lector mapeado.
+static char* linea_mapeada(lector_t* lector, size_t* largo)
+{
+	if (lector->inicio == lector->fin) return NULL;
+
+	// Las paginas de las lineas ya entregadas no se vuelven a usar.
+	if (lector->inicio - lector->liberado >= LIBERAR_CADA)
+	{
+		size_t pagina = (size_t)sysconf(_SC_PAGESIZE);
+		size_t hasta = lector->inicio / pagina * pagina;
+		madvise(lector->datos + lector->liberado, hasta - lector->liberado, MADV_DONTNEED);
+		lector->liberado = hasta;
+	}
+
+	char* salto = memchr(lector->datos + lector->inicio, '\n', lector->fin - lector->inicio);
+	if (salto) return entregar(lector, (size_t)(salto - lector->datos), largo);
+
+	// La ultima linea no tiene '\n' y despues del final del archivo puede
+	// no haber lugar para el '\0': se copia.
+	size_t largo_ultima = lector->fin - lector->inicio;
+	free(lector->ultima);
+	lector->ultima = malloc(largo_ultima + 1);
+	if (!lector->ultima) return NULL;
+	memcpy(lector->ultima, lector->datos + lector->inicio, largo_ultima);
+	lector->ultima[largo_ultima] = '\0';
+	lector->inicio = lector->fin;
+	if (largo) *largo = largo_ultima;
+	return lector->ultima;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Crea un lector que lee del descriptor fd. El descriptor no se cierra al
+// destruir el lector.
+// Post: Devuelve el lector o NULL en caso de error.
+lector_t* lector_crear(int fd)
+{
+	lector_t* lector = malloc(sizeof(lector_t));
+	char* datos = malloc(TAM_BLOQUE);
+	if (!lector || !datos)
+	{
+		free(lector);
+		free(datos);
+		return NULL;
+	}
+	lector->fd = fd;
+	lector->cerrar_fd = false;
+	lector->datos = datos;
+	lector->tam = TAM_BLOQUE;
+	lector->inicio = 0;
+	lector->fin = 0;
+	lector->revisado = 0;
+	lector->eof = false;
+	lector->liberado = 0;
+	lector->ultima = NULL;
+	return lector;
+}
+
+// Crea un lector para el archivo ruta, mapeandolo si es un archivo comun.
+// Post: Devuelve el lector o NULL si no se pudo abrir el archivo.
+lector_t* lector_abrir(const char* ruta)
+{
+	int fd = open(ruta, O_RDONLY);
+	if (fd < 0) return NULL;
+
+	struct stat info;
+	if (fstat(fd, &info) < 0 || !S_ISREG(info.st_mode) || info.st_size == 0)
+	{
+		lector_t* lector = lector_crear(fd);
+		if (!lector) close(fd);
+		else lector->cerrar_fd = true;
+		return lector;
+	}
+
+	// MAP_PRIVATE: los '\0' que se escriben no llegan al archivo.
+	void* mapeo = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	lector_t* lector = malloc(sizeof(lector_t));
+	if (mapeo == MAP_FAILED || !lector)
+	{
+		if (mapeo != MAP_FAILED) munmap(mapeo, (size_t)info.st_size);
+		free(lector);
+		return NULL;
+	}
+	madvise(mapeo, (size_t)info.st_size, MADV_SEQUENTIAL);
+	lector->fd = -1;
+	lector->cerrar_fd = false;
+	lector->datos = mapeo;
+	lector->tam = (size_t)info.st_size;
+	lector->inicio = 0;
+	lector->fin = lector->tam;
+	lector->revisado = 0;
+	lector->eof = true;
+	lector->liberado = 0;
+	lector->ultima = NULL;
+	return lector;
+}
+
+// Destruye el lector. Las lineas que entrego dejan de valer.
+// Pre: el lector fue creado.
+void lector_destruir(lector_t* lector)
+{
+	if (lector->fd < 0)
+		munmap(lector->datos, lector->tam);
+	else
+	{
+		free(lector->datos);
+		if (lector->cerrar_fd) close(lector->fd);
+	}
+	free(lector->ultima);
+	free(lector);
+}
+
+// Devuelve la proxima linea, sin el '\n' final, o NULL si no hay mas lineas.
+// Pre: el lector fue creado.
+// Post: la linea anterior deja de valer.
+char* lector_linea(lector_t* lector, size_t* largo)
+{
+	if (lector->fd < 0) return linea_mapeada(lector, largo);
+	return linea_leida(lector, largo);
+}
@@ -0,0 +1,43 @@
+#ifndef LECTOR_H
+#define LECTOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* El lector entrega las lineas de un archivo de a una, sin pedir memoria
+ * por cada linea: lee de a bloques grandes con read(2) (o mapea el archivo
+ * entero con mmap) y devuelve punteros a su propio buffer, cambiando cada
+ * '\n' por '\0'. Cada linea vale hasta la proxima llamada a lector_linea. */
+
+typedef struct lector lector_t;
+
+/* ******************************************************************
+ *                    PRIMITIVAS DEL LECTOR
+ * *****************************************************************/
+
+// Crea un lector que lee del descriptor fd (por ejemplo, 0 para la entrada
+// estandar). El descriptor no se cierra al destruir el lector.
+// Post: Devuelve el lector o NULL en caso de error.
+lector_t* lector_crear(int fd);
+
+// Crea un lector para el archivo ruta. Si es un archivo comun lo mapea con
+// mmap; si no (una fifo, por ejemplo), lo lee como lector_crear.
+// Post: Devuelve el lector o NULL si no se pudo abrir el archivo.
+lector_t* lector_abrir(const char* ruta);
+
+// Destruye el lector. Las lineas que entrego dejan de valer.
+// Pre: el lector fue creado.
+void lector_destruir(lector_t* lector);
+
+// Devuelve la proxima linea, sin el '\n' final, o NULL si no hay mas lineas
+// (o hubo un error). Si largo no es NULL guarda ahi el largo de la linea.
+// La linea puede modificarse (por ejemplo con strtok).
+// Pre: el lector fue creado.
+// Post: la linea anterior deja de valer.
+char* lector_linea(lector_t* lector, size_t* largo);
+
+#endif //LECTOR_H
@@ -0,0 +1,280 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include "posteos.h"
+
+#define BLOQUES_INICIAL 1
+#define BYTES_INICIAL 16
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+// Cabecera de un bloque: sus ids son primero y despues cantidad - 1
+// diferencias, en datos a partir de inicio.
+typedef struct bloque
+{
+	size_t primero;
+	size_t ultimo;
+	size_t inicio;
+	size_t cantidad;
+} bloque_t;
+
+// Los bloques estan uno atras del otro en datos; solo el ultimo crece.
+struct posteos
+{
+	bloque_t* bloques;
+	size_t cant_bloques;
+	size_t tam_bloques;
+	uint8_t* datos;
+	size_t usados;
+	size_t tam_datos;
+	size_t cantidad;
+};
+
+// ids tiene descomprimido el bloque actual; el cursor esta en ids[pos - 1]
+// y cuando pos llega a 0 pasa al bloque anterior.
+struct posteos_cursor
+{
+	const posteos_t* posteos;
+	size_t bloque;   // bloque actual + 1, o 0 si ya no quedan
+	size_t pos;
+	size_t ids[POSTEOS_POR_BLOQUE];
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Se asegura de que entren n bytes mas en datos y un bloque mas.
+// Post: Devuelve false en caso de error.
+static bool hacer_lugar(posteos_t* posteos, size_t n)
+{
+	if (posteos->usados + n > posteos->tam_datos)
+	{
+		size_t tam = posteos->tam_datos * 2;
+		while (posteos->usados + n > tam) tam *= 2;
+		uint8_t* aux = realloc(posteos->datos, tam);
+		if (!aux) return false;
+		posteos->datos = aux;
+		posteos->tam_datos = tam;
+	}
+	if (posteos->cant_bloques == posteos->tam_bloques)
+	{
+		bloque_t* aux = realloc(posteos->bloques, 2 * posteos->tam_bloques * sizeof(bloque_t));
+		if (!aux) return false;
+		posteos->bloques = aux;
+		posteos->tam_bloques *= 2;
+	}
+	return true;
+}
+
+// Escribe valor como varint en destino.
+// Post: Devuelve la cantidad de bytes escritos.
+static size_t escribir_varint(uint8_t* destino, size_t valor)
+{
+	size_t n = 0;
+	while (valor >= 0x80)
+	{
+		destino[n++] = (uint8_t)(valor | 0x80);
+		valor >>= 7;
+	}
+	destino[n++] = (uint8_t)valor;
+	return n;
+}
+
+// Descomprime el bloque b en los ids del cursor y lo deja en su ultimo id.
+static void descomprimir(posteos_cursor_t* cursor, size_t b)
+{
+	const bloque_t* bloque = &cursor->posteos->bloques[b];
+	const uint8_t* p = cursor->posteos->datos + bloque->inicio;
+	size_t id = bloque->primero;
+	cursor->ids[0] = id;
+	for (size_t i = 1; i < bloque->cantidad; i++)
+	{
+		size_t delta = 0;
+		unsigned corrimiento = 0;
+		while (*p & 0x80)
+		{
+			delta |= (size_t)(*p++ & 0x7f) << corrimiento;
+			corrimiento += 7;
+		}
+		delta |= (size_t)*p++ << corrimiento;
+		id += delta;
+		cursor->ids[i] = id;
+	}
+	cursor->bloque = b + 1;
+	cursor->pos = bloque->cantidad;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Crea una lista de posteos vacia.
+// Post: Devuelve la lista o NULL en caso de error.
+posteos_t* posteos_crear(void)
+{
+	posteos_t* posteos = malloc(sizeof(posteos_t));
+	bloque_t* bloques = malloc(BLOQUES_INICIAL * sizeof(bloque_t));
+	uint8_t* datos = malloc(BYTES_INICIAL);
+	if (!posteos || !bloques || !datos)
+	{
+		free(posteos);
+		free(bloques);
+		free(datos);
+		return NULL;
+	}
+	posteos->bloques = bloques;
+	posteos->cant_bloques = 0;
+	posteos->tam_bloques = BLOQUES_INICIAL;
+	posteos->datos = datos;
+	posteos->usados = 0;
+	posteos->tam_datos = BYTES_INICIAL;
+	posteos->cantidad = 0;
+	return posteos;
+}
+
+// Destruye la lista de posteos.
+// Pre: la lista fue creada.
+void posteos_destruir(posteos_t* posteos)
+{
+	free(posteos->bloques);
+	free(posteos->datos);
+	free(posteos);
+}
+
+// Agrega el id al final de la lista. Si es igual al ultimo no lo agrega
+// otra vez.
+// Pre: la lista fue creada. id no es menor al ultimo agregado.
+// Post: Devuelve false en caso de error.
+bool posteos_agregar(posteos_t* posteos, size_t id)
+{
+	bloque_t* ultimo = posteos->cant_bloques ? &posteos->bloques[posteos->cant_bloques - 1] : NULL;
+	if (ultimo && ultimo->ultimo == id) return true;
+
+	// Un varint de un size_t ocupa a lo sumo 10 bytes.
+	if (!hacer_lugar(posteos, 10)) return false;
+	ultimo = posteos->cant_bloques ? &posteos->bloques[posteos->cant_bloques - 1] : NULL;
+
+	if (!ultimo || ultimo->cantidad == POSTEOS_POR_BLOQUE)
+	{
+		// Bloque nuevo: el primer id va en la cabecera.
+		bloque_t* bloque = &posteos->bloques[posteos->cant_bloques++];
+		bloque->primero = id;
+		bloque->ultimo = id;
+		bloque->inicio = posteos->usados;
+		bloque->cantidad = 1;
+	}
+	else
+	{
+		posteos->usados += escribir_varint(posteos->datos + posteos->usados, id - ultimo->ultimo);
+		ultimo->ultimo = id;
+		ultimo->cantidad++;
+	}
+	posteos->cantidad++;
+	return true;
+}
+
+// Devuelve la cantidad de ids de la lista.
+// Pre: la lista fue creada.
+size_t posteos_cantidad(const posteos_t* posteos)
+{
+	return posteos->cantidad;
+}
+
+// Devuelve los bytes que ocupa la lista.
+// Pre: la lista fue creada.
+size_t posteos_memoria(const posteos_t* posteos)
+{
+	return sizeof(posteos_t) + posteos->tam_bloques * sizeof(bloque_t) + posteos->tam_datos;
+}
+
+// Crea un cursor parado en el ultimo id de la lista (el mayor).
+// Pre: la lista fue creada y no se le agregan ids mientras se use el cursor.
+// Post: Devuelve el cursor o NULL en caso de error.
+posteos_cursor_t* posteos_cursor_crear(const posteos_t* posteos)
+{
+	posteos_cursor_t* cursor = malloc(sizeof(posteos_cursor_t));
+	if (!cursor) return NULL;
+	cursor->posteos = posteos;
+	cursor->bloque = 0;
+	cursor->pos = 0;
+	if (posteos->cant_bloques > 0) descomprimir(cursor, posteos->cant_bloques - 1);
+	return cursor;
+}
+
+// Destruye el cursor.
+// Pre: el cursor fue creado.
+void posteos_cursor_destruir(posteos_cursor_t* cursor)
+{
+	free(cursor);
+}
+
+// Devuelve true si el cursor ya paso por todos los ids.
+// Pre: el cursor fue creado.
+bool posteos_cursor_al_final(const posteos_cursor_t* cursor)
+{
+	return cursor->pos == 0;
+}
+
+// Devuelve el id en el que esta parado el cursor.
+// Pre: el cursor fue creado y no esta al final.
+size_t posteos_cursor_ver_actual(const posteos_cursor_t* cursor)
+{
+	return cursor->ids[cursor->pos - 1];
+}
+
+// Mueve el cursor al id anterior (el siguiente mas chico).
+// Pre: el cursor fue creado y no esta al final.
+void posteos_cursor_avanzar(posteos_cursor_t* cursor)
+{
+	if (--cursor->pos > 0) return;
+	// Se termino el bloque: se pasa al anterior, si hay.
+	if (cursor->bloque > 1) descomprimir(cursor, cursor->bloque - 2);
+}
+
+// Mueve el cursor hasta el primer id que no sea mayor a id, salteando los
+// bloques que no hace falta descomprimir. Si el actual ya no es mayor, no
+// se mueve.
+// Pre: el cursor fue creado.
+// Post: Devuelve false si el cursor quedo al final.
+bool posteos_cursor_buscar(posteos_cursor_t* cursor, size_t id)
+{
+	if (posteos_cursor_al_final(cursor)) return false;
+	if (posteos_cursor_ver_actual(cursor) <= id) return true;
+
+	// Si el id es anterior al bloque actual, se busca (por las cabeceras)
+	// el ultimo bloque que empieza en id o antes.
+	const bloque_t* bloques = cursor->posteos->bloques;
+	size_t actual = cursor->bloque - 1;
+	if (bloques[actual].primero > id)
+	{
+		size_t izq = 0, der = actual; // el bloque buscado esta en [izq, der)
+		while (izq < der)
+		{
+			size_t medio = izq + (der - izq) / 2;
+			if (bloques[medio].primero <= id) izq = medio + 1;
+			else der = medio;
+		}
+		if (izq == 0)
+		{
+			cursor->pos = 0;
+			return false;
+		}
+		descomprimir(cursor, izq - 1);
+	}
+
+	// Dentro del bloque, que empieza en id o antes: el ultimo de
+	// ids[0, pos) que no es mayor a id.
+	size_t izq = 1, der = cursor->pos;
+	while (izq < der)
+	{
+		size_t medio = izq + (der - izq) / 2;
+		if (cursor->ids[medio] <= id) izq = medio + 1;
+		else der = medio;
+	}
+	cursor->pos = izq;
+	return true;
+}
@@ -0,0 +1,82 @@
+#ifndef POSTEOS_H
+#define POSTEOS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* Una lista de posteos guarda ids crecientes (los de los tweets que tienen
+ * una palabra) comprimidos: de a bloques de POSTEOS_POR_BLOQUE ids, cada
+ * uno guardado como la diferencia con el anterior en un varint (un byte
+ * cada 7 bits). Cada bloque tiene una cabecera con su primer y su ultimo
+ * id, que permite saltear bloques enteros al buscar.
+ * Se recorre de la mas nueva a la mas vieja con un cursor, que descomprime
+ * de a un bloque. */
+
+#define POSTEOS_POR_BLOQUE 128
+
+typedef struct posteos posteos_t;
+typedef struct posteos_cursor posteos_cursor_t;
+
+/* ******************************************************************
+ *                 PRIMITIVAS DE LOS POSTEOS
+ * *****************************************************************/
+
+// Crea una lista de posteos vacia.
+// Post: Devuelve la lista o NULL en caso de error.
+posteos_t* posteos_crear(void);
+
+// Destruye la lista de posteos.
+// Pre: la lista fue creada.
+void posteos_destruir(posteos_t* posteos);
+
+// Agrega el id al final de la lista. Si es igual al ultimo no lo agrega
+// otra vez.
+// Pre: la lista fue creada. id no es menor al ultimo agregado.
+// Post: Devuelve false en caso de error.
+bool posteos_agregar(posteos_t* posteos, size_t id);
+
+// Devuelve la cantidad de ids de la lista.
+// Pre: la lista fue creada.
+size_t posteos_cantidad(const posteos_t* posteos);
+
+// Devuelve los bytes que ocupa la lista.
+// Pre: la lista fue creada.
+size_t posteos_memoria(const posteos_t* posteos);
+
+/* ******************************************************************
+ *                  PRIMITIVAS DEL CURSOR
+ * *****************************************************************/
+
+// Crea un cursor parado en el ultimo id de la lista (el mayor).
+// Pre: la lista fue creada y no se le agregan ids mientras se use el cursor.
+// Post: Devuelve el cursor o NULL en caso de error.
+posteos_cursor_t* posteos_cursor_crear(const posteos_t* posteos);
+
+// Destruye el cursor.
+// Pre: el cursor fue creado.
+void posteos_cursor_destruir(posteos_cursor_t* cursor);
+
+// Devuelve true si el cursor ya paso por todos los ids.
+// Pre: el cursor fue creado.
+bool posteos_cursor_al_final(const posteos_cursor_t* cursor);
+
+// Devuelve el id en el que esta parado el cursor.
+// Pre: el cursor fue creado y no esta al final.
+size_t posteos_cursor_ver_actual(const posteos_cursor_t* cursor);
+
+// Mueve el cursor al id anterior (el siguiente mas chico).
+// Pre: el cursor fue creado y no esta al final.
+void posteos_cursor_avanzar(posteos_cursor_t* cursor);
+
+// Mueve el cursor hasta el primer id que no sea mayor a id, salteando los
+// bloques que no hace falta descomprimir. Si el actual ya no es mayor, no
+// se mueve.
+// Pre: el cursor fue creado.
+// Post: Devuelve false si el cursor quedo al final.
+bool posteos_cursor_buscar(posteos_cursor_t* cursor, size_t id);
+
+#endif //POSTEOS_H
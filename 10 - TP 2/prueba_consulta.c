@@ -0,0 +1,182 @@
+#include "consulta.h"
+#include "posteos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+#define MAX_ID 4000
+#define CANT_LISTAS 4
+
+/*******************************************************************
+ *                        AUXILIARES                               *
+ ******************************************************************/
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+// Llena cada lista con los ids menores a MAX_ID que le tocan al azar con
+// la densidad de la lista (en milesimos), y marca en esta[i][id] si el id
+// quedo en la lista i.
+bool llenar_listas(posteos_t** listas, const int* densidades, size_t cantidad, bool esta[][MAX_ID])
+{
+	for (size_t i = 0; i < cantidad; i++)
+	{
+		for (size_t id = 0; id < MAX_ID; id++)
+		{
+			esta[i][id] = rand() % 1000 < densidades[i];
+			if (esta[i][id] && !posteos_agregar(listas[i], id)) return false;
+		}
+	}
+	return true;
+}
+
+// Devuelve true si la consulta entrega, de mayor a menor, exactamente los
+// ids que estan en todas las listas (OPERADOR_Y) o en alguna (OPERADOR_O).
+bool coincide_con_fuerza_bruta(const posteos_t** listas, size_t cantidad, operador_t operador, bool esta[][MAX_ID])
+{
+	consulta_t* consulta = consulta_crear(listas, cantidad, operador);
+	if (!consulta) return false;
+	bool ok = true;
+	size_t id;
+	for (size_t esperado = MAX_ID; ok && esperado > 0; esperado--)
+	{
+		bool en_todas = true, en_alguna = false;
+		for (size_t i = 0; i < cantidad; i++)
+		{
+			en_todas &= esta[i][esperado - 1];
+			en_alguna |= esta[i][esperado - 1];
+		}
+		if (operador == OPERADOR_Y ? !en_todas : !en_alguna) continue;
+		ok = consulta_siguiente(consulta, &id) && id == esperado - 1;
+	}
+	ok = ok && !consulta_siguiente(consulta, &id) && !consulta_fallo(consulta);
+	consulta_destruir(consulta);
+	return ok;
+}
+
+// Cuenta y separa la busqueda (en una copia) y devuelve true si dio los
+// terminos esperados con el operador esperado.
+bool separa_en(const char* busqueda, operador_t operador, const char** esperados, size_t cantidad)
+{
+	char copia[64];
+	strcpy(copia, busqueda);
+	operador_t obtenido;
+	if (consulta_contar_terminos(copia, &obtenido) != cantidad) return false;
+	if (cantidad > 1 && obtenido != operador) return false;
+	char* terminos[8];
+	consulta_separar_terminos(copia, terminos, cantidad, obtenido);
+	for (size_t i = 0; i < cantidad; i++)
+		if (strcmp(terminos[i], esperados[i]) != 0) return false;
+	return true;
+}
+
+/*******************************************************************
+ *                        PRUEBAS UNITARIAS                        *
+ ******************************************************************/
+
+void pruebas_consulta_terminos()
+{
+	print_test("Prueba usuarios y hashtags son terminos", consulta_es_termino("@a") && consulta_es_termino("#a"));
+	print_test("Prueba otras cadenas no son terminos", !consulta_es_termino("a") && !consulta_es_termino(""));
+
+	const char* uno[] = {"#hola"};
+	print_test("Prueba un termino solo", separa_en("#hola", OPERADOR_Y, uno, 1));
+	const char* y[] = {"#a", "@b", "#c"};
+	print_test("Prueba separar terminos unidos por &", separa_en("#a&@b&#c", OPERADOR_Y, y, 3));
+	const char* o[] = {"@a", "#b"};
+	print_test("Prueba separar terminos unidos por |", separa_en("@a|#b", OPERADOR_O, o, 2));
+
+	// Si algo no se puede separar, la busqueda entera es un termino.
+	const char* final_y[] = {"#a&"};
+	print_test("Prueba un & al final es parte del termino", separa_en("#a&", OPERADOR_Y, final_y, 1));
+	const char* final_o[] = {"#a|#b|"};
+	print_test("Prueba un | al final es parte del termino", separa_en("#a|#b|", OPERADOR_O, final_o, 1));
+	const char* medio[] = {"#r&b"};
+	print_test("Prueba un & seguido de algo que no es termino", separa_en("#r&b", OPERADOR_Y, medio, 1));
+	const char* mezcla[] = {"#a&#b|#c"};
+	print_test("Prueba & y | mezclados son un termino", separa_en("#a&#b|#c", OPERADOR_Y, mezcla, 1));
+	const char* mezcla_o[] = {"#a|#b&#c"};
+	print_test("Prueba | y & mezclados son un termino", separa_en("#a|#b&#c", OPERADOR_O, mezcla_o, 1));
+}
+
+void pruebas_consulta_fuerza_bruta()
+{
+	// Listas de varios bloques, con densidades muy distintas para que la
+	// interseccion saltee bloques enteros de las listas largas.
+	const int densidades[CANT_LISTAS] = {900, 500, 150, 60};
+	static bool esta[CANT_LISTAS][MAX_ID];
+	posteos_t* listas[CANT_LISTAS];
+	bool ok = true;
+	for (size_t i = 0; i < CANT_LISTAS; i++)
+		ok &= (listas[i] = posteos_crear()) != NULL;
+	srand(3);
+	ok = ok && llenar_listas(listas, densidades, CANT_LISTAS, esta);
+	print_test("Prueba crear listas de mas de un bloque", ok && posteos_cantidad(listas[CANT_LISTAS - 1]) > POSTEOS_POR_BLOQUE);
+
+	const posteos_t** constantes = (const posteos_t**)listas;
+	for (size_t cantidad = 1; cantidad <= CANT_LISTAS; cantidad++)
+	{
+		char nombre[64];
+		sprintf(nombre, "Prueba Y de %zu listas coincide con fuerza bruta", cantidad);
+		print_test(nombre, coincide_con_fuerza_bruta(constantes, cantidad, OPERADOR_Y, esta));
+		sprintf(nombre, "Prueba O de %zu listas coincide con fuerza bruta", cantidad);
+		print_test(nombre, coincide_con_fuerza_bruta(constantes, cantidad, OPERADOR_O, esta));
+	}
+
+	// La lista menos densa primero: el candidato lo pone ella.
+	const posteos_t* al_reves[CANT_LISTAS];
+	bool esta_al_reves[CANT_LISTAS][MAX_ID];
+	for (size_t i = 0; i < CANT_LISTAS; i++)
+	{
+		al_reves[i] = listas[CANT_LISTAS - 1 - i];
+		memcpy(esta_al_reves[i], esta[CANT_LISTAS - 1 - i], sizeof(esta[i]));
+	}
+	print_test("Prueba Y con la lista corta primero", coincide_con_fuerza_bruta(al_reves, CANT_LISTAS, OPERADOR_Y, esta_al_reves));
+	print_test("Prueba O con la lista corta primero", coincide_con_fuerza_bruta(al_reves, CANT_LISTAS, OPERADOR_O, esta_al_reves));
+
+	// Una lista vacia: la Y no da nada y la O da lo mismo que sin ella.
+	posteos_t* vacia = posteos_crear();
+	const posteos_t* con_vacia[] = {listas[0], vacia, listas[1]};
+	bool esta_con_vacia[3][MAX_ID] = {{false}};
+	memcpy(esta_con_vacia[0], esta[0], sizeof(esta[0]));
+	memcpy(esta_con_vacia[2], esta[1], sizeof(esta[1]));
+	print_test("Prueba Y con una lista vacia", vacia && coincide_con_fuerza_bruta(con_vacia, 3, OPERADOR_Y, esta_con_vacia));
+	print_test("Prueba O con una lista vacia", vacia && coincide_con_fuerza_bruta(con_vacia, 3, OPERADOR_O, esta_con_vacia));
+	if (vacia) posteos_destruir(vacia);
+
+	for (size_t i = 0; i < CANT_LISTAS; i++)
+		if (listas[i]) posteos_destruir(listas[i]);
+}
+
+void pruebas_consulta_cortar()
+{
+	// Se puede dejar de pedir resultados en cualquier momento.
+	posteos_t* pares = posteos_crear();
+	posteos_t* triples = posteos_crear();
+	bool ok = pares && triples;
+	for (size_t id = 0; ok && id < 3 * POSTEOS_POR_BLOQUE; id++)
+	{
+		if (id % 2 == 0) ok = posteos_agregar(pares, id);
+		if (ok && id % 3 == 0) ok = posteos_agregar(triples, id);
+	}
+	const posteos_t* listas[] = {pares, triples};
+	consulta_t* consulta = ok ? consulta_crear(listas, 2, OPERADOR_Y) : NULL;
+	size_t primero = 0, segundo = 0;
+	ok = consulta && consulta_siguiente(consulta, &primero) && consulta_siguiente(consulta, &segundo);
+	print_test("Prueba Y da los multiplos de 6", ok && primero == 3 * POSTEOS_POR_BLOQUE - 6 && segundo == primero - 6);
+	if (consulta) consulta_destruir(consulta);
+	if (pares) posteos_destruir(pares);
+	if (triples) posteos_destruir(triples);
+}
+
+int main(void)
+{
+	pruebas_consulta_terminos();
+	pruebas_consulta_fuerza_bruta();
+	pruebas_consulta_cortar();
+	return 0;
+}
@@ -0,0 +1,106 @@
+#include "hash.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+/*******************************************************************
+ *                        AUXILIARES                               *
+ ******************************************************************/
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+/*******************************************************************
+ *                        PRUEBAS UNITARIAS                        *
+ ******************************************************************/
+
+void pruebas_obtener_o_insertar_nueva()
+{
+	hash_t* hash = hash_crear(NULL);
+	bool nueva = false;
+	void** dato = hash_obtener_o_insertar(hash, "perro", 5, &nueva);
+	print_test("Prueba insertar una clave que no estaba", dato && nueva);
+	print_test("Prueba la clave insertada tiene dato NULL", dato && *dato == NULL);
+	print_test("Prueba la clave insertada pertenece", hash_pertenece(hash, "perro") && hash_cantidad(hash) == 1);
+
+	int valor = 7;
+	*dato = &valor;
+	void** otra_vez = hash_obtener_o_insertar(hash, "perro", 5, &nueva);
+	print_test("Prueba obtener una clave que estaba", otra_vez == dato && !nueva);
+	print_test("Prueba obtener no cambia la cantidad", hash_cantidad(hash) == 1);
+	print_test("Prueba el dato se cambia por el lugar devuelto", hash_obtener(hash, "perro") == &valor);
+	print_test("Prueba nueva puede ser NULL", hash_obtener_o_insertar(hash, "perro", 5, NULL) == dato);
+	hash_destruir(hash);
+}
+
+void pruebas_obtener_o_insertar_largo()
+{
+	hash_t* hash = hash_crear(NULL);
+	// Claves que no terminan en '\0': trozos de una linea.
+	const char linea[] = "gatogatitogato";
+	bool nueva = false;
+	void** gato = hash_obtener_o_insertar(hash, linea, 4, &nueva);
+	print_test("Prueba insertar una clave sin '\\0'", gato && nueva && hash_pertenece(hash, "gato"));
+	print_test("Prueba la clave sin '\\0' se copia entera", !hash_pertenece(hash, "gatogatitogato") && hash_cantidad(hash) == 1);
+
+	void** gatito = hash_obtener_o_insertar(hash, linea + 4, 6, &nueva);
+	print_test("Prueba insertar una clave del medio de la linea", gatito && nueva && gatito != gato && hash_pertenece(hash, "gatito"));
+	print_test("Prueba obtener la misma clave de otra parte de la linea", hash_obtener_o_insertar(hash, linea + 10, 4, &nueva) == gato && !nueva);
+
+	// Una clave que es prefijo de otra no la encuentra, y al reves.
+	void** gat = hash_obtener_o_insertar(hash, linea, 3, &nueva);
+	print_test("Prueba un prefijo de una clave es otra clave", gat && nueva && gat != gato);
+	void** gatit = hash_obtener_o_insertar(hash, "gatitos", 5, &nueva);
+	print_test("Prueba un prefijo de una clave con largo es otra clave", gatit && nueva && gatit != gatito);
+	print_test("Prueba las claves quedan todas", hash_cantidad(hash) == 4 && hash_pertenece(hash, "gat") && hash_pertenece(hash, "gatit"));
+
+	print_test("Prueba la clave vacia", hash_obtener_o_insertar(hash, linea, 0, &nueva) && nueva && hash_pertenece(hash, ""));
+	hash_destruir(hash);
+}
+
+void pruebas_obtener_o_insertar_redimension()
+{
+	// El lugar de un dato es el del nodo, que no cambia al redimensionar.
+	const size_t cantidad = 5000;
+	hash_t* hash = hash_crear(NULL);
+	void*** lugares = malloc(cantidad * sizeof(void**));
+	size_t* valores = malloc(cantidad * sizeof(size_t));
+	bool ok = lugares && valores;
+	char clave[16];
+	for (size_t i = 0; ok && i < cantidad; i++)
+	{
+		sprintf(clave, "clave%zu", i);
+		bool nueva = false;
+		lugares[i] = hash_obtener_o_insertar(hash, clave, strlen(clave), &nueva);
+		ok = lugares[i] && nueva;
+		if (!ok) break;
+		valores[i] = i;
+		*lugares[i] = &valores[i];
+	}
+	print_test("Prueba insertar muchas claves", ok && hash_cantidad(hash) == cantidad);
+
+	// Los primeros lugares se pidieron antes de varias redimensiones.
+	for (size_t i = 0; ok && i < cantidad; i++)
+	{
+		sprintf(clave, "clave%zu", i);
+		bool nueva = true;
+		ok = hash_obtener_o_insertar(hash, clave, strlen(clave), &nueva) == lugares[i] && !nueva;
+		ok = ok && hash_obtener(hash, clave) == &valores[i] && *(size_t*)*lugares[i] == i;
+	}
+	print_test("Prueba los lugares siguen valiendo despues de redimensionar", ok);
+	free(lugares);
+	free(valores);
+	hash_destruir(hash);
+}
+
+int main(void)
+{
+	pruebas_obtener_o_insertar_nueva();
+	pruebas_obtener_o_insertar_largo();
+	pruebas_obtener_o_insertar_redimension();
+	return 0;
+}
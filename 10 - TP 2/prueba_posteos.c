@@ -0,0 +1,172 @@
+#include "posteos.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/*******************************************************************
+ *                        AUXILIARES                               *
+ ******************************************************************/
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+// El id i de las listas de prueba. Los saltos crecen con i, asi que hay
+// diferencias de uno, dos y tres bytes.
+size_t id_de(size_t i)
+{
+	return 3 + i * 5 + i * i * 97;
+}
+
+// Crea una lista con los ids id_de(0) .. id_de(cantidad - 1).
+posteos_t* crear_con(size_t cantidad)
+{
+	posteos_t* posteos = posteos_crear();
+	if (!posteos) return NULL;
+	for (size_t i = 0; i < cantidad; i++)
+	{
+		if (!posteos_agregar(posteos, id_de(i)))
+		{
+			posteos_destruir(posteos);
+			return NULL;
+		}
+	}
+	return posteos;
+}
+
+// Devuelve true si el cursor recorre exactamente id_de(cantidad - 1) ..
+// id_de(0), de mayor a menor.
+bool recorre_todos(const posteos_t* posteos, size_t cantidad)
+{
+	posteos_cursor_t* cursor = posteos_cursor_crear(posteos);
+	if (!cursor) return false;
+	bool ok = true;
+	for (size_t i = cantidad; ok && i > 0; i--)
+	{
+		ok = !posteos_cursor_al_final(cursor) && posteos_cursor_ver_actual(cursor) == id_de(i - 1);
+		if (ok) posteos_cursor_avanzar(cursor);
+	}
+	ok = ok && posteos_cursor_al_final(cursor);
+	posteos_cursor_destruir(cursor);
+	return ok;
+}
+
+/*******************************************************************
+ *                        PRUEBAS UNITARIAS                        *
+ ******************************************************************/
+
+void pruebas_posteos_vacio()
+{
+	posteos_t* posteos = posteos_crear();
+	print_test("Prueba crear posteos", posteos != NULL);
+	print_test("Prueba posteos vacio tiene cantidad 0", posteos_cantidad(posteos) == 0);
+	posteos_cursor_t* cursor = posteos_cursor_crear(posteos);
+	print_test("Prueba cursor de posteos vacio esta al final", cursor && posteos_cursor_al_final(cursor));
+	print_test("Prueba buscar en posteos vacio devuelve false", !posteos_cursor_buscar(cursor, 10));
+	posteos_cursor_destruir(cursor);
+	posteos_destruir(posteos);
+}
+
+void pruebas_posteos_bordes_de_bloque()
+{
+	// Un bloque justo lleno, uno de mas y uno de menos.
+	size_t cantidades[] = {POSTEOS_POR_BLOQUE - 1, POSTEOS_POR_BLOQUE, POSTEOS_POR_BLOQUE + 1};
+	char* nombres[] = {"Prueba recorrer 127 ids", "Prueba recorrer 128 ids", "Prueba recorrer 129 ids"};
+	for (size_t c = 0; c < 3; c++)
+	{
+		posteos_t* posteos = crear_con(cantidades[c]);
+		bool ok = posteos && posteos_cantidad(posteos) == cantidades[c];
+		print_test(nombres[c], ok && recorre_todos(posteos, cantidades[c]));
+		if (posteos) posteos_destruir(posteos);
+	}
+}
+
+void pruebas_posteos_repetidos()
+{
+	posteos_t* posteos = posteos_crear();
+	bool ok = true;
+	for (size_t i = 0; i < 200; i++)
+	{
+		ok &= posteos_agregar(posteos, id_de(i));
+		ok &= posteos_agregar(posteos, id_de(i));
+	}
+	print_test("Prueba agregar ids repetidos", ok);
+	print_test("Prueba los repetidos se cuentan una vez", posteos_cantidad(posteos) == 200);
+	print_test("Prueba los repetidos se recorren una vez", recorre_todos(posteos, 200));
+
+	// El primer id de un bloque nuevo repetido justo despues de llenarse el
+	// anterior.
+	posteos_t* justo = crear_con(POSTEOS_POR_BLOQUE + 1);
+	ok = justo && posteos_agregar(justo, id_de(POSTEOS_POR_BLOQUE));
+	print_test("Prueba repetir el primero de un bloque", ok && posteos_cantidad(justo) == POSTEOS_POR_BLOQUE + 1 && recorre_todos(justo, POSTEOS_POR_BLOQUE + 1));
+	if (justo) posteos_destruir(justo);
+	posteos_destruir(posteos);
+}
+
+void pruebas_posteos_buscar()
+{
+	const size_t cantidad = 5 * POSTEOS_POR_BLOQUE + 7;
+	posteos_t* posteos = crear_con(cantidad);
+	posteos_cursor_t* cursor = posteos ? posteos_cursor_crear(posteos) : NULL;
+	print_test("Prueba crear posteos para buscar", cursor != NULL);
+	if (!cursor)
+	{
+		if (posteos) posteos_destruir(posteos);
+		return;
+	}
+
+	// Un id que esta, en el bloque actual.
+	size_t ultimo = cantidad - 1;
+	bool ok = posteos_cursor_buscar(cursor, id_de(ultimo - 2)) && posteos_cursor_ver_actual(cursor) == id_de(ultimo - 2);
+	print_test("Prueba buscar un id del bloque actual", ok);
+
+	// Si el actual ya no es mayor, no se mueve.
+	ok = posteos_cursor_buscar(cursor, id_de(ultimo)) && posteos_cursor_ver_actual(cursor) == id_de(ultimo - 2);
+	print_test("Prueba buscar un id mayor al actual no lo mueve", ok);
+
+	// Un id que no esta, dos bloques antes: queda en el anterior a el.
+	size_t i = 3 * POSTEOS_POR_BLOQUE + 40;
+	ok = posteos_cursor_buscar(cursor, id_de(i) - 1) && posteos_cursor_ver_actual(cursor) == id_de(i - 1);
+	print_test("Prueba buscar un id que no esta saltea bloques", ok);
+
+	// El primero de un bloque y el ultimo del anterior.
+	i = 2 * POSTEOS_POR_BLOQUE;
+	ok = posteos_cursor_buscar(cursor, id_de(i)) && posteos_cursor_ver_actual(cursor) == id_de(i);
+	print_test("Prueba buscar el primero de un bloque", ok);
+	ok = posteos_cursor_buscar(cursor, id_de(i) - 1) && posteos_cursor_ver_actual(cursor) == id_de(i - 1);
+	print_test("Prueba buscar el ultimo del bloque anterior", ok);
+
+	// Despues de buscar se sigue avanzando normalmente entre bloques.
+	posteos_cursor_avanzar(cursor);
+	ok = posteos_cursor_ver_actual(cursor) == id_de(i - 2);
+	print_test("Prueba avanzar despues de buscar", ok);
+
+	// Un id menor al primero deja al cursor al final.
+	ok = !posteos_cursor_buscar(cursor, id_de(0) - 1) && posteos_cursor_al_final(cursor);
+	print_test("Prueba buscar antes del primer id deja al final", ok);
+	print_test("Prueba buscar con el cursor al final devuelve false", !posteos_cursor_buscar(cursor, id_de(ultimo)));
+	posteos_cursor_destruir(cursor);
+
+	// Todos los ids, y los que estan entre ellos, desde un cursor nuevo.
+	ok = true;
+	for (size_t j = 1; ok && j < cantidad; j++)
+	{
+		posteos_cursor_t* nuevo = posteos_cursor_crear(posteos);
+		ok = nuevo && posteos_cursor_buscar(nuevo, id_de(j) - 1) && posteos_cursor_ver_actual(nuevo) == id_de(j - 1);
+		ok = ok && posteos_cursor_buscar(nuevo, id_de(j - 1)) && posteos_cursor_ver_actual(nuevo) == id_de(j - 1);
+		if (nuevo) posteos_cursor_destruir(nuevo);
+	}
+	print_test("Prueba buscar cada id desde un cursor nuevo", ok);
+	posteos_destruir(posteos);
+}
+
+int main(void)
+{
+	pruebas_posteos_vacio();
+	pruebas_posteos_bordes_de_bloque();
+	pruebas_posteos_repetidos();
+	pruebas_posteos_buscar();
+	return 0;
+}
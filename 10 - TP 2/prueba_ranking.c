@@ -0,0 +1,119 @@
+#include "ranking.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/*******************************************************************
+ *                        AUXILIARES                               *
+ ******************************************************************/
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+// Devuelve true si el ranking tiene exactamente los ids esperados, en ese
+// orden.
+bool orden_es(const ranking_t* ranking, const size_t* esperados, size_t cantidad)
+{
+	if (ranking_cantidad(ranking) != cantidad) return false;
+	const ranking_ref_t* ref = ranking_primero(ranking);
+	for (size_t i = 0; i < cantidad; i++, ref = ranking_siguiente(ref))
+		if (!ref || ranking_ref_id(ref) != esperados[i]) return false;
+	return ref == NULL;
+}
+
+/*******************************************************************
+ *                        PRUEBAS UNITARIAS                        *
+ ******************************************************************/
+
+void pruebas_ranking_vacio()
+{
+	ranking_t* ranking = ranking_crear();
+	print_test("Prueba crear ranking", ranking != NULL);
+	print_test("Prueba ranking vacio tiene cantidad 0", ranking_cantidad(ranking) == 0);
+	print_test("Prueba ranking vacio no tiene primero", ranking_primero(ranking) == NULL);
+	ranking_destruir(ranking);
+}
+
+void pruebas_ranking_orden_de_llegada()
+{
+	ranking_t* ranking = ranking_crear();
+	ranking_ref_t* refs[3];
+	bool ok = true;
+	for (size_t i = 0; i < 3; i++)
+		ok &= (refs[i] = ranking_agregar(ranking, i)) != NULL;
+	print_test("Prueba agregar 3 ids", ok);
+	size_t agregados[] = {0, 1, 2};
+	print_test("Prueba con cuenta 1 quedan en orden de llegada", orden_es(ranking, agregados, 3));
+
+	// El caso de la revision: 0, 1 y 2 llegan a 2 en ese orden, y despues
+	// 2 llega a 3. 0 llego a 2 antes que 1, asi que queda antes.
+	ok = true;
+	for (size_t i = 0; i < 3; i++)
+		ok &= ranking_incrementar(ranking, refs[i]);
+	size_t todos_en_dos[] = {0, 1, 2};
+	print_test("Prueba incrementar los 3 mantiene el orden", ok && orden_es(ranking, todos_en_dos, 3));
+	print_test("Prueba incrementar el ultimo", ranking_incrementar(ranking, refs[2]));
+	size_t esperados[] = {2, 0, 1};
+	print_test("Prueba a igual cuenta queda primero el que llego antes", orden_es(ranking, esperados, 3));
+	ranking_destruir(ranking);
+}
+
+void pruebas_ranking_llegar_despues()
+{
+	ranking_t* ranking = ranking_crear();
+	ranking_ref_t* refs[4];
+	for (size_t i = 0; i < 4; i++)
+		refs[i] = ranking_agregar(ranking, i);
+
+	// 3 llega a 2 antes que 1: 1 tiene que quedar detras de 3 aunque se
+	// agrego antes.
+	ranking_incrementar(ranking, refs[3]);
+	ranking_incrementar(ranking, refs[1]);
+	size_t esperados[] = {3, 1, 0, 2};
+	print_test("Prueba el que sube queda ultimo de su nueva cuenta", orden_es(ranking, esperados, 4));
+
+	// 1 llega primero a 3; despues 3 lo alcanza y queda detras.
+	ranking_incrementar(ranking, refs[1]);
+	ranking_incrementar(ranking, refs[3]);
+	size_t alcanzado[] = {1, 3, 0, 2};
+	print_test("Prueba el que alcanza una cuenta queda detras", orden_es(ranking, alcanzado, 4));
+
+	// Un id nuevo entra despues de todos los de cuenta 1.
+	ranking_agregar(ranking, 4);
+	size_t con_nuevo[] = {1, 3, 0, 2, 4};
+	print_test("Prueba agregar entra al final de cuenta 1", orden_es(ranking, con_nuevo, 5));
+	ranking_destruir(ranking);
+}
+
+void pruebas_ranking_volumen()
+{
+	// Cada id i recibe i incrementos: el orden final es de mayor a menor id.
+	const size_t cantidad = 500;
+	ranking_t* ranking = ranking_crear();
+	ranking_ref_t** refs = malloc(cantidad * sizeof(ranking_ref_t*));
+	bool ok = refs != NULL;
+	for (size_t i = 0; ok && i < cantidad; i++)
+		ok = (refs[i] = ranking_agregar(ranking, i)) != NULL;
+	for (size_t vuelta = 0; ok && vuelta < cantidad; vuelta++)
+		for (size_t i = vuelta + 1; ok && i < cantidad; i++)
+			ok = ranking_incrementar(ranking, refs[i]);
+
+	const ranking_ref_t* ref = ranking_primero(ranking);
+	for (size_t i = cantidad; ok && i > 0; i--, ref = ranking_siguiente(ref))
+		ok = ref && ranking_ref_id(ref) == i - 1;
+	print_test("Prueba volumen queda ordenado por cuenta", ok && ref == NULL);
+	free(refs);
+	ranking_destruir(ranking);
+}
+
+int main(void)
+{
+	pruebas_ranking_vacio();
+	pruebas_ranking_orden_de_llegada();
+	pruebas_ranking_llegar_despues();
+	pruebas_ranking_volumen();
+	return 0;
+}
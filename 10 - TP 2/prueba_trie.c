@@ -0,0 +1,291 @@
+#include "trie.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+/*******************************************************************
+ *                        AUXILIARES                               *
+ ******************************************************************/
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+// Devuelve true si completar prefijo da exactamente las claves esperadas,
+// en ese orden.
+bool completa(const trie_t* trie, const char* prefijo, const char** esperadas, size_t cantidad)
+{
+	trie_sugerencia_t sugerencias[TRIE_TOP];
+	if (trie_completar(trie, prefijo, TRIE_TOP, sugerencias) != cantidad) return false;
+	for (size_t i = 0; i < cantidad; i++)
+		if (strcmp(sugerencias[i].clave, esperadas[i]) != 0) return false;
+	return true;
+}
+
+// Agrega la clave e incrementa su frecuencia veces veces, con marcas que
+// siguen a *marca.
+bool sumar(trie_t* trie, const char* clave, size_t veces, size_t* marca)
+{
+	trie_nodo_t* nodo = trie_agregar(trie, clave, strlen(clave));
+	if (!nodo) return false;
+	for (size_t i = 0; i < veces; i++)
+		if (!trie_incrementar(nodo, ++*marca)) return false;
+	return true;
+}
+
+// Una clave del modelo de la prueba de volumen.
+typedef struct modelo
+{
+	char clave[8];
+	trie_nodo_t* nodo;
+	size_t frecuencia;
+	size_t marca;
+} modelo_t;
+
+// Devuelve true si a va antes que b en un top: mayor frecuencia, o igual
+// frecuencia y llego antes a ella.
+bool va_antes(const modelo_t* a, const modelo_t* b)
+{
+	if (a->frecuencia != b->frecuencia) return a->frecuencia > b->frecuencia;
+	return a->marca < b->marca;
+}
+
+// Devuelve true si completar prefijo coincide con calcularlo recorriendo
+// todas las claves del modelo.
+bool coincide_con_modelo(const trie_t* trie, const modelo_t* claves, size_t cant_claves, const char* prefijo)
+{
+	const modelo_t* esperadas[TRIE_TOP];
+	size_t cantidad = 0;
+	size_t largo = strlen(prefijo);
+	for (size_t i = 0; i < cant_claves; i++)
+	{
+		const modelo_t* clave = &claves[i];
+		if (clave->frecuencia == 0 || strncmp(clave->clave, prefijo, largo) != 0) continue;
+		// Insercion ordenada en las hasta TRIE_TOP mejores.
+		size_t j = cantidad < TRIE_TOP ? cantidad++ : TRIE_TOP;
+		for (; j > 0 && va_antes(clave, esperadas[j - 1]); j--)
+			if (j < TRIE_TOP) esperadas[j] = esperadas[j - 1];
+		if (j < TRIE_TOP) esperadas[j] = clave;
+	}
+
+	trie_sugerencia_t sugerencias[TRIE_TOP];
+	if (trie_completar(trie, prefijo, TRIE_TOP, sugerencias) != cantidad) return false;
+	for (size_t i = 0; i < cantidad; i++)
+	{
+		if (strcmp(sugerencias[i].clave, esperadas[i]->clave) != 0) return false;
+		if (sugerencias[i].frecuencia != esperadas[i]->frecuencia) return false;
+		if (sugerencias[i].marca != esperadas[i]->marca) return false;
+	}
+	return true;
+}
+
+/*******************************************************************
+ *                        PRUEBAS UNITARIAS                        *
+ ******************************************************************/
+
+void pruebas_trie_vacio()
+{
+	trie_t* trie = trie_crear();
+	print_test("Prueba crear trie", trie != NULL);
+	print_test("Prueba completar en trie vacio", completa(trie, "", NULL, 0) && completa(trie, "a", NULL, 0));
+	print_test("Prueba agregar sin incrementar", trie_agregar(trie, "hola", 4) != NULL);
+	print_test("Prueba las claves con frecuencia 0 no se completan", completa(trie, "ho", NULL, 0));
+	trie_destruir(trie);
+}
+
+void pruebas_trie_partir()
+{
+	trie_t* trie = trie_crear();
+	size_t marca = 0;
+	bool ok = sumar(trie, "romano", 3, &marca);
+	// Parte la arista "romano" en "roman" + "o", y despues "roman" en
+	// "rom" + "an" con una clave que termina en el corte.
+	ok &= sumar(trie, "romance", 2, &marca);
+	ok &= sumar(trie, "rom", 1, &marca);
+	print_test("Prueba agregar claves que parten aristas", ok);
+
+	const char* todas[] = {"romano", "romance", "rom"};
+	print_test("Prueba completar la raiz", completa(trie, "", todas, 3));
+	print_test("Prueba completar un prefijo que termina en un corte", completa(trie, "rom", todas, 3));
+	print_test("Prueba completar un prefijo en el medio de una arista", completa(trie, "roma", todas, 2));
+	print_test("Prueba completar un prefijo de la ultima arista", completa(trie, "romanc", todas + 1, 1));
+	print_test("Prueba completar una clave entera", completa(trie, "romano", todas, 1));
+	print_test("Prueba completar un prefijo que se sale de una arista", completa(trie, "romanx", NULL, 0) && completa(trie, "romanos", NULL, 0));
+	print_test("Prueba completar un prefijo sin arista", completa(trie, "x", NULL, 0));
+
+	// El nodo del medio hereda el top: una clave que ya estaba sigue
+	// estando despues de partir y de subir.
+	ok = sumar(trie, "romanza", 0, &marca) && sumar(trie, "romance", 2, &marca);
+	const char* despues[] = {"romance", "romano", "rom"};
+	print_test("Prueba el top sigue bien despues de partir", ok && completa(trie, "", despues, 3) && completa(trie, "roman", despues, 2));
+	trie_destruir(trie);
+}
+
+void pruebas_trie_prefijos()
+{
+	trie_t* trie = trie_crear();
+	size_t marca = 0;
+	// Cada clave es prefijo de la siguiente, y se agregan en los dos ordenes.
+	bool ok = sumar(trie, "a", 1, &marca) && sumar(trie, "abc", 3, &marca);
+	ok &= sumar(trie, "abcde", 2, &marca) && sumar(trie, "ab", 4, &marca);
+	print_test("Prueba agregar claves que son prefijo de otras", ok);
+	trie_nodo_t* otra_vez = trie_agregar(trie, "abcxyz", 3);
+	print_test("Prueba agregar una clave que ya estaba devuelve su nodo", otra_vez == trie_agregar(trie, "abc", 3));
+
+	const char* esperadas[] = {"ab", "abc", "abcde", "a"};
+	print_test("Prueba completar con prefijos de otras claves", completa(trie, "a", esperadas, 4));
+	print_test("Prueba completar desde una clave que es prefijo", completa(trie, "ab", esperadas, 3) && completa(trie, "abc", esperadas + 1, 2));
+	trie_sugerencia_t sugerencias[2];
+	print_test("Prueba completar pide menos que el top", trie_completar(trie, "a", 2, sugerencias) == 2 && strcmp(sugerencias[1].clave, "abc") == 0);
+	trie_destruir(trie);
+}
+
+void pruebas_trie_empates()
+{
+	trie_t* trie = trie_crear();
+	size_t marca = 0;
+	// A igual frecuencia va primero la que llego antes a ella.
+	bool ok = sumar(trie, "bb", 1, &marca) && sumar(trie, "ba", 1, &marca) && sumar(trie, "bc", 1, &marca);
+	const char* llegada[] = {"bb", "ba", "bc"};
+	print_test("Prueba empate en orden de llegada", ok && completa(trie, "b", llegada, 3));
+
+	ok = sumar(trie, "bc", 1, &marca) && sumar(trie, "bb", 1, &marca);
+	const char* subieron[] = {"bc", "bb", "ba"};
+	print_test("Prueba la que llega despues a una frecuencia queda detras", ok && completa(trie, "b", subieron, 3));
+
+	// Con el top lleno, una clave que empata con la ultima no entra.
+	ok = sumar(trie, "ba", 1, &marca);
+	char clave[] = "b?";
+	for (char c = 'd'; c < 'k'; c++)
+	{
+		clave[1] = c;
+		ok &= sumar(trie, clave, 2, &marca);
+	}
+	ok &= sumar(trie, "bz", 2, &marca);
+	trie_sugerencia_t sugerencias[TRIE_TOP];
+	size_t cantidad = trie_completar(trie, "b", TRIE_TOP, sugerencias);
+	print_test("Prueba una clave que empata con la ultima no entra al top lleno", ok && cantidad == TRIE_TOP && strcmp(sugerencias[TRIE_TOP - 1].clave, "bj") == 0);
+	ok = sumar(trie, "bz", 1, &marca);
+	cantidad = trie_completar(trie, "b", TRIE_TOP, sugerencias);
+	print_test("Prueba una clave que supera a la ultima entra al top lleno", ok && cantidad == TRIE_TOP && strcmp(sugerencias[0].clave, "bz") == 0 && strcmp(sugerencias[TRIE_TOP - 1].clave, "bi") == 0);
+	trie_destruir(trie);
+}
+
+void pruebas_trie_tops_anidados()
+{
+	trie_t* trie = trie_crear();
+	size_t marca = 0;
+	// "x" llena su top con x0..x9 (frecuencia 3) y tiene una clave mas, x_,
+	// con frecuencia 1. "y" tiene una sola clave, con frecuencia 2.
+	bool ok = true;
+	char clave[] = "x?";
+	for (char c = '0'; c <= '9'; c++)
+	{
+		clave[1] = c;
+		ok &= sumar(trie, clave, 3, &marca);
+	}
+	ok &= sumar(trie, "x_", 1, &marca) && sumar(trie, "y", 2, &marca);
+	print_test("Prueba agregar claves a dos subarboles", ok);
+
+	trie_sugerencia_t sugerencias[TRIE_TOP];
+	trie_completar(trie, "x", TRIE_TOP, sugerencias);
+	bool esta = false;
+	for (size_t i = 0; i < TRIE_TOP; i++)
+		esta |= strcmp(sugerencias[i].clave, "x_") == 0;
+	print_test("Prueba la clave que no entra en el top de x no esta", !esta);
+
+	// x_ sube a 3: empata con la ultima de x, asi que no entra, y se corta
+	// la subida antes de llegar a la raiz, donde tampoco puede entrar.
+	ok = sumar(trie, "x_", 2, &marca);
+	trie_completar(trie, "", TRIE_TOP, sugerencias);
+	esta = false;
+	for (size_t i = 0; i < TRIE_TOP; i++)
+		esta |= strcmp(sugerencias[i].clave, "x_") == 0;
+	print_test("Prueba cortar la subida deja bien el top de la raiz", ok && !esta && strcmp(sugerencias[TRIE_TOP - 1].clave, "x9") == 0);
+
+	// x_ sube a 4: echa a x9 del top de x y tambien del de la raiz.
+	ok = sumar(trie, "x_", 1, &marca);
+	size_t cantidad = trie_completar(trie, "x", TRIE_TOP, sugerencias);
+	ok &= cantidad == TRIE_TOP && strcmp(sugerencias[0].clave, "x_") == 0 && strcmp(sugerencias[TRIE_TOP - 1].clave, "x8") == 0;
+	print_test("Prueba una clave que sube echa a la ultima del top", ok);
+	cantidad = trie_completar(trie, "", TRIE_TOP, sugerencias);
+	ok = cantidad == TRIE_TOP && strcmp(sugerencias[0].clave, "x_") == 0 && strcmp(sugerencias[TRIE_TOP - 1].clave, "x8") == 0;
+	print_test("Prueba la raiz echa a la misma clave", ok);
+
+	// x9 salio del top de x pero sigue en el de su propio nodo, y al subir
+	// vuelve a entrar en los de sus ancestros.
+	const char* sola[] = {"x9"};
+	print_test("Prueba la clave echada sigue en su propio top", completa(trie, "x9", sola, 1));
+	ok = sumar(trie, "x9", 2, &marca);
+	trie_completar(trie, "", TRIE_TOP, sugerencias);
+	print_test("Prueba la clave echada vuelve a entrar al subir", ok && strcmp(sugerencias[0].clave, "x9") == 0);
+	const char* y[] = {"y"};
+	print_test("Prueba el otro subarbol no se ve afectado", completa(trie, "y", y, 1));
+	trie_destruir(trie);
+}
+
+void pruebas_trie_volumen()
+{
+	// Todas las claves de 1 a 4 letras de {a, b, c}, incrementadas al azar
+	// y comparadas con el modelo en todos los prefijos.
+	modelo_t claves[3 + 9 + 27 + 81];
+	size_t cant_claves = 0;
+	for (size_t largo = 1; largo <= 4; largo++)
+	{
+		size_t total = 1;
+		for (size_t i = 0; i < largo; i++) total *= 3;
+		for (size_t n = 0; n < total; n++)
+		{
+			modelo_t* clave = &claves[cant_claves++];
+			for (size_t i = 0, resto = n; i < largo; i++, resto /= 3)
+				clave->clave[i] = (char)('a' + resto % 3);
+			clave->clave[largo] = '\0';
+			clave->frecuencia = 0;
+			clave->marca = 0;
+		}
+	}
+
+	trie_t* trie = trie_crear();
+	bool ok = trie != NULL;
+	// Se agregan en un orden mezclado para que las aristas se partan.
+	for (size_t i = 0; ok && i < cant_claves; i++)
+	{
+		modelo_t* clave = &claves[(i * 37) % cant_claves];
+		ok = (clave->nodo = trie_agregar(trie, clave->clave, strlen(clave->clave))) != NULL;
+	}
+	print_test("Prueba volumen agregar claves", ok);
+
+	srand(7);
+	size_t marca = 0;
+	for (size_t paso = 0; ok && paso < 3000; paso++)
+	{
+		// Sesgado hacia las primeras, para que haya tops llenos y claves
+		// que entran y salen.
+		size_t i = (size_t)rand() % cant_claves;
+		if (rand() % 2) i %= 20;
+		modelo_t* clave = &claves[i];
+		ok = trie_incrementar(clave->nodo, ++marca);
+		clave->frecuencia++;
+		clave->marca = marca;
+		if (paso % 50 != 0) continue;
+		ok = ok && coincide_con_modelo(trie, claves, cant_claves, "");
+		for (size_t j = 0; ok && j < 3 + 9 + 27; j++)
+			ok = coincide_con_modelo(trie, claves, cant_claves, claves[j].clave);
+	}
+	print_test("Prueba volumen coincide con el modelo", ok);
+	trie_destruir(trie);
+}
+
+int main(void)
+{
+	pruebas_trie_vacio();
+	pruebas_trie_partir();
+	pruebas_trie_prefijos();
+	pruebas_trie_empates();
+	pruebas_trie_tops_anidados();
+	pruebas_trie_volumen();
+	return 0;
+}
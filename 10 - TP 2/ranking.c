@@ -0,0 +1,201 @@
+#include <stdlib.h>
+#include "ranking.h"
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+typedef struct nivel nivel_t;
+
+// Un id, en la lista de su nivel.
+struct ranking_ref
+{
+	size_t id;
+	nivel_t* nivel;
+	ranking_ref_t* anterior;
+	ranking_ref_t* siguiente;
+};
+
+// Los ids con la misma cuenta, en orden de llegada. anterior es el nivel
+// de la cuenta mayor mas cercana, y siguiente el de la menor.
+struct nivel
+{
+	size_t cuenta;
+	ranking_ref_t* primero;
+	ranking_ref_t* ultimo;
+	nivel_t* anterior;
+	nivel_t* siguiente;
+};
+
+// primero es el nivel de mayor cuenta y ultimo el de menor. No hay niveles
+// vacios.
+struct ranking
+{
+	nivel_t* primero;
+	nivel_t* ultimo;
+	size_t cantidad;
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Crea un nivel vacio con la cuenta y lo pone antes de siguiente (al final
+// si siguiente es NULL).
+// Devuelve NULL en caso de error.
+static nivel_t* nivel_crear(ranking_t* ranking, size_t cuenta, nivel_t* siguiente)
+{
+	nivel_t* nivel = malloc(sizeof(nivel_t));
+	if (!nivel) return NULL;
+	nivel->cuenta = cuenta;
+	nivel->primero = NULL;
+	nivel->ultimo = NULL;
+	nivel->siguiente = siguiente;
+	nivel->anterior = siguiente ? siguiente->anterior : ranking->ultimo;
+	if (nivel->anterior) nivel->anterior->siguiente = nivel;
+	else ranking->primero = nivel;
+	if (siguiente) siguiente->anterior = nivel;
+	else ranking->ultimo = nivel;
+	return nivel;
+}
+
+// Saca al nivel del ranking y lo destruye.
+// Pre: el nivel esta vacio.
+static void nivel_destruir(ranking_t* ranking, nivel_t* nivel)
+{
+	if (nivel->anterior) nivel->anterior->siguiente = nivel->siguiente;
+	else ranking->primero = nivel->siguiente;
+	if (nivel->siguiente) nivel->siguiente->anterior = nivel->anterior;
+	else ranking->ultimo = nivel->anterior;
+	free(nivel);
+}
+
+// Pone la referencia al final del nivel.
+static void nivel_agregar(nivel_t* nivel, ranking_ref_t* ref)
+{
+	ref->nivel = nivel;
+	ref->anterior = nivel->ultimo;
+	ref->siguiente = NULL;
+	if (nivel->ultimo) nivel->ultimo->siguiente = ref;
+	else nivel->primero = ref;
+	nivel->ultimo = ref;
+}
+
+// Saca la referencia de su nivel.
+static void nivel_sacar(ranking_ref_t* ref)
+{
+	nivel_t* nivel = ref->nivel;
+	if (ref->anterior) ref->anterior->siguiente = ref->siguiente;
+	else nivel->primero = ref->siguiente;
+	if (ref->siguiente) ref->siguiente->anterior = ref->anterior;
+	else nivel->ultimo = ref->anterior;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Crea un ranking vacio.
+// Post: Devuelve el ranking o NULL en caso de error.
+ranking_t* ranking_crear(void)
+{
+	ranking_t* ranking = malloc(sizeof(ranking_t));
+	if (!ranking) return NULL;
+	ranking->primero = NULL;
+	ranking->ultimo = NULL;
+	ranking->cantidad = 0;
+	return ranking;
+}
+
+// Destruye el ranking y las referencias de sus ids.
+// Pre: el ranking fue creado.
+void ranking_destruir(ranking_t* ranking)
+{
+	nivel_t* nivel = ranking->primero;
+	while (nivel)
+	{
+		ranking_ref_t* ref = nivel->primero;
+		while (ref)
+		{
+			ranking_ref_t* siguiente = ref->siguiente;
+			free(ref);
+			ref = siguiente;
+		}
+		nivel_t* siguiente = nivel->siguiente;
+		free(nivel);
+		nivel = siguiente;
+	}
+	free(ranking);
+}
+
+// Agrega el id con cuenta 1, al final (despues de todos los que ya tenian
+// cuenta 1).
+// Pre: el ranking fue creado.
+// Post: Devuelve la referencia del id, o NULL en caso de error.
+ranking_ref_t* ranking_agregar(ranking_t* ranking, size_t id)
+{
+	ranking_ref_t* ref = malloc(sizeof(ranking_ref_t));
+	if (!ref) return NULL;
+	nivel_t* nivel = ranking->ultimo;
+	if (!nivel || nivel->cuenta != 1) nivel = nivel_crear(ranking, 1, NULL);
+	if (!nivel)
+	{
+		free(ref);
+		return NULL;
+	}
+	ref->id = id;
+	nivel_agregar(nivel, ref);
+	ranking->cantidad++;
+	return ref;
+}
+
+// Incrementa en 1 la cuenta del id de la referencia, que pasa a ser el
+// ultimo de los que tienen su nueva cuenta.
+// Pre: el ranking fue creado y la referencia es de uno de sus ids.
+// Post: Devuelve false en caso de error (y la cuenta no cambia).
+bool ranking_incrementar(ranking_t* ranking, ranking_ref_t* ref)
+{
+	nivel_t* actual = ref->nivel;
+	nivel_t* nuevo = actual->anterior;
+	if (!nuevo || nuevo->cuenta != actual->cuenta + 1)
+		nuevo = nivel_crear(ranking, actual->cuenta + 1, actual);
+	if (!nuevo) return false;
+
+	nivel_sacar(ref);
+	nivel_agregar(nuevo, ref);
+	if (!actual->primero) nivel_destruir(ranking, actual);
+	return true;
+}
+
+// Devuelve la cantidad de ids del ranking.
+// Pre: el ranking fue creado.
+size_t ranking_cantidad(const ranking_t* ranking)
+{
+	return ranking->cantidad;
+}
+
+// Devuelve la referencia del primer id (el de mayor cuenta), o NULL si
+// el ranking esta vacio.
+// Pre: el ranking fue creado.
+const ranking_ref_t* ranking_primero(const ranking_t* ranking)
+{
+	return ranking->primero ? ranking->primero->primero : NULL;
+}
+
+// Devuelve la referencia del id que sigue en el ranking, o NULL si es el
+// ultimo.
+// Pre: la referencia es de un id de un ranking.
+const ranking_ref_t* ranking_siguiente(const ranking_ref_t* ref)
+{
+	if (ref->siguiente) return ref->siguiente;
+	return ref->nivel->siguiente ? ref->nivel->siguiente->primero : NULL;
+}
+
+// Devuelve el id de la referencia.
+// Pre: la referencia es de un id de un ranking.
+size_t ranking_ref_id(const ranking_ref_t* ref)
+{
+	return ref->id;
+}
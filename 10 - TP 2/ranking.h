@@ -0,0 +1,67 @@
+#ifndef RANKING_H
+#define RANKING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* Un ranking mantiene ids ordenados por una cuenta (los favoritos de cada
+ * tweet) de mayor a menor, a medida que las cuentas suben de a 1. A igual
+ * cuenta queda primero el que llego antes a ella.
+ * Los ids con la misma cuenta forman un nivel: una lista en orden de
+ * llegada, a la que solo se agrega al final. Los niveles no vacios forman
+ * otra lista, de mayor a menor cuenta. Al incrementar, el id sale de su
+ * nivel y pasa al final del de la cuenta siguiente (que esta antes), asi
+ * que agregar e incrementar cuestan O(1).
+ * Cada id tiene una referencia, que lo identifica mientras este en el
+ * ranking y permite recorrerlo en orden. */
+
+typedef struct ranking ranking_t;
+typedef struct ranking_ref ranking_ref_t;
+
+/* ******************************************************************
+ *                   PRIMITIVAS DEL RANKING
+ * *****************************************************************/
+
+// Crea un ranking vacio.
+// Post: Devuelve el ranking o NULL en caso de error.
+ranking_t* ranking_crear(void);
+
+// Destruye el ranking y las referencias de sus ids.
+// Pre: el ranking fue creado.
+void ranking_destruir(ranking_t* ranking);
+
+// Agrega el id con cuenta 1, al final (despues de todos los que ya tenian
+// cuenta 1).
+// Pre: el ranking fue creado.
+// Post: Devuelve la referencia del id, o NULL en caso de error.
+ranking_ref_t* ranking_agregar(ranking_t* ranking, size_t id);
+
+// Incrementa en 1 la cuenta del id de la referencia, que pasa a ser el
+// ultimo de los que tienen su nueva cuenta.
+// Pre: el ranking fue creado y la referencia es de uno de sus ids.
+// Post: Devuelve false en caso de error (y la cuenta no cambia).
+bool ranking_incrementar(ranking_t* ranking, ranking_ref_t* ref);
+
+// Devuelve la cantidad de ids del ranking.
+// Pre: el ranking fue creado.
+size_t ranking_cantidad(const ranking_t* ranking);
+
+// Devuelve la referencia del primer id (el de mayor cuenta), o NULL si
+// el ranking esta vacio.
+// Pre: el ranking fue creado.
+const ranking_ref_t* ranking_primero(const ranking_t* ranking);
+
+// Devuelve la referencia del id que sigue en el ranking, o NULL si es el
+// ultimo.
+// Pre: la referencia es de un id de un ranking.
+const ranking_ref_t* ranking_siguiente(const ranking_ref_t* ref);
+
+// Devuelve el id de la referencia.
+// Pre: la referencia es de un id de un ranking.
+size_t ranking_ref_id(const ranking_ref_t* ref);
+
+#endif //RANKING_H
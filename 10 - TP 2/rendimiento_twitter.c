@@ -0,0 +1,201 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+/*******************************************************************
+ *            MEDICION DEL TP2 CON DISTINTOS FRAGMENTOS             *
+ ******************************************************************/
+
+/* Genera un guion sintetico de comandos y mide cuantos comandos por segundo
+ * ejecuta ./tp2 -h hilos, con las palabras repartidas en hilos fragmentos.
+ * Hay dos guiones: el mixto (mayormente twittear, y favoritos y busquedas
+ * de uno y de varios terminos) y el de busquedas repartidas, donde la
+ * mitad de los comandos son busquedas populares de muchos terminos unidos
+ * por '|', las unicas que se reparten entre los fragmentos. Ademas compara
+ * la salida de cada corrida con la de un solo hilo, que tiene que ser la
+ * misma. Con un solo nucleo los hilos no pueden ir mas rapido: para ver
+ * como escala hay que correrlo en una maquina con varios. */
+
+#define COMANDOS 200000
+#define USUARIOS 20000
+#define HASHTAGS 5000
+#define MAX_HILOS 64
+// Terminos de cada busqueda del guion de busquedas repartidas.
+#define MIN_TERMINOS_REPARTIDAS 4
+#define MAX_TERMINOS_REPARTIDAS 8
+
+static double segundos_desde(struct timespec* inicio)
+{
+	struct timespec fin;
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	return (fin.tv_sec - inicio->tv_sec) + (fin.tv_nsec - inicio->tv_nsec) / 1e9;
+}
+
+// Devuelve un hashtag al azar, con los de numero chico mucho mas usados
+// (como en un twitter de verdad).
+static int hashtag(void)
+{
+	int r = rand() % HASHTAGS + 1;
+	return rand() % r;
+}
+
+// Escribe un termino de busqueda al azar: un usuario o un hashtag.
+static void termino(FILE* archivo)
+{
+	if (rand() % 4 == 0)
+		fprintf(archivo, "@u%d", rand() % USUARIOS);
+	else
+		fprintf(archivo, "#h%d", hashtag());
+}
+
+// Escribe un tweet con 1 a 4 hashtags y alguna mencion.
+static void tweet(FILE* archivo)
+{
+	fprintf(archivo, "twittear @u%d hola", rand() % USUARIOS);
+	for (int j = rand() % 4; j >= 0; j--)
+		fprintf(archivo, " #h%d", hashtag());
+	if (rand() % 3 == 0) fprintf(archivo, " @u%d", rand() % USUARIOS);
+	fprintf(archivo, " chau\n");
+}
+
+// Escribe una busqueda popular de MIN_TERMINOS_REPARTIDAS a
+// MAX_TERMINOS_REPARTIDAS terminos unidos por '|'.
+static void busqueda_repartida(FILE* archivo)
+{
+	fprintf(archivo, "buscar ");
+	termino(archivo);
+	int terminos = MIN_TERMINOS_REPARTIDAS + rand() % (MAX_TERMINOS_REPARTIDAS - MIN_TERMINOS_REPARTIDAS + 1);
+	for (int j = 1; j < terminos; j++)
+	{
+		fputc('|', archivo);
+		termino(archivo);
+	}
+	fprintf(archivo, " popular %d\n", rand() % 20 + 1);
+}
+
+// Escribe el guion. El mixto tiene 60% tweets, 15% favoritos y 25%
+// busquedas, de las que la mitad tiene varios terminos. El de busquedas
+// repartidas tiene 40% tweets, 10% favoritos y 50% busquedas repartidas.
+static bool generar(const char* ruta, long comandos, bool repartidas)
+{
+	FILE* archivo = fopen(ruta, "w");
+	if (!archivo) return false;
+	srand(42);
+	long tweets = 0;
+	for (long i = 0; i < comandos; i++)
+	{
+		int r = rand() % 100;
+		if (r < (repartidas ? 40 : 60) || tweets == 0)
+		{
+			tweet(archivo);
+			tweets++;
+		}
+		else if (r < (repartidas ? 50 : 75))
+			fprintf(archivo, "favorito %ld\n", rand() % tweets);
+		else if (repartidas)
+			busqueda_repartida(archivo);
+		else
+		{
+			fprintf(archivo, "buscar ");
+			termino(archivo);
+			if (r >= 87)
+			{
+				char separador = rand() % 4 ? '|' : '&';
+				for (int j = rand() % 3; j >= 0; j--)
+				{
+					fputc(separador, archivo);
+					termino(archivo);
+				}
+			}
+			fprintf(archivo, " %s %d\n", rand() % 2 ? "popular" : "cronologico", rand() % 20 + 1);
+		}
+	}
+	return fclose(archivo) == 0;
+}
+
+// Corre ./tp2 -h hilos con el guion como entrada estandar, escribiendo en
+// salida, y devuelve los segundos que tardo, o -1 si fallo.
+static double correr(const char* ruta, const char* salida, int hilos)
+{
+	char cantidad[16];
+	snprintf(cantidad, sizeof(cantidad), "%d", hilos);
+	struct timespec inicio;
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	pid_t pid = fork();
+	if (pid < 0) return -1;
+	if (pid == 0)
+	{
+		int entrada = open(ruta, O_RDONLY);
+		int destino = open(salida, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+		dup2(entrada, STDIN_FILENO);
+		dup2(destino, STDOUT_FILENO);
+		execl("./tp2", "tp2", "-h", cantidad, (char*)NULL);
+		_exit(127);
+	}
+	int estado;
+	waitpid(pid, &estado, 0);
+	if (!WIFEXITED(estado) || WEXITSTATUS(estado) != 0) return -1;
+	return segundos_desde(&inicio);
+}
+
+// Devuelve true si los dos archivos tienen lo mismo.
+static bool iguales(const char* ruta_a, const char* ruta_b)
+{
+	FILE* a = fopen(ruta_a, "r");
+	FILE* b = fopen(ruta_b, "r");
+	bool iguales = a && b;
+	while (iguales)
+	{
+		int c = fgetc(a);
+		iguales = c == fgetc(b);
+		if (c == EOF) break;
+	}
+	if (a) fclose(a);
+	if (b) fclose(b);
+	return iguales;
+}
+
+/* Programa principal. Recibe opcionalmente la cantidad de comandos (por
+ * defecto COMANDOS, que alcanza para una prueba rapida; para medir en
+ * serio conviene pasarle millones), la maxima cantidad de hilos (se prueba
+ * con 1, 2, 4... hasta ella) y el guion: "mixto" (por defecto) o
+ * "repartidas". */
+int main(int argc, char** argv)
+{
+	long comandos = argc > 1 ? atol(argv[1]) : COMANDOS;
+	int max_hilos = argc > 2 ? atoi(argv[2]) : 8;
+	bool repartidas = argc > 3 && strcmp(argv[3], "repartidas") == 0;
+	if (comandos < 1 || max_hilos < 1 || max_hilos > MAX_HILOS) return 1;
+	if (argc > 3 && !repartidas && strcmp(argv[3], "mixto") != 0) return 1;
+
+	char ruta[] = "/tmp/rendimiento_twitterXXXXXX";
+	char primera[] = "/tmp/rendimiento_twitterXXXXXX";
+	char salida[] = "/tmp/rendimiento_twitterXXXXXX";
+	int fds[] = {mkstemp(ruta), mkstemp(primera), mkstemp(salida)};
+	for (int i = 0; i < 3; i++)
+		if (fds[i] >= 0) close(fds[i]);
+	if (fds[0] < 0 || fds[1] < 0 || fds[2] < 0) return 1;
+
+	printf("generando %ld comandos (%s)...\n", comandos, repartidas ? "repartidas" : "mixto");
+	bool ok = generar(ruta, comandos, repartidas);
+	if (ok) printf("%-8s %10s %14s %8s\n", "hilos", "s", "comandos/s", "salida");
+	for (int hilos = 1; ok && hilos <= max_hilos; hilos *= 2)
+	{
+		double s = correr(ruta, hilos == 1 ? primera : salida, hilos);
+		if (s < 0)
+			printf("%-8d %10s\n", hilos, "fallo");
+		else
+			printf("%-8d %10.2f %14.0f %8s\n", hilos, s, comandos / s,
+				hilos == 1 || iguales(primera, salida) ? "igual" : "DISTINTA");
+	}
+	unlink(ruta);
+	unlink(primera);
+	unlink(salida);
+	return ok ? 0 : 1;
+}
@@ -0,0 +1,230 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "repartidor.h"
+#include "canal.h"
+
+#define CAMBIOS_POR_PAQUETE 512
+// Paquetes que puede tener cada hilo sin aplicar antes de que el que envia
+// tenga que esperarlo.
+#define PAQUETES_EN_VUELO 16
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+typedef struct paquete
+{
+	size_t cantidad;
+	cambio_t cambios[CAMBIOS_POR_PAQUETE];
+} paquete_t;
+
+// llenos va del que envia al hilo, y vacios vuelve. actual es el paquete
+// que se esta llenando y afuera cuantos se enviaron y no volvieron. libres
+// tiene los que volvieron al esperar, para no pedir memoria otra vez:
+// nunca hay mas de PAQUETES_EN_VUELO + 1 paquetes. error lo escribe el
+// hilo, con operaciones atomicas.
+typedef struct trabajador
+{
+	fragmento_t* fragmento;
+	pthread_t hilo;
+	canal_t* llenos;
+	canal_t* vacios;
+	paquete_t* actual;
+	size_t afuera;
+	paquete_t* libres[PAQUETES_EN_VUELO + 1];
+	size_t cant_libres;
+	bool error;
+} trabajador_t;
+
+struct repartidor
+{
+	trabajador_t* trabajadores;
+	size_t cantidad;
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Funcion del hilo de cada fragmento: aplica los paquetes que le llegan
+// hasta que se cierra el canal.
+static void* trabajar(void* dato)
+{
+	trabajador_t* trabajador = dato;
+	paquete_t* paquete;
+	while ((paquete = canal_recibir(trabajador->llenos)))
+	{
+		for (size_t i = 0; i < paquete->cantidad; i++)
+			if (!fragmento_aplicar(trabajador->fragmento, &paquete->cambios[i]))
+				__atomic_store_n(&trabajador->error, true, __ATOMIC_RELAXED);
+		paquete->cantidad = 0;
+		canal_enviar(trabajador->vacios, paquete);
+	}
+	return NULL;
+}
+
+// Manda el paquete actual al hilo, si tiene algo.
+// Post: Devuelve false en caso de error.
+static bool enviar_actual(trabajador_t* trabajador)
+{
+	if (!trabajador->actual || trabajador->actual->cantidad == 0) return true;
+	if (!canal_enviar(trabajador->llenos, trabajador->actual)) return false;
+	trabajador->actual = NULL;
+	trabajador->afuera++;
+	return true;
+}
+
+// Consigue un paquete vacio para llenar: uno libre o que volvio si hay,
+// uno nuevo si no, y si hay demasiados afuera espera a que vuelva alguno.
+// Post: Devuelve false en caso de error.
+static bool tomar_paquete(trabajador_t* trabajador)
+{
+	paquete_t* paquete = NULL;
+	if (trabajador->afuera >= PAQUETES_EN_VUELO)
+		paquete = canal_recibir(trabajador->vacios);
+	else if (trabajador->cant_libres > 0)
+	{
+		trabajador->actual = trabajador->libres[--trabajador->cant_libres];
+		return true;
+	}
+	else if (trabajador->afuera > 0)
+		paquete = canal_intentar_recibir(trabajador->vacios);
+	if (paquete) trabajador->afuera--;
+	else
+	{
+		paquete = malloc(sizeof(paquete_t));
+		if (!paquete) return false;
+		paquete->cantidad = 0;
+	}
+	trabajador->actual = paquete;
+	return true;
+}
+
+// Manda lo que queda y espera a que vuelvan todos los paquetes, que
+// quedan libres.
+// Post: Devuelve false si fallo algun cambio.
+static bool vaciar(trabajador_t* trabajador)
+{
+	bool ok = enviar_actual(trabajador);
+	for (; trabajador->afuera > 0; trabajador->afuera--)
+		trabajador->libres[trabajador->cant_libres++] = canal_recibir(trabajador->vacios);
+	return ok && !__atomic_load_n(&trabajador->error, __ATOMIC_RELAXED);
+}
+
+// Termina el hilo del trabajador y libera sus canales.
+static void trabajador_terminar(trabajador_t* trabajador)
+{
+	vaciar(trabajador);
+	canal_cerrar(trabajador->llenos);
+	pthread_join(trabajador->hilo, NULL);
+	canal_destruir(trabajador->llenos, free);
+	canal_destruir(trabajador->vacios, free);
+	free(trabajador->actual);
+	while (trabajador->cant_libres > 0)
+		free(trabajador->libres[--trabajador->cant_libres]);
+}
+
+// Crea los canales y el hilo del trabajador.
+// Post: Devuelve false en caso de error.
+static bool trabajador_iniciar(trabajador_t* trabajador, fragmento_t* fragmento)
+{
+	trabajador->fragmento = fragmento;
+	trabajador->actual = NULL;
+	trabajador->afuera = 0;
+	trabajador->cant_libres = 0;
+	trabajador->error = false;
+	trabajador->llenos = canal_crear(PAQUETES_EN_VUELO);
+	trabajador->vacios = canal_crear(PAQUETES_EN_VUELO);
+	if (!trabajador->llenos || !trabajador->vacios ||
+		pthread_create(&trabajador->hilo, NULL, trabajar, trabajador) != 0)
+	{
+		if (trabajador->llenos) canal_destruir(trabajador->llenos, NULL);
+		if (trabajador->vacios) canal_destruir(trabajador->vacios, NULL);
+		return false;
+	}
+	return true;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Crea un repartidor con un hilo para cada uno de los cantidad fragmentos.
+// Los fragmentos no pasan a ser del repartidor.
+// Post: Devuelve el repartidor o NULL en caso de error.
+repartidor_t* repartidor_crear(fragmento_t** fragmentos, size_t cantidad)
+{
+	repartidor_t* repartidor = malloc(sizeof(repartidor_t));
+	trabajador_t* trabajadores = malloc(cantidad * sizeof(trabajador_t));
+	if (!repartidor || !trabajadores)
+	{
+		free(repartidor);
+		free(trabajadores);
+		return NULL;
+	}
+	repartidor->trabajadores = trabajadores;
+	for (repartidor->cantidad = 0; repartidor->cantidad < cantidad; repartidor->cantidad++)
+		if (!trabajador_iniciar(&trabajadores[repartidor->cantidad], fragmentos[repartidor->cantidad]))
+		{
+			repartidor_destruir(repartidor);
+			return NULL;
+		}
+	return repartidor;
+}
+
+// Espera a que se apliquen los cambios enviados, termina los hilos y
+// destruye el repartidor.
+// Pre: el repartidor fue creado.
+void repartidor_destruir(repartidor_t* repartidor)
+{
+	for (size_t i = 0; i < repartidor->cantidad; i++)
+		trabajador_terminar(&repartidor->trabajadores[i]);
+	free(repartidor->trabajadores);
+	free(repartidor);
+}
+
+// Envia el cambio al hilo del fragmento numero fragmento. Puede que no se
+// aplique hasta el proximo repartidor_esperar. Lo que apunta el cambio
+// tiene que seguir valiendo hasta entonces.
+// Pre: el repartidor fue creado. fragmento es menor a la cantidad.
+// Post: Devuelve false en caso de error.
+bool repartidor_enviar(repartidor_t* repartidor, size_t fragmento, const cambio_t* cambio)
+{
+	trabajador_t* trabajador = &repartidor->trabajadores[fragmento];
+	if (!trabajador->actual && !tomar_paquete(trabajador)) return false;
+
+	paquete_t* paquete = trabajador->actual;
+	paquete->cambios[paquete->cantidad++] = *cambio;
+	if (paquete->cantidad == CAMBIOS_POR_PAQUETE) return enviar_actual(trabajador);
+	return true;
+}
+
+// Espera a que el hilo del fragmento numero fragmento aplique los cambios
+// que se le enviaron, sin esperar a los demas. Mientras no se le envie
+// otro, ese fragmento se puede leer desde cualquier hilo.
+// Pre: el repartidor fue creado. fragmento es menor a la cantidad.
+// Post: Devuelve false si fallo algun cambio del fragmento.
+bool repartidor_esperar_fragmento(repartidor_t* repartidor, size_t fragmento)
+{
+	return vaciar(&repartidor->trabajadores[fragmento]);
+}
+
+// Espera a que los hilos apliquen todos los cambios enviados. Mientras no
+// se envie otro, los fragmentos se pueden leer desde cualquier hilo.
+// Pre: el repartidor fue creado.
+// Post: Devuelve false si fallo algun cambio.
+bool repartidor_esperar(repartidor_t* repartidor)
+{
+	// Primero se mandan todos los paquetes a medio llenar, asi los hilos
+	// trabajan a la vez mientras se espera al primero.
+	bool ok = true;
+	for (size_t i = 0; i < repartidor->cantidad; i++)
+		ok &= enviar_actual(&repartidor->trabajadores[i]);
+	for (size_t i = 0; i < repartidor->cantidad; i++)
+		ok &= vaciar(&repartidor->trabajadores[i]);
+	return ok;
+}
@@ -0,0 +1,56 @@
+#ifndef REPARTIDOR_H
+#define REPARTIDOR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "fragmento.h"
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* El repartidor aplica los cambios de cada fragmento en un hilo propio del
+ * fragmento. Los cambios se juntan en paquetes, que van al hilo por un
+ * canal y vuelven vacios por otro para volver a usarse, tambien despues de
+ * esperar. Cada fragmento recibe sus cambios en el orden en que se
+ * enviaron, asi que termina igual que si se los hubiera aplicado un solo
+ * hilo. Un solo hilo envia. Se puede esperar a todos los hilos o solo al
+ * de un fragmento, si solo se va a leer ese. */
+
+typedef struct repartidor repartidor_t;
+
+/* ******************************************************************
+ *                  PRIMITIVAS DEL REPARTIDOR
+ * *****************************************************************/
+
+// Crea un repartidor con un hilo para cada uno de los cantidad fragmentos.
+// Los fragmentos no pasan a ser del repartidor.
+// Post: Devuelve el repartidor o NULL en caso de error.
+repartidor_t* repartidor_crear(fragmento_t** fragmentos, size_t cantidad);
+
+// Espera a que se apliquen los cambios enviados, termina los hilos y
+// destruye el repartidor.
+// Pre: el repartidor fue creado.
+void repartidor_destruir(repartidor_t* repartidor);
+
+// Envia el cambio al hilo del fragmento numero fragmento. Puede que no se
+// aplique hasta el proximo repartidor_esperar. Lo que apunta el cambio
+// tiene que seguir valiendo hasta entonces.
+// Pre: el repartidor fue creado. fragmento es menor a la cantidad.
+// Post: Devuelve false en caso de error.
+bool repartidor_enviar(repartidor_t* repartidor, size_t fragmento, const cambio_t* cambio);
+
+// Espera a que el hilo del fragmento numero fragmento aplique los cambios
+// que se le enviaron, sin esperar a los demas. Mientras no se le envie
+// otro, ese fragmento se puede leer desde cualquier hilo.
+// Pre: el repartidor fue creado. fragmento es menor a la cantidad.
+// Post: Devuelve false si fallo algun cambio del fragmento.
+bool repartidor_esperar_fragmento(repartidor_t* repartidor, size_t fragmento);
+
+// Espera a que los hilos apliquen todos los cambios enviados. Mientras no
+// se envie otro, los fragmentos se pueden leer desde cualquier hilo.
+// Pre: el repartidor fue creado.
+// Post: Devuelve false si fallo algun cambio.
+bool repartidor_esperar(repartidor_t* repartidor);
+
+#endif //REPARTIDOR_H
@@ -0,0 +1,224 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include "salida.h"
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+// Una salida en memoria tiene fd -1, y su buffer crece en lugar de
+// vaciarse. error dice si no pudo crecer y perdio datos.
+struct salida
+{
+	int fd;
+	bool interactiva;
+	bool error;
+	size_t usado;
+	size_t tam;
+	char* buffer;
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Escribe los cant tramos de partes con writev, reintentando hasta que
+// salgan enteros.
+// Post: Devuelve false si hubo un error al escribir.
+static bool escribir_tramos(int fd, struct iovec* partes, int cant)
+{
+	while (cant > 0)
+	{
+		ssize_t escritos = writev(fd, partes, cant);
+		if (escritos < 0 && errno == EINTR) continue;
+		if (escritos <= 0) return false;
+
+		// Se saltean los tramos que salieron enteros y se recorta el
+		// que salio a medias.
+		size_t resto = (size_t)escritos;
+		while (cant > 0 && resto >= partes->iov_len)
+		{
+			resto -= partes->iov_len;
+			partes++;
+			cant--;
+		}
+		if (cant > 0)
+		{
+			partes->iov_base = (char*)partes->iov_base + resto;
+			partes->iov_len -= resto;
+		}
+	}
+	return true;
+}
+
+// Agranda el buffer de una salida en memoria para que entren largo bytes
+// mas.
+// Post: Devuelve false (y marca el error) si no hay memoria.
+static bool agrandar(salida_t* salida, size_t largo)
+{
+	size_t tam = salida->tam;
+	while (tam - salida->usado < largo) tam *= 2;
+	char* buffer = realloc(salida->buffer, tam);
+	if (!buffer)
+	{
+		salida->error = true;
+		return false;
+	}
+	salida->buffer = buffer;
+	salida->tam = tam;
+	return true;
+}
+
+// Crea una salida con el buffer de tam bytes.
+static salida_t* crear(int fd, size_t tam, bool interactiva)
+{
+	if (tam == 0) tam = 1;
+	salida_t* salida = malloc(sizeof(salida_t));
+	char* buffer = malloc(tam);
+	if (!salida || !buffer)
+	{
+		free(salida);
+		free(buffer);
+		return NULL;
+	}
+	salida->fd = fd;
+	salida->interactiva = interactiva;
+	salida->error = false;
+	salida->usado = 0;
+	salida->tam = tam;
+	salida->buffer = buffer;
+	return salida;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Crea una salida que escribe en el descriptor fd con un buffer de tam bytes.
+// Post: Devuelve la salida o NULL en caso de error.
+salida_t* salida_crear(int fd, size_t tam, bool interactiva)
+{
+	return crear(fd, tam, interactiva);
+}
+
+// Crea una salida que junta todo en memoria, empezando con un buffer de
+// tam bytes, hasta que se la vuelca en otra con salida_volcar.
+// Post: Devuelve la salida o NULL en caso de error.
+salida_t* salida_crear_en_memoria(size_t tam)
+{
+	return crear(-1, tam, false);
+}
+
+// Vacia la salida y la destruye. El descriptor no se cierra.
+// Pre: la salida fue creada.
+void salida_destruir(salida_t* salida)
+{
+	salida_vaciar(salida);
+	free(salida->buffer);
+	free(salida);
+}
+
+// Escribe todo lo que quedaba en el buffer.
+// Pre: la salida fue creada.
+// Post: Devuelve false si hubo un error al escribir.
+bool salida_vaciar(salida_t* salida)
+{
+	if (salida->fd < 0) return true; // en memoria se espera a salida_volcar
+	struct iovec parte = {salida->buffer, salida->usado};
+	bool ok = escribir_tramos(salida->fd, &parte, salida->usado > 0);
+	salida->usado = 0;
+	return ok;
+}
+
+// Agrega largo bytes de datos a la salida.
+// Pre: la salida fue creada.
+void salida_escribir(salida_t* salida, const char* datos, size_t largo)
+{
+	// En memoria, si no se puede agrandar el buffer los datos se pierden
+	// (y queda el error).
+	if (salida->fd < 0 && largo > salida->tam - salida->usado && !agrandar(salida, largo))
+		return;
+	if (largo <= salida->tam - salida->usado)
+	{
+		memcpy(salida->buffer + salida->usado, datos, largo);
+		salida->usado += largo;
+		return;
+	}
+	// No entra: el buffer y los datos salen juntos en una sola llamada.
+	struct iovec partes[2] = {{salida->buffer, salida->usado}, {(char*)datos, largo}};
+	escribir_tramos(salida->fd, partes, 2);
+	salida->usado = 0;
+}
+
+// Agrega la cadena a la salida.
+// Pre: la salida fue creada.
+void salida_cadena(salida_t* salida, const char* cadena)
+{
+	salida_escribir(salida, cadena, strlen(cadena));
+}
+
+// Agrega el numero, en decimal, a la salida.
+// Pre: la salida fue creada.
+void salida_numero(salida_t* salida, size_t numero)
+{
+	// Los digitos se arman de atras para adelante.
+	char digitos[24];
+	size_t pos = sizeof(digitos);
+	do
+	{
+		digitos[--pos] = (char)('0' + numero % 10);
+		numero /= 10;
+	} while (numero > 0);
+	salida_escribir(salida, digitos + pos, sizeof(digitos) - pos);
+}
+
+// Agrega un caracter a la salida.
+// Pre: la salida fue creada.
+void salida_caracter(salida_t* salida, char caracter)
+{
+	if (salida->usado == salida->tam)
+	{
+		if (salida->fd >= 0) salida_vaciar(salida);
+		else if (!agrandar(salida, 1)) return;
+	}
+	salida->buffer[salida->usado++] = caracter;
+}
+
+// Marca el final de la respuesta a un comando: si la salida es interactiva,
+// la vacia.
+// Pre: la salida fue creada.
+void salida_fin_comando(salida_t* salida)
+{
+	if (salida->interactiva) salida_vaciar(salida);
+}
+
+// Agrega a destino todo lo que junto origen, y deja a origen vacia y sin
+// error.
+// Pre: las dos salidas fueron creadas; origen es una salida en memoria.
+void salida_volcar(salida_t* destino, salida_t* origen)
+{
+	salida_escribir(destino, origen->buffer, origen->usado);
+	salida_descartar(origen);
+}
+
+// Devuelve true si la salida es en memoria y perdio algo de lo que se le
+// escribio por falta de memoria.
+// Pre: la salida fue creada.
+bool salida_error(const salida_t* salida)
+{
+	return salida->error;
+}
+
+// Tira todo lo que junto la salida, y la deja vacia y sin error.
+// Pre: la salida fue creada y es en memoria.
+void salida_descartar(salida_t* salida)
+{
+	salida->usado = 0;
+	salida->error = false;
+}
@@ -0,0 +1,80 @@
+#ifndef SALIDA_H
+#define SALIDA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* La salida junta lo que se escribe en un buffer grande, formateando los
+ * numeros a mano, y lo manda con writev(2) cuando se llena o al vaciarla.
+ * Una salida interactiva se vacia ademas al final de cada comando, para que
+ * las respuestas se vean en el momento. Una salida en memoria no escribe en
+ * ningun descriptor: junta todo hasta que se la vuelca en otra salida (por
+ * ejemplo, la respuesta de un comando ejecutado en otro hilo). Si no tiene
+ * memoria para crecer pierde lo que se le escribe, y queda marcada con
+ * error hasta que se la vuelca o se la descarta. */
+
+typedef struct salida salida_t;
+
+/* ******************************************************************
+ *                    PRIMITIVAS DE LA SALIDA
+ * *****************************************************************/
+
+// Crea una salida que escribe en el descriptor fd con un buffer de tam bytes.
+// Post: Devuelve la salida o NULL en caso de error.
+salida_t* salida_crear(int fd, size_t tam, bool interactiva);
+
+// Crea una salida que junta todo en memoria, empezando con un buffer de
+// tam bytes, hasta que se la vuelca en otra con salida_volcar.
+// Post: Devuelve la salida o NULL en caso de error.
+salida_t* salida_crear_en_memoria(size_t tam);
+
+// Vacia la salida y la destruye. El descriptor no se cierra.
+// Pre: la salida fue creada.
+void salida_destruir(salida_t* salida);
+
+// Agrega largo bytes de datos a la salida.
+// Pre: la salida fue creada.
+void salida_escribir(salida_t* salida, const char* datos, size_t largo);
+
+// Agrega la cadena a la salida.
+// Pre: la salida fue creada.
+void salida_cadena(salida_t* salida, const char* cadena);
+
+// Agrega el numero, en decimal, a la salida.
+// Pre: la salida fue creada.
+void salida_numero(salida_t* salida, size_t numero);
+
+// Agrega un caracter a la salida.
+// Pre: la salida fue creada.
+void salida_caracter(salida_t* salida, char caracter);
+
+// Marca el final de la respuesta a un comando: si la salida es interactiva,
+// la vacia.
+// Pre: la salida fue creada.
+void salida_fin_comando(salida_t* salida);
+
+// Agrega a destino todo lo que junto origen, y deja a origen vacia y sin
+// error.
+// Pre: las dos salidas fueron creadas; origen es una salida en memoria.
+void salida_volcar(salida_t* destino, salida_t* origen);
+
+// Devuelve true si la salida es en memoria y perdio algo de lo que se le
+// escribio por falta de memoria.
+// Pre: la salida fue creada.
+bool salida_error(const salida_t* salida);
+
+// Tira todo lo que junto la salida, y la deja vacia y sin error.
+// Pre: la salida fue creada y es en memoria.
+void salida_descartar(salida_t* salida);
+
+// Escribe todo lo que quedaba en el buffer (una salida en memoria lo
+// sigue guardando).
+// Pre: la salida fue creada.
+// Post: Devuelve false si hubo un error al escribir.
+bool salida_vaciar(salida_t* salida);
+
+#endif //SALIDA_H
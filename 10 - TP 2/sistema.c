@@ -1,9 +1,9 @@
 #include <stdbool.h>
-#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "sistema.h"
 #include "twitter.h"
+#include "consulta.h"
 
 /* ******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS
@@ -21,33 +21,56 @@ const char* mensajes_error[] = // Mensajes asociados al codigo de error
 	"ERROR_TWIT_DEMASIADO_LARGO", "ERROR: memoria insuficiente. Cerrando"
 };
 
-// firma de las funciones asociadas a los comandos
-typedef errores (*COMANDO)(sistema_t*, char**, size_t);
+// firma de las funciones asociadas a los comandos: escriben la respuesta en
+// la salida que reciben.
+typedef errores (*COMANDO)(sistema_t*, char**, size_t, salida_t*);
+
+// firma de las funciones que esperan a que se apliquen los cambios que va
+// a leer un comando (ver sistema_sincronizar_comando).
+typedef bool (*SINCRONIZAR)(twitter_t*, char**, size_t);
 
 struct sistema {
 	twitter_t* twitter;
-	COMANDO funcion_actual;
+	salida_t* salida;
+	const comando_t* comando_actual;
 };
 
 /* ******************************************************************
  *                        IMPLEMENTACION
  * *****************************************************************/
 
-// Crea el sistema de comandos.
+// Crea el sistema de comandos, que escribe las respuestas en salida.
+// La salida pasa a ser del sistema, que la destruye al destruirse.
+// Post: Devuelve el sistema o NULL en caso de error.
+sistema_t* sistema_crear(salida_t* salida)
+{
+	return sistema_crear_con_hilos(salida, 1);
+}
+
+// Como sistema_crear, pero con las palabras del twitter repartidas en
+// hilos fragmentos, cada uno modificado en un hilo propio (con 1 no se
+// crea ningun hilo). Ver twitter_crear_con_fragmentos.
+// Pre: hilos esta entre 1 y TWITTER_MAX_FRAGMENTOS.
 // Post: Devuelve el sistema o NULL en caso de error.
-sistema_t* sistema_crear()
+sistema_t* sistema_crear_con_hilos(salida_t* salida, size_t hilos)
 {
+	if (!salida) return NULL;
 	sistema_t* sistema = malloc(sizeof(sistema_t));
-	if (!sistema) return NULL;
+	if (!sistema){
+		salida_destruir(salida);
+		return NULL;
+	}
 
-	twitter_t* twitter = twitter_crear();
+	twitter_t* twitter = twitter_crear_con_fragmentos(hilos, hilos > 1);
 	if (!twitter){
+		salida_destruir(salida);
 		free(sistema);
 		return NULL;
 	}
 
 	sistema->twitter = twitter;
-	sistema->funcion_actual = NULL;
+	sistema->salida = salida;
+	sistema->comando_actual = NULL;
 	return sistema;
 }
 
@@ -56,9 +79,38 @@ sistema_t* sistema_crear()
 void sistema_destruir(sistema_t* sistema)
 {
 	twitter_destruir(sistema->twitter);
+	salida_destruir(sistema->salida);
 	free(sistema);
 }
 
+// Escribe en la salida el error de un cambio que fallo al sincronizar.
+static void fallo_sincronizar(sistema_t* sistema)
+{
+	salida_cadena(sistema->salida, mensajes_error[MEM_ERROR]);
+	salida_caracter(sistema->salida, '\n');
+	salida_fin_comando(sistema->salida);
+}
+
+// Espera a que se apliquen los cambios de los comandos ya ejecutados (ver
+// twitter_sincronizar). Si alguno fallo, escribe el error en la salida.
+// Pre: el sistema fue creado.
+// Post: Devuelve false en caso de error, y hay que terminar el programa.
+bool sistema_sincronizar(sistema_t* sistema)
+{
+	if (twitter_sincronizar(sistema->twitter)) return true;
+	fallo_sincronizar(sistema);
+	return false;
+}
+
+// Escribe en la salida del sistema la respuesta que un comando escribio en
+// otra salida (ver ejecutar_comando_identificado), y termina el comando.
+// Pre: el sistema fue creado; respuesta es una salida en memoria.
+void sistema_responder(sistema_t* sistema, salida_t* respuesta)
+{
+	salida_volcar(sistema->salida, respuesta);
+	salida_fin_comando(sistema->salida);
+}
+
 /* ******************************************************************
  *                          COMANDOS 
  * *****************************************************************/
@@ -71,7 +123,7 @@ void sistema_destruir(sistema_t* sistema)
 // Recibe el sistema, los parametros y su cantidad.
 // Pre: el sistema fue creado.
 // Post: Devuelve errores que debera manipular el que llamo a esta funcion.
-errores comando_twittear(sistema_t* sistema, char** parametros, size_t cant_parametros)
+errores comando_twittear(sistema_t* sistema, char** parametros, size_t cant_parametros, salida_t* salida)
 {
 	if (cant_parametros != CANT_PARAM_TWITTEAR) return ERROR_COMANDO_INVALIDO;
 	
@@ -83,7 +135,7 @@ errores comando_twittear(sistema_t* sistema, char** parametros, size_t cant_para
 		return ERROR_TWIT_DEMASIADO_LARGO;
 
 	// Twitteamos
-	if (!twitter_twittear(sistema->twitter, parametros[POS_AUTOR], parametros[POS_MENSAJE]))
+	if (!twitter_twittear(sistema->twitter, parametros[POS_AUTOR], parametros[POS_MENSAJE], salida))
 		return MEM_ERROR;
 	return NO_ERROR;
 }
@@ -94,7 +146,7 @@ errores comando_twittear(sistema_t* sistema, char** parametros, size_t cant_para
 // Recibe el sistema, los parametros y su cantidad.
 // Pre: el sistema fue creado.
 // Post: Devuelve errores que debera manipular el que llamo a esta funcion.
-errores comando_favorito(sistema_t* sistema, char** parametros, size_t cant_parametros)
+errores comando_favorito(sistema_t* sistema, char** parametros, size_t cant_parametros, salida_t* salida)
 {
 	if (cant_parametros != CANT_PARAM_FAVORITO) return ERROR_COMANDO_INVALIDO;
 
@@ -104,9 +156,12 @@ errores comando_favorito(sistema_t* sistema, char** parametros, size_t cant_para
 	if (*punt_final != '\0') return ERROR_COMANDO_INVALIDO; // El parametro no es un nro
 	if (id < 0) return ERROR_TWIT_ID_INVALIDO; // Los ids no son negativos.
 
-	// Favoriteamos
-	if (!twitter_favorito(sistema->twitter, (size_t)id))
+	if ((size_t)id >= twitter_cantidad(sistema->twitter))
 		return ERROR_TWIT_ID_INVALIDO; // No existia el id
+
+	// Favoriteamos
+	if (!twitter_favorito(sistema->twitter, (size_t)id, salida))
+		return MEM_ERROR;
 	return NO_ERROR;
 }
 
@@ -118,7 +173,7 @@ errores comando_favorito(sistema_t* sistema, char** parametros, size_t cant_para
 // Recibe el sistema, los parametros y su cantidad.
 // Pre: el sistema fue creado.
 // Post: Devuelve errores que debera manipular el que llamo a esta funcion.
-errores comando_buscar(sistema_t* sistema, char** parametros, size_t cant_parametros)
+errores comando_buscar(sistema_t* sistema, char** parametros, size_t cant_parametros, salida_t* salida)
 {
 	if (cant_parametros != CANT_PARAM_BUSCAR) return ERROR_COMANDO_INVALIDO;
 	
@@ -129,74 +184,197 @@ errores comando_buscar(sistema_t* sistema, char** parametros, size_t cant_parame
 	if (cantidad < 0) return ERROR_COMANDO_INVALIDO; // Cantidad no puede ser negativo
 
 	// El termino buscado no es ni usuario ni hashtag
-	if (*parametros[POS_BUSCADO] != '@' && *parametros[POS_BUSCADO] != '#')
+	if (!consulta_es_termino(parametros[POS_BUSCADO]))
 		return ERROR_COMANDO_INVALIDO; 
 
-	// Defino el tipo de busqueda a efectuar y busco.
-	if (strcmp(parametros[POS_ORDEN], "cronologico") == 0)
-		// No falla
-		twitter_buscar_cronologico(sistema->twitter, parametros[POS_BUSCADO], (size_t)cantidad);
-	else if (strcmp(parametros[POS_ORDEN], "popular") == 0){
-		if (!twitter_buscar_popular(sistema->twitter, parametros[POS_BUSCADO], (size_t)cantidad))
-			return MEM_ERROR;
-	}else
+	bool cronologico = strcmp(parametros[POS_ORDEN], "cronologico") == 0;
+	if (!cronologico && strcmp(parametros[POS_ORDEN], "popular") != 0)
 		return ERROR_COMANDO_INVALIDO;
+
+	// Separo los terminos y busco.
+	operador_t operador;
+	size_t cant_terminos = consulta_contar_terminos(parametros[POS_BUSCADO], &operador);
+	char** terminos = malloc(cant_terminos * sizeof(char*));
+	if (!terminos) return MEM_ERROR;
+	consulta_separar_terminos(parametros[POS_BUSCADO], terminos, cant_terminos, operador);
+
+	bool ok = cronologico ?
+		twitter_buscar_cronologico(sistema->twitter, terminos, cant_terminos, operador, (size_t)cantidad, salida) :
+		twitter_buscar_popular(sistema->twitter, terminos, cant_terminos, operador, (size_t)cantidad, salida);
+	free(terminos);
+	return ok ? NO_ERROR : MEM_ERROR;
+}
+
+// Espera a que se apliquen los cambios de los fragmentos de los terminos de
+// la busqueda, que son los unicos que lee comando_buscar.
+// Post: Devuelve false si fallo algun cambio de esos fragmentos.
+static bool sincronizar_buscar(twitter_t* twitter, char** parametros, size_t cant_parametros)
+{
+	// Una busqueda invalida no lee nada.
+	if (cant_parametros != CANT_PARAM_BUSCAR || !consulta_es_termino(parametros[POS_BUSCADO]))
+		return true;
+
+	// Los terminos, como los separa consulta_separar_terminos pero sin
+	// cortar la busqueda. El ultimo llega hasta el final.
+	const char* termino = parametros[POS_BUSCADO];
+	operador_t operador;
+	size_t cant_terminos = consulta_contar_terminos(termino, &operador);
+	char separador = operador == OPERADOR_Y ? '&' : '|';
+	for (size_t i = 0; i < cant_terminos; i++)
+	{
+		const char* fin = i + 1 < cant_terminos ? strchr(termino, separador) : termino + strlen(termino);
+		if (!twitter_sincronizar_palabra(twitter, termino, (size_t)(fin - termino))) return false;
+		termino = fin + 1;
+	}
+	return true;
+}
+
+#define CANT_PARAM_AUTOCOMPLETAR 2
+#define POS_PREFIJO 0
+#define POS_SUGERENCIAS 1
+// Lleva a cabo el comando autocompletar.
+// Recibe el sistema, los parametros y su cantidad.
+// Pre: el sistema fue creado.
+// Post: Devuelve errores que debera manipular el que llamo a esta funcion.
+errores comando_autocompletar(sistema_t* sistema, char** parametros, size_t cant_parametros, salida_t* salida)
+{
+	if (cant_parametros != CANT_PARAM_AUTOCOMPLETAR) return ERROR_COMANDO_INVALIDO;
+
+	// Conversion y comprobacion de la cantidad de sugerencias.
+	char* punt_final;
+	long cantidad = strtol(parametros[POS_SUGERENCIAS], &punt_final, 10);
+	if (*punt_final != '\0') return ERROR_COMANDO_INVALIDO; // El parametro no es un nro
+	if (cantidad < 0) return ERROR_COMANDO_INVALIDO; // Cantidad no puede ser negativo
+
+	// Completamos (no falla)
+	twitter_autocompletar(sistema->twitter, parametros[POS_PREFIJO], (size_t)cantidad, salida);
 	return NO_ERROR;
 }
 
+// comando_autocompletar lee las palabras de todos los fragmentos.
+static bool sincronizar_autocompletar(twitter_t* twitter, char** parametros, size_t cant_parametros)
+{
+	return twitter_sincronizar(twitter);
+}
+
 /* ******************************************************************
  *                    EJECUTADOR DE COMANDOS
  * *****************************************************************/
 
-struct comandos{
+struct comando{
 	char* nombre;
 	COMANDO funcion;
 	int cant_parametros;
 	bool eliminar_chars_finales;
+	bool solo_lectura; // no cambia el twitter
+	SINCRONIZAR sincronizar; // NULL si no es de solo lectura
 };
 
-#define CANT_COMANDOS 3
-struct comandos lista_de_comandos[CANT_COMANDOS] = 
+#define CANT_COMANDOS 4
+const comando_t lista_de_comandos[CANT_COMANDOS] = 
 {
-	{"twittear", comando_twittear, CANT_PARAM_TWITTEAR, false},
-	{"favorito", comando_favorito, CANT_PARAM_FAVORITO, true},
-	{"buscar", comando_buscar, CANT_PARAM_BUSCAR, true}
+	{"twittear", comando_twittear, CANT_PARAM_TWITTEAR, false, false, NULL},
+	{"favorito", comando_favorito, CANT_PARAM_FAVORITO, true, false, NULL},
+	{"buscar", comando_buscar, CANT_PARAM_BUSCAR, true, true, sincronizar_buscar},
+	{"autocompletar", comando_autocompletar, CANT_PARAM_AUTOCOMPLETAR, true, true, sincronizar_autocompletar}
 };
 
-// Para usar con la entrada.
-// Define el comportamiento de la entrada dependiendo del comando.
-// Recibe el comando, ptro a bool para definir eliminacion de espacios finales vacios
-// y el sistema de comandos.
-// Pre: El sistema fue creado.
+// Para usar con la entrada, como cantidad_parametros, pero sin sistema.
+// Recibe el nombre del comando, ptro a bool para definir eliminacion de
+// espacios finales vacios y un const comando_t** donde guarda el comando
+// (NULL si no es un comando conocido).
 // Post: Devolvera la cantidad de parametros a esperar y modificara el booleano
 // recibido por parametro.
-int cantidad_parametros(char* comando, bool* eliminar_chars_finales, void* sistema)
+int identificar_comando(char* nombre, bool* eliminar_chars_finales, void* comando)
 {
-	for (size_t i = 0; comando && i < CANT_COMANDOS; i++)
-		if (strcmp(lista_de_comandos[i].nombre, comando) == 0)
+	const comando_t** identificado = comando;
+	for (size_t i = 0; nombre && i < CANT_COMANDOS; i++)
+		if (strcmp(lista_de_comandos[i].nombre, nombre) == 0)
 		{
 			*eliminar_chars_finales = lista_de_comandos[i].eliminar_chars_finales;
-			((sistema_t*)sistema)->funcion_actual = lista_de_comandos[i].funcion;
+			*identificado = &lista_de_comandos[i];
 			return lista_de_comandos[i].cant_parametros;
 		};
 	// si llegamos aca no es un comando conocido! -> que termine lo antes posible
-	((sistema_t*)sistema)->funcion_actual = NULL;
+	*identificado = NULL;
 	*eliminar_chars_finales = false;
 	return 0;
 }
 
+// Devuelve true si el comando (devuelto por identificar_comando) no cambia
+// el twitter, y se puede ejecutar en varios hilos a la vez.
+bool comando_solo_lectura(const comando_t* comando)
+{
+	return comando && comando->solo_lectura;
+}
+
+// Como sistema_sincronizar, pero solo espera a los cambios que va a leer el
+// comando (devuelto por identificar_comando) con esos parametros: una
+// busqueda espera solo a los fragmentos de sus terminos, y un comando que
+// no es de solo lectura no espera nada.
+// Pre: el sistema fue creado.
+// Post: Devuelve false en caso de error, y hay que terminar el programa.
+bool sistema_sincronizar_comando(sistema_t* sistema, const comando_t* comando, char** parametros, size_t cant_parametros)
+{
+	if (!comando || !comando->sincronizar ||
+		comando->sincronizar(sistema->twitter, parametros, cant_parametros)) return true;
+	fallo_sincronizar(sistema);
+	return false;
+}
+
+// Para usar con la entrada.
+// Define el comportamiento de la entrada dependiendo del comando.
+// Recibe el comando, ptro a bool para definir eliminacion de espacios finales vacios
+// y el sistema de comandos.
+// Pre: El sistema fue creado.
+// Post: Devolvera la cantidad de parametros a esperar y modificara el booleano
+// recibido por parametro.
+int cantidad_parametros(char* comando, bool* eliminar_chars_finales, void* sistema)
+{
+	return identificar_comando(comando, eliminar_chars_finales, &((sistema_t*)sistema)->comando_actual);
+}
+
+// Ejecuta el comando (devuelto por identificar_comando) y escribe la
+// respuesta en salida, sin terminar el comando en ella. Si el comando es
+// de solo lectura, se puede llamar desde varios hilos a la vez, con
+// salidas distintas, mientras no se ejecute otro. Si la salida es en
+// memoria y no pudo guardar toda la respuesta, la respuesta es el error de
+// memoria.
+// Pre: El sistema fue creado y, si hay hilos, sincronizado para este
+// comando (ver sistema_sincronizar_comando) despues del ultimo comando que
+// no es de solo lectura.
+// Post: Devuelve false en caso de producirse un error y necesitar la
+// finalizacion del programa.
+bool ejecutar_comando_identificado(sistema_t* sistema, const comando_t* comando, char** parametros, size_t cant_parametros, salida_t* salida)
+{
+	errores error = ERROR_COMANDO_INVALIDO;
+	if (comando)
+		error = comando->funcion(sistema, parametros, cant_parametros, salida);
+	if (salida_error(salida))
+	{
+		// Se tira la respuesta incompleta, que deja lugar al mensaje.
+		salida_descartar(salida);
+		error = MEM_ERROR;
+	}
+
+	if (error > NO_ERROR)
+	{
+		salida_cadena(salida, mensajes_error[error]);
+		salida_caracter(salida, '\n');
+	}
+	return error != MEM_ERROR;
+}
+
 // Ejecuta el comando correspondiente a su nombre.
 // Recibe el sistema, el comando, los parametros y su cantidad.
 // Devuelve false en caso de producirse un error y necesitar la finalizacion del programa
 // Pre: El sistema fue creado.
-// Post: se ejecuto el comando y el resultado se imprimio por la salida estandar.
+// Post: se ejecuto el comando y el resultado se escribio en la salida.
 bool ejecutar_comando(sistema_t* sistema, char* comando, char** parametros, size_t cant_parametros)
 {
-	errores error = ERROR_COMANDO_INVALIDO;
-	if (sistema->funcion_actual)
-		error = sistema->funcion_actual(sistema, parametros, cant_parametros);
-
-	if (error > NO_ERROR) printf("%s\n", mensajes_error[error]);
-	if (error == MEM_ERROR) return false;
-	return true;
+	if (!sistema_sincronizar_comando(sistema, sistema->comando_actual, parametros, cant_parametros))
+		return false;
+	bool ok = ejecutar_comando_identificado(sistema, sistema->comando_actual, parametros, cant_parametros, sistema->salida);
+	salida_fin_comando(sistema->salida);
+	return ok;
 }
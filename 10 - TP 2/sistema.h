@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include <stdlib.h>
+#include "salida.h"
 
 /* ******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS
@@ -10,22 +11,64 @@
 
 typedef struct sistema sistema_t;
 
+// Un comando conocido (twittear, favorito, buscar o autocompletar).
+typedef struct comando comando_t;
+
 /* ******************************************************************
  *               PRIMITIVAS DEl SISTEMA DE COMANDOS
  * *****************************************************************/
 
-// Crea el sistema de comandos.
+// Crea el sistema de comandos, que escribe las respuestas en salida.
+// La salida pasa a ser del sistema, que la destruye al destruirse.
+// Post: Devuelve el sistema o NULL en caso de error.
+sistema_t* sistema_crear(salida_t* salida);
+
+// Como sistema_crear, pero con las palabras del twitter repartidas en
+// hilos fragmentos, cada uno modificado en un hilo propio (con 1 no se
+// crea ningun hilo). Ver twitter_crear_con_fragmentos.
+// Pre: hilos esta entre 1 y TWITTER_MAX_FRAGMENTOS.
 // Post: Devuelve el sistema o NULL en caso de error.
-sistema_t* sistema_crear();
+sistema_t* sistema_crear_con_hilos(salida_t* salida, size_t hilos);
 
 // Destruye el sistema de comandos
 // Pre: el sistema fue creado.
 void sistema_destruir(sistema_t* sistema);
 
+// Espera a que se apliquen los cambios de los comandos ya ejecutados (ver
+// twitter_sincronizar). Si alguno fallo, escribe el error en la salida.
+// Pre: el sistema fue creado.
+// Post: Devuelve false en caso de error, y hay que terminar el programa.
+bool sistema_sincronizar(sistema_t* sistema);
+
+// Escribe en la salida del sistema la respuesta que un comando escribio en
+// otra salida (ver ejecutar_comando_identificado), y termina el comando.
+// Pre: el sistema fue creado; respuesta es una salida en memoria.
+void sistema_responder(sistema_t* sistema, salida_t* respuesta);
+
 /* ******************************************************************
  *                    EJECUTADOR DE COMANDOS
  * *****************************************************************/
 
+// Para usar con la entrada, como cantidad_parametros, pero sin sistema.
+// Recibe el nombre del comando, ptro a bool para definir eliminacion de
+// espacios finales vacios y un const comando_t** donde guarda el comando
+// (NULL si no es un comando conocido).
+// Post: Devolvera la cantidad de parametros a esperar y modificara el booleano
+// recibido por parametro.
+int identificar_comando(char* nombre, bool* eliminar_chars_finales, void* comando);
+
+// Devuelve true si el comando (devuelto por identificar_comando) no cambia
+// el twitter, y se puede ejecutar en varios hilos a la vez.
+bool comando_solo_lectura(const comando_t* comando);
+
+// Como sistema_sincronizar, pero solo espera a los cambios que va a leer el
+// comando (devuelto por identificar_comando) con esos parametros: una
+// busqueda espera solo a los fragmentos de sus terminos, y un comando que
+// no es de solo lectura no espera nada.
+// Pre: el sistema fue creado.
+// Post: Devuelve false en caso de error, y hay que terminar el programa.
+bool sistema_sincronizar_comando(sistema_t* sistema, const comando_t* comando, char** parametros, size_t cant_parametros);
+
 // Para usar con la entrada.
 // Define el comportamiento de la entrada dependiendo del comando.
 // Recibe el comando, ptro a bool para definir eliminacion de espacios finales vacios
@@ -35,11 +78,24 @@ void sistema_destruir(sistema_t* sistema);
 // recibido por parametro.
 int cantidad_parametros(char* comando, bool* eliminar_chars_finales, void* sistema);
 
+// Ejecuta el comando (devuelto por identificar_comando) y escribe la
+// respuesta en salida, sin terminar el comando en ella. Si el comando es
+// de solo lectura, se puede llamar desde varios hilos a la vez, con
+// salidas distintas, mientras no se ejecute otro. Si la salida es en
+// memoria y no pudo guardar toda la respuesta, la respuesta es el error de
+// memoria.
+// Pre: El sistema fue creado y, si hay hilos, sincronizado para este
+// comando (ver sistema_sincronizar_comando) despues del ultimo comando que
+// no es de solo lectura.
+// Post: Devuelve false en caso de producirse un error y necesitar la
+// finalizacion del programa.
+bool ejecutar_comando_identificado(sistema_t* sistema, const comando_t* comando, char** parametros, size_t cant_parametros, salida_t* salida);
+
 // Ejecuta el comando correspondiente a su nombre.
 // Recibe el sistema, el comando, los parametros y la cantidad de parametros.
 // Devuelve false en caso de producirse un error y necesitar la finalizacion del programa
 // Pre: El sistema fue creado.
-// Post: se ejecuto el comando y el resultado se imprimio por la salida estandar.
+// Post: se ejecuto el comando y el resultado se escribio en la salida.
 bool ejecutar_comando(sistema_t* sistema, char* comando, char** parametros, size_t cant_parametros);
 
 #endif //SISTEMA_H
\ No newline at end of file
@@ -1,26 +1,66 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include "entrada.h"
+#include "salida.h"
 #include "sistema.h"
+#include "tuberia.h"
+#include "twitter.h"
 
 #define POS_COMANDO 0
+#define TAM_SALIDA (1024 * 1024)
+#define COMANDOS_POR_LOTE 256
 
-/* Programa principal */
-int main(void)
+/* Programa principal. Lee los comandos del archivo recibido por parametro
+ * o, si no recibe ninguno, de la entrada estandar: tp2 [-i] [-h hilos]
+ * [archivo]. Las respuestas se escriben de a bloques grandes, salvo que la
+ * salida sea una terminal o se pase -i: entonces se escriben despues de
+ * cada comando. Con -h y mas de un hilo, los comandos se ejecutan en
+ * tuberia (ver tuberia.h), con las palabras repartidas en hilos fragmentos;
+ * las respuestas son las mismas. Termina con 1 si no pudo empezar o si
+ * corto por un error. */
+int main(int argc, char** argv)
 {
-	entrada_t* entrada = entrada_crear(POS_COMANDO);
+	bool interactivo = isatty(STDOUT_FILENO);
+	size_t hilos = 1;
+	while (argc > 1 && argv[1][0] == '-')
+	{
+		if (strcmp(argv[1], "-i") == 0)
+			interactivo = true;
+		else if (strcmp(argv[1], "-h") == 0 && argc > 2)
+		{
+			char* punt_final;
+			long cantidad = strtol(argv[2], &punt_final, 10);
+			if (*punt_final != '\0' || cantidad < 1 || cantidad > TWITTER_MAX_FRAGMENTOS) return 1;
+			hilos = (size_t)cantidad;
+			argc--;
+			argv++;
+		}
+		else return 1;
+		argc--;
+		argv++;
+	}
+
+	entrada_t* entrada = argc > 1 ? entrada_abrir(argv[1], POS_COMANDO) : entrada_crear(POS_COMANDO);
 	if (!entrada) return 1;
 
-	sistema_t* sistema = sistema_crear();
+	sistema_t* sistema = sistema_crear_con_hilos(salida_crear(STDOUT_FILENO, TAM_SALIDA, interactivo), hilos);
 	if (!sistema)
 	{
 		entrada_destruir(entrada);
 		return 1;
 	}
 
-	while (entrada_leer(entrada, cantidad_parametros, (void*)sistema) &&
-		   ejecutar_comando(sistema, entrada_comando(entrada), 
-					entrada_parametros(entrada), entrada_cant_parametros(entrada)));
+	bool ok = true;
+	if (hilos > 1)
+		ok = tuberia_ejecutar(entrada, sistema, hilos, interactivo ? 1 : COMANDOS_POR_LOTE);
+	else
+		while (ok && entrada_leer(entrada, cantidad_parametros, (void*)sistema))
+			ok = ejecutar_comando(sistema, entrada_comando(entrada),
+						entrada_parametros(entrada), entrada_cant_parametros(entrada));
 
 	sistema_destruir(sistema);
 	entrada_destruir(entrada);
-	return 0;
+	return ok ? 0 : 1;
 }
\ No newline at end of file
@@ -0,0 +1,303 @@
+#include <stdlib.h>
+#include <string.h>
+#include "trie.h"
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+// La arista que llega al nodo es etiqueta[0, largo), que apunta dentro de
+// la clave de algun nodo del subarbol (asi las aristas no piden memoria).
+// clave es NULL si ninguna clave termina en el nodo. hijos esta ordenado
+// por el primer caracter de su etiqueta, y top por frecuencia.
+struct trie_nodo
+{
+	const char* etiqueta;
+	size_t largo;
+	char* clave;
+	size_t frecuencia;
+	size_t marca;      // la del ultimo incremento
+	trie_nodo_t* padre;
+	trie_nodo_t** hijos;
+	size_t cant_hijos;
+	trie_nodo_t** top;
+	size_t cant_top;
+	size_t tam_top;
+};
+
+struct trie
+{
+	trie_nodo_t* raiz;
+};
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+// Crea un nodo sin hijos colgando de padre.
+static trie_nodo_t* nodo_crear(trie_nodo_t* padre, const char* etiqueta, size_t largo)
+{
+	trie_nodo_t* nodo = malloc(sizeof(trie_nodo_t));
+	if (!nodo) return NULL;
+	nodo->etiqueta = etiqueta;
+	nodo->largo = largo;
+	nodo->clave = NULL;
+	nodo->frecuencia = 0;
+	nodo->marca = 0;
+	nodo->padre = padre;
+	nodo->hijos = NULL;
+	nodo->cant_hijos = 0;
+	nodo->top = NULL;
+	nodo->cant_top = 0;
+	nodo->tam_top = 0;
+	return nodo;
+}
+
+static void nodo_destruir(trie_nodo_t* nodo)
+{
+	for (size_t i = 0; i < nodo->cant_hijos; i++)
+		nodo_destruir(nodo->hijos[i]);
+	free(nodo->hijos);
+	free(nodo->top);
+	free(nodo->clave);
+	free(nodo);
+}
+
+// Devuelve la posicion del hijo de nodo cuya etiqueta empieza con c, o
+// donde habria que insertarlo si no hay ninguno.
+static size_t buscar_hijo(const trie_nodo_t* nodo, char c)
+{
+	size_t izq = 0, der = nodo->cant_hijos;
+	while (izq < der)
+	{
+		size_t medio = izq + (der - izq) / 2;
+		if ((unsigned char)nodo->hijos[medio]->etiqueta[0] < (unsigned char)c) izq = medio + 1;
+		else der = medio;
+	}
+	return izq;
+}
+
+// Pone a hijo en la posicion pos de los hijos de nodo.
+// Post: Devuelve false en caso de error.
+static bool insertar_hijo(trie_nodo_t* nodo, size_t pos, trie_nodo_t* hijo)
+{
+	trie_nodo_t** hijos = realloc(nodo->hijos, (nodo->cant_hijos + 1) * sizeof(trie_nodo_t*));
+	if (!hijos) return false;
+	memmove(hijos + pos + 1, hijos + pos, (nodo->cant_hijos - pos) * sizeof(trie_nodo_t*));
+	hijos[pos] = hijo;
+	nodo->hijos = hijos;
+	nodo->cant_hijos++;
+	return true;
+}
+
+// Devuelve cuantos caracteres tienen en comun la etiqueta del nodo y los
+// primeros largo caracteres de cadena.
+static size_t comun(const trie_nodo_t* nodo, const char* cadena, size_t largo)
+{
+	size_t i = 0;
+	while (i < nodo->largo && i < largo && nodo->etiqueta[i] == cadena[i]) i++;
+	return i;
+}
+
+// Devuelve una copia de los primeros largo caracteres de clave, terminada
+// en '\0', o NULL en caso de error.
+static char* copiar_clave(const char* clave, size_t largo)
+{
+	char* copia = malloc(largo + 1);
+	if (!copia) return NULL;
+	memcpy(copia, clave, largo);
+	copia[largo] = '\0';
+	return copia;
+}
+
+// Corta la arista que llega a hijo (el hijo pos de nodo) despues de largo
+// caracteres, con un nodo nuevo en el medio que hereda su top.
+// Post: Devuelve el nodo nuevo o NULL en caso de error.
+static trie_nodo_t* partir(trie_nodo_t* nodo, size_t pos, size_t largo)
+{
+	trie_nodo_t* hijo = nodo->hijos[pos];
+	trie_nodo_t* medio = nodo_crear(nodo, hijo->etiqueta, largo);
+	trie_nodo_t** hijos = malloc(sizeof(trie_nodo_t*));
+	trie_nodo_t** top = hijo->cant_top ? malloc(hijo->cant_top * sizeof(trie_nodo_t*)) : NULL;
+	if (!medio || !hijos || (hijo->cant_top && !top))
+	{
+		free(medio);
+		free(hijos);
+		free(top);
+		return NULL;
+	}
+	if (top) memcpy(top, hijo->top, hijo->cant_top * sizeof(trie_nodo_t*));
+	medio->top = top;
+	medio->cant_top = medio->tam_top = hijo->cant_top;
+	hijos[0] = hijo;
+	medio->hijos = hijos;
+	medio->cant_hijos = 1;
+
+	hijo->etiqueta += largo;
+	hijo->largo -= largo;
+	hijo->padre = medio;
+	nodo->hijos[pos] = medio;
+	return medio;
+}
+
+// Actualiza el top de nodo despues de que la frecuencia de clave subio.
+// Guarda en afuera si la clave quedo fuera del top.
+// Post: Devuelve false en caso de error.
+static bool actualizar_top(trie_nodo_t* nodo, trie_nodo_t* clave, bool* afuera)
+{
+	*afuera = false;
+	size_t i = 0;
+	while (i < nodo->cant_top && nodo->top[i] != clave) i++;
+	if (i == nodo->cant_top)
+	{
+		// No estaba: entra al final si hay lugar o si supera al ultimo.
+		if (nodo->cant_top < TRIE_TOP)
+		{
+			if (nodo->cant_top == nodo->tam_top)
+			{
+				size_t tam = nodo->tam_top ? nodo->tam_top * 2 : 1;
+				if (tam > TRIE_TOP) tam = TRIE_TOP;
+				trie_nodo_t** top = realloc(nodo->top, tam * sizeof(trie_nodo_t*));
+				if (!top) return false;
+				nodo->top = top;
+				nodo->tam_top = tam;
+			}
+			nodo->cant_top++;
+		}
+		else if (clave->frecuencia <= nodo->top[i - 1]->frecuencia)
+		{
+			*afuera = true;
+			return true;
+		}
+		i = nodo->cant_top - 1;
+		nodo->top[i] = clave;
+	}
+	// Sube mientras supere al anterior.
+	for (; i > 0 && nodo->top[i - 1]->frecuencia < clave->frecuencia; i--)
+	{
+		nodo->top[i] = nodo->top[i - 1];
+		nodo->top[i - 1] = clave;
+	}
+	return true;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Crea un trie vacio.
+// Post: Devuelve el trie o NULL en caso de error.
+trie_t* trie_crear(void)
+{
+	trie_t* trie = malloc(sizeof(trie_t));
+	trie_nodo_t* raiz = nodo_crear(NULL, "", 0);
+	if (!trie || !raiz)
+	{
+		free(trie);
+		free(raiz);
+		return NULL;
+	}
+	trie->raiz = raiz;
+	return trie;
+}
+
+// Destruye el trie y sus claves.
+// Pre: el trie fue creado.
+void trie_destruir(trie_t* trie)
+{
+	nodo_destruir(trie->raiz);
+	free(trie);
+}
+
+// Agrega la clave formada por los primeros largo_clave caracteres de clave
+// (una copia) con frecuencia 0 si no estaba, y devuelve su nodo, que vale
+// hasta destruir el trie.
+// Pre: el trie fue creado.
+// Post: Devuelve NULL en caso de error.
+trie_nodo_t* trie_agregar(trie_t* trie, const char* clave, size_t largo_clave)
+{
+	trie_nodo_t* nodo = trie->raiz;
+	const char* resto = clave;
+	const char* fin = clave + largo_clave;
+	while (resto < fin)
+	{
+		size_t pos = buscar_hijo(nodo, *resto);
+		if (pos == nodo->cant_hijos || nodo->hijos[pos]->etiqueta[0] != *resto)
+		{
+			// No hay arista: la clave termina en una hoja nueva.
+			char* copia = copiar_clave(clave, largo_clave);
+			trie_nodo_t* hoja = copia ? nodo_crear(nodo, copia + (resto - clave), (size_t)(fin - resto)) : NULL;
+			if (!hoja || !insertar_hijo(nodo, pos, hoja))
+			{
+				free(copia);
+				free(hoja);
+				return NULL;
+			}
+			hoja->clave = copia;
+			return hoja;
+		}
+		size_t largo = comun(nodo->hijos[pos], resto, (size_t)(fin - resto));
+		if (largo < nodo->hijos[pos]->largo && !partir(nodo, pos, largo)) return NULL;
+		nodo = nodo->hijos[pos];
+		resto += largo;
+	}
+
+	// La clave termina en un nodo que ya existia (o que acaba de partirse).
+	if (!nodo->clave)
+	{
+		nodo->clave = copiar_clave(clave, largo_clave);
+		if (!nodo->clave) return NULL;
+	}
+	return nodo;
+}
+
+// Incrementa en 1 la frecuencia de la clave del nodo.
+// Pre: nodo fue devuelto por trie_agregar. marca es mayor a la de todos
+// los incrementos anteriores.
+// Post: Devuelve false en caso de error.
+bool trie_incrementar(trie_nodo_t* nodo, size_t marca)
+{
+	nodo->frecuencia++;
+	nodo->marca = marca;
+	bool afuera = false;
+	// Si la clave no entra en el top de un nodo tampoco entra en el de sus
+	// ancestros, que compiten con mas claves.
+	for (trie_nodo_t* actual = nodo; actual && !afuera; actual = actual->padre)
+		if (!actualizar_top(actual, nodo, &afuera)) return false;
+	return true;
+}
+
+// Guarda en sugerencias las hasta cantidad claves mas frecuentes que
+// empiezan con prefijo, de mayor a menor frecuencia. Las claves con
+// frecuencia 0 no se cuentan.
+// Pre: el trie fue creado. cantidad no es mayor a TRIE_TOP y sugerencias
+// tiene lugar para cantidad elementos.
+// Post: Devuelve cuantas claves guardo.
+size_t trie_completar(const trie_t* trie, const char* prefijo, size_t cantidad, trie_sugerencia_t* sugerencias)
+{
+	const trie_nodo_t* nodo = trie->raiz;
+	size_t falta = strlen(prefijo);
+	while (falta > 0)
+	{
+		size_t pos = buscar_hijo(nodo, *prefijo);
+		if (pos == nodo->cant_hijos || nodo->hijos[pos]->etiqueta[0] != *prefijo) return 0;
+		nodo = nodo->hijos[pos];
+		size_t largo = comun(nodo, prefijo, falta);
+		// El prefijo termina en el medio de la arista: sirve el nodo de abajo.
+		if (largo == falta) break;
+		if (largo < nodo->largo) return 0;
+		prefijo += largo;
+		falta -= largo;
+	}
+
+	if (cantidad > nodo->cant_top) cantidad = nodo->cant_top;
+	for (size_t i = 0; i < cantidad; i++)
+	{
+		sugerencias[i].clave = nodo->top[i]->clave;
+		sugerencias[i].frecuencia = nodo->top[i]->frecuencia;
+		sugerencias[i].marca = nodo->top[i]->marca;
+	}
+	return cantidad;
+}
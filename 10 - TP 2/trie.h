@@ -0,0 +1,68 @@
+#ifndef TRIE_H
+#define TRIE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* El trie es un arbol de prefijos comprimido (cada arista tiene un tramo de
+ * clave, no un solo caracter) de claves con una frecuencia que solo sube.
+ * Cada nodo guarda las TRIE_TOP claves mas frecuentes de su subarbol, y se
+ * actualizan al incrementar una frecuencia, asi que completar un prefijo
+ * cuesta O(largo del prefijo + cantidad pedida). A igual frecuencia va
+ * primero la clave que llego antes a ella.
+ * Cada incremento lleva una marca, que tiene que crecer de un incremento al
+ * siguiente. Sirve para ordenar igual las claves de varios tries: a igual
+ * frecuencia, la de menor marca llego antes. */
+
+#define TRIE_TOP 10
+
+typedef struct trie trie_t;
+typedef struct trie_nodo trie_nodo_t;
+
+// Una clave devuelta por trie_completar, con su frecuencia y la marca del
+// incremento con el que llego a ella.
+typedef struct trie_sugerencia
+{
+	const char* clave;
+	size_t frecuencia;
+	size_t marca;
+} trie_sugerencia_t;
+
+/* ******************************************************************
+ *                    PRIMITIVAS DEL TRIE
+ * *****************************************************************/
+
+// Crea un trie vacio.
+// Post: Devuelve el trie o NULL en caso de error.
+trie_t* trie_crear(void);
+
+// Destruye el trie y sus claves.
+// Pre: el trie fue creado.
+void trie_destruir(trie_t* trie);
+
+// Agrega la clave formada por los primeros largo caracteres de clave (una
+// copia, terminada en '\0') con frecuencia 0 si no estaba, y devuelve su
+// nodo, que vale hasta destruir el trie.
+// Pre: el trie fue creado.
+// Post: Devuelve NULL en caso de error.
+trie_nodo_t* trie_agregar(trie_t* trie, const char* clave, size_t largo);
+
+// Incrementa en 1 la frecuencia de la clave del nodo.
+// Pre: nodo fue devuelto por trie_agregar. marca es mayor a la de todos
+// los incrementos anteriores.
+// Post: Devuelve false en caso de error.
+bool trie_incrementar(trie_nodo_t* nodo, size_t marca);
+
+// Guarda en sugerencias las hasta cantidad claves mas frecuentes que
+// empiezan con prefijo, de mayor a menor frecuencia. Las claves con
+// frecuencia 0 no se cuentan.
+// Pre: el trie fue creado. cantidad no es mayor a TRIE_TOP y sugerencias
+// tiene lugar para cantidad elementos.
+// Post: Devuelve cuantas claves guardo.
+size_t trie_completar(const trie_t* trie, const char* prefijo, size_t cantidad, trie_sugerencia_t* sugerencias);
+
+#endif //TRIE_H
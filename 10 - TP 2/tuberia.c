@@ -0,0 +1,315 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include "tuberia.h"
+#include "canal.h"
+#include "grupo.h"
+#include "salida.h"
+
+// Lotes que circulan entre el hilo que lee y el que ejecuta: mientras se
+// ejecuta uno se pueden estar leyendo los otros.
+#define CANT_LOTES 4
+#define TAM_TEXTO 4096
+#define TAM_RESPUESTA 256
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+// Un comando leido: sus parametros son los cant_parametros que empiezan en
+// primer_parametro dentro de los del lote.
+typedef struct orden
+{
+	const comando_t* comando;
+	size_t cant_parametros;
+	size_t primer_parametro;
+} orden_t;
+
+// Los comandos de varias lineas, con una copia del texto de sus
+// parametros. Mientras se llena, posiciones dice donde empieza cada
+// parametro en el texto (que se puede mover al agrandarse); al terminarse
+// se completan los punteros de parametros.
+typedef struct lote
+{
+	orden_t* ordenes;
+	size_t cant_ordenes;
+	char** parametros;
+	size_t* posiciones;
+	size_t cant_parametros;
+	size_t tam_parametros;
+	char* texto;
+	size_t usado;
+	size_t tam_texto;
+} lote_t;
+
+// llenos va del hilo que lee al que ejecuta, y vacios vuelve. respuestas
+// tiene una salida en memoria para cada busqueda de una tanda, y ok si
+// cada una termino bien.
+typedef struct tuberia
+{
+	entrada_t* entrada;
+	sistema_t* sistema;
+	size_t por_lote;
+	canal_t* llenos;
+	canal_t* vacios;
+	lote_t* lotes[CANT_LOTES];
+	grupo_t* grupo;
+	salida_t** respuestas;
+	bool* ok;
+} tuberia_t;
+
+// Las busquedas seguidas del lote que se ejecutan juntas, desde primera.
+typedef struct tanda
+{
+	tuberia_t* tuberia;
+	lote_t* lote;
+	size_t primera;
+} tanda_t;
+
+/* ******************************************************************
+ *                        IMPLEMENTACION
+ * *****************************************************************/
+
+/*******************************************************************
+ *                       Funciones auxiliares                      */
+
+static void lote_destruir(lote_t* lote)
+{
+	if (!lote) return;
+	free(lote->ordenes);
+	free(lote->parametros);
+	free(lote->posiciones);
+	free(lote->texto);
+	free(lote);
+}
+
+// Crea un lote vacio para hasta por_lote comandos.
+// Devuelve NULL en caso de error.
+static lote_t* lote_crear(size_t por_lote)
+{
+	lote_t* lote = calloc(1, sizeof(lote_t));
+	if (!lote) return NULL;
+	lote->tam_parametros = por_lote;
+	lote->tam_texto = TAM_TEXTO;
+	lote->ordenes = malloc(por_lote * sizeof(orden_t));
+	lote->parametros = malloc(lote->tam_parametros * sizeof(char*));
+	lote->posiciones = malloc(lote->tam_parametros * sizeof(size_t));
+	lote->texto = malloc(lote->tam_texto);
+	if (!lote->ordenes || !lote->parametros || !lote->posiciones || !lote->texto)
+	{
+		lote_destruir(lote);
+		return NULL;
+	}
+	return lote;
+}
+
+// Agranda el lugar para parametros del lote al doble.
+// Devuelve false en caso de error.
+static bool agrandar_parametros(lote_t* lote)
+{
+	size_t tam = lote->tam_parametros * 2;
+	char** parametros = realloc(lote->parametros, tam * sizeof(char*));
+	if (!parametros) return false;
+	lote->parametros = parametros;
+	size_t* posiciones = realloc(lote->posiciones, tam * sizeof(size_t));
+	if (!posiciones) return false;
+	lote->posiciones = posiciones;
+	lote->tam_parametros = tam;
+	return true;
+}
+
+// Copia al texto del lote la cadena, con su '\0'.
+// Devuelve false en caso de error.
+static bool copiar_texto(lote_t* lote, const char* cadena)
+{
+	size_t largo = strlen(cadena) + 1;
+	if (largo > lote->tam_texto - lote->usado)
+	{
+		size_t tam = lote->tam_texto;
+		while (largo > tam - lote->usado) tam *= 2;
+		char* texto = realloc(lote->texto, tam);
+		if (!texto) return false;
+		lote->texto = texto;
+		lote->tam_texto = tam;
+	}
+	memcpy(lote->texto + lote->usado, cadena, largo);
+	lote->usado += largo;
+	return true;
+}
+
+// Agrega al lote el comando con sus parametros.
+// Pre: el lote tiene lugar para otro comando.
+// Devuelve false en caso de error.
+static bool lote_agregar(lote_t* lote, const comando_t* comando, char** parametros, size_t cant_parametros)
+{
+	orden_t* orden = &lote->ordenes[lote->cant_ordenes];
+	orden->comando = comando;
+	orden->cant_parametros = cant_parametros;
+	orden->primer_parametro = lote->cant_parametros;
+	for (size_t i = 0; i < cant_parametros; i++)
+	{
+		if (lote->cant_parametros == lote->tam_parametros && !agrandar_parametros(lote))
+			return false;
+		lote->posiciones[lote->cant_parametros] = lote->usado;
+		if (!copiar_texto(lote, parametros[i])) return false;
+		lote->cant_parametros++;
+	}
+	lote->cant_ordenes++;
+	return true;
+}
+
+// Completa los punteros a los parametros, que ya no se mueven.
+static void lote_terminar(lote_t* lote)
+{
+	for (size_t i = 0; i < lote->cant_parametros; i++)
+		lote->parametros[i] = lote->texto + lote->posiciones[i];
+}
+
+// Funcion del hilo que lee: llena los lotes que vuelven vacios hasta que
+// termina la entrada o se cierra algun canal. Como la entrada, si no hay
+// memoria para guardar una linea deja de leer.
+static void* leer(void* dato)
+{
+	tuberia_t* tuberia = dato;
+	bool seguir = true;
+	lote_t* lote;
+	while (seguir && (lote = canal_recibir(tuberia->vacios)))
+	{
+		lote->cant_ordenes = 0;
+		lote->cant_parametros = 0;
+		lote->usado = 0;
+		while (seguir && lote->cant_ordenes < tuberia->por_lote)
+		{
+			const comando_t* comando = NULL;
+			seguir = entrada_leer(tuberia->entrada, identificar_comando, &comando) &&
+				lote_agregar(lote, comando, entrada_parametros(tuberia->entrada), entrada_cant_parametros(tuberia->entrada));
+		}
+		lote_terminar(lote);
+		if (lote->cant_ordenes > 0 && !canal_enviar(tuberia->llenos, lote)) seguir = false;
+	}
+	canal_cerrar(tuberia->llenos);
+	return NULL;
+}
+
+// Tarea del grupo: ejecuta la busqueda numero indice de la tanda.
+static void buscar(size_t indice, void* extra)
+{
+	tanda_t* tanda = extra;
+	tuberia_t* tuberia = tanda->tuberia;
+	orden_t* orden = &tanda->lote->ordenes[tanda->primera + indice];
+	tuberia->ok[indice] = ejecutar_comando_identificado(tuberia->sistema, orden->comando,
+		&tanda->lote->parametros[orden->primer_parametro], orden->cant_parametros, tuberia->respuestas[indice]);
+}
+
+// Ejecuta los comandos del lote, en orden.
+// Devuelve false si hubo un error y hay que terminar.
+static bool ejecutar_lote(tuberia_t* tuberia, lote_t* lote)
+{
+	size_t i = 0;
+	while (i < lote->cant_ordenes)
+	{
+		orden_t* orden = &lote->ordenes[i];
+		if (!comando_solo_lectura(orden->comando))
+		{
+			bool ok = ejecutar_comando_identificado(tuberia->sistema, orden->comando,
+				&lote->parametros[orden->primer_parametro], orden->cant_parametros, tuberia->respuestas[0]);
+			sistema_responder(tuberia->sistema, tuberia->respuestas[0]);
+			if (!ok) return false;
+			i++;
+			continue;
+		}
+
+		// Las busquedas seguidas se hacen a la vez, una vez aplicados los
+		// cambios anteriores que leen, y se responden en orden. Mientras,
+		// los fragmentos que no leen pueden seguir aplicando cambios.
+		size_t cantidad = 1;
+		while (i + cantidad < lote->cant_ordenes && comando_solo_lectura(lote->ordenes[i + cantidad].comando))
+			cantidad++;
+		for (size_t j = i; j < i + cantidad; j++)
+			if (!sistema_sincronizar_comando(tuberia->sistema, lote->ordenes[j].comando,
+				&lote->parametros[lote->ordenes[j].primer_parametro], lote->ordenes[j].cant_parametros))
+				return false;
+		tanda_t tanda = {tuberia, lote, i};
+		grupo_ejecutar(tuberia->grupo, cantidad, buscar, &tanda);
+		for (size_t j = 0; j < cantidad; j++)
+		{
+			sistema_responder(tuberia->sistema, tuberia->respuestas[j]);
+			if (!tuberia->ok[j]) return false;
+		}
+		i += cantidad;
+	}
+	return true;
+}
+
+// Libera todo lo de la tuberia (que ya no tiene el hilo que lee).
+static void tuberia_liberar(tuberia_t* tuberia)
+{
+	if (tuberia->llenos) canal_destruir(tuberia->llenos, NULL);
+	if (tuberia->vacios) canal_destruir(tuberia->vacios, NULL);
+	for (size_t i = 0; i < CANT_LOTES; i++)
+		lote_destruir(tuberia->lotes[i]);
+	if (tuberia->grupo) grupo_destruir(tuberia->grupo);
+	for (size_t i = 0; tuberia->respuestas && i < tuberia->por_lote; i++)
+		if (tuberia->respuestas[i]) salida_destruir(tuberia->respuestas[i]);
+	free(tuberia->respuestas);
+	free(tuberia->ok);
+}
+
+// Crea los canales, los lotes (ya en vacios), el grupo y las respuestas.
+// Devuelve false en caso de error.
+static bool tuberia_preparar(tuberia_t* tuberia, size_t hilos)
+{
+	tuberia->llenos = canal_crear(CANT_LOTES);
+	tuberia->vacios = canal_crear(CANT_LOTES);
+	tuberia->grupo = grupo_crear(hilos - 1);
+	tuberia->respuestas = calloc(tuberia->por_lote, sizeof(salida_t*));
+	tuberia->ok = malloc(tuberia->por_lote * sizeof(bool));
+	if (!tuberia->llenos || !tuberia->vacios || !tuberia->grupo || !tuberia->respuestas || !tuberia->ok)
+		return false;
+	for (size_t i = 0; i < tuberia->por_lote; i++)
+		if (!(tuberia->respuestas[i] = salida_crear_en_memoria(TAM_RESPUESTA))) return false;
+	for (size_t i = 0; i < CANT_LOTES; i++)
+		if (!(tuberia->lotes[i] = lote_crear(tuberia->por_lote)) ||
+			!canal_enviar(tuberia->vacios, tuberia->lotes[i]))
+			return false;
+	return true;
+}
+
+/*                       Fin de f. auxiliares                      *
+ *******************************************************************/
+
+// Ejecuta los comandos de la entrada hasta el final o una linea vacia.
+// Las busquedas seguidas se ejecutan en hasta hilos hilos a la vez, y se
+// leen de a por_lote comandos (con 1, cada comando se ejecuta apenas se
+// lee, como hace falta si la entrada es una terminal).
+// Pre: la entrada y el sistema fueron creados. hilos y por_lote son
+// mayores a 0.
+// Post: Devuelve false si hubo un error y se termino antes.
+bool tuberia_ejecutar(entrada_t* entrada, sistema_t* sistema, size_t hilos, size_t por_lote)
+{
+	tuberia_t tuberia = {entrada, sistema, por_lote, NULL, NULL, {NULL}, NULL, NULL, NULL};
+	pthread_t lector;
+	if (!tuberia_preparar(&tuberia, hilos) || pthread_create(&lector, NULL, leer, &tuberia) != 0)
+	{
+		tuberia_liberar(&tuberia);
+		return false;
+	}
+
+	bool ok = true;
+	lote_t* lote;
+	while (ok && (lote = canal_recibir(tuberia.llenos)))
+	{
+		ok = ejecutar_lote(&tuberia, lote);
+		canal_enviar(tuberia.vacios, lote);
+	}
+	// Si se termina antes, el hilo que lee deja de esperar.
+	canal_cerrar(tuberia.vacios);
+	canal_cerrar(tuberia.llenos);
+	pthread_join(lector, NULL);
+	tuberia_liberar(&tuberia);
+
+	// Los ultimos cambios pueden fallar despues de responder el comando.
+	return ok && sistema_sincronizar(sistema);
+}
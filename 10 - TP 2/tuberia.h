@@ -0,0 +1,30 @@
+#ifndef TUBERIA_H
+#define TUBERIA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "entrada.h"
+#include "sistema.h"
+
+/* ******************************************************************
+ *                    EJECUCION EN TUBERIA
+ * *****************************************************************/
+
+/* La tuberia ejecuta los comandos de la entrada en etapas, cada una en su
+ * hilo: un hilo lee y separa las lineas en lotes de comandos, que le pasa
+ * por un canal al hilo que llama; este ejecuta en orden los comandos que
+ * cambian el twitter (que reparte los cambios de las palabras entre los
+ * hilos de sus fragmentos), y las busquedas seguidas las ejecuta a la vez
+ * en varios hilos. Las respuestas salen en el mismo orden, y los ids son
+ * los mismos, que ejecutando los comandos de a uno. */
+
+// Ejecuta los comandos de la entrada hasta el final o una linea vacia.
+// Las busquedas seguidas se ejecutan en hasta hilos hilos a la vez, y se
+// leen de a por_lote comandos (con 1, cada comando se ejecuta apenas se
+// lee, como hace falta si la entrada es una terminal).
+// Pre: la entrada y el sistema fueron creados. hilos y por_lote son
+// mayores a 0.
+// Post: Devuelve false si hubo un error y se termino antes.
+bool tuberia_ejecutar(entrada_t* entrada, sistema_t* sistema, size_t hilos, size_t por_lote);
+
+#endif //TUBERIA_H
@@ -1,5 +1,4 @@
 #include <stdlib.h>
-#include <stdio.h>
 #include "tweet.h"
 char *strdup(const char *s);
 
@@ -11,6 +10,7 @@ struct tweet{
 	char* mensaje;
 	char* autor;
 	size_t fav;
+	size_t marca_fav;
 	size_t id;
 };
 
@@ -37,6 +37,7 @@ tweet_t* tweet_crear(const char* autor, const char* mensaje, size_t id)
 	tweet->autor = copia_autor;
 	tweet->id = id;
 	tweet->fav = 0;
+	tweet->marca_fav = 0;
 	return tweet;
 }
 
@@ -68,19 +69,33 @@ size_t tweet_id(const tweet_t* tweet)
 	return tweet->id;
 }
 
-// Incrementa en 1 los favoritos del tweet.
+// Devuelve la marca del ultimo favorito del tweet (0 si no tiene).
 // Pre: El tweet fue creado.
-void tweet_incrementar_favorito(tweet_t* tweet)
-{  
+size_t tweet_marca_favorito(const tweet_t* tweet)
+{
+	return tweet->marca_fav;
+}
+
+// Incrementa en 1 los favoritos del tweet y guarda la marca de este
+// favorito, que crece con cada favorito del twitter.
+// Pre: El tweet fue creado.
+void tweet_incrementar_favorito(tweet_t* tweet, size_t marca)
+{
 	tweet->fav++;
+	tweet->marca_fav = marca;
 }
 
-// Imprime el tweet por salida estandar.
+// Escribe el tweet en la salida.
 // Se imprime siguiendo el orden: id, autor, mensaje.
 // Pre: El tweet fue creado.
-void tweet_imprimir(const tweet_t* tweet)
+void tweet_imprimir(const tweet_t* tweet, salida_t* salida)
 {
-	printf("%zu %s %s\n", tweet->id, tweet->autor, tweet->mensaje);
+	salida_numero(salida, tweet->id);
+	salida_caracter(salida, ' ');
+	salida_cadena(salida, tweet->autor);
+	salida_caracter(salida, ' ');
+	salida_cadena(salida, tweet->mensaje);
+	salida_caracter(salida, '\n');
 }
 
 // Destruye el tweet.
@@ -2,6 +2,7 @@
 #define TWEET_H
 
 #include <stdlib.h>
+#include "salida.h"
 
 /*******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS                 *
@@ -34,14 +35,19 @@ size_t tweet_favorito(const tweet_t* tweet);
 // Pre: El tweet fue creado.
 size_t tweet_id(const tweet_t* tweet);
 
-// Incrementa en 1 los favoritos del tweet.
+// Devuelve la marca del ultimo favorito del tweet (0 si no tiene).
 // Pre: El tweet fue creado.
-void tweet_incrementar_favorito(tweet_t* tweet);
+size_t tweet_marca_favorito(const tweet_t* tweet);
 
-// Imprime el tweet por salida estandar.
+// Incrementa en 1 los favoritos del tweet y guarda la marca de este
+// favorito, que crece con cada favorito del twitter.
+// Pre: El tweet fue creado.
+void tweet_incrementar_favorito(tweet_t* tweet, size_t marca);
+
+// Escribe el tweet en la salida.
 // Se imprime siguiendo el orden: id, autor, mensaje.
 // Pre: El tweet fue creado.
-void tweet_imprimir(const tweet_t* tweet);
+void tweet_imprimir(const tweet_t* tweet, salida_t* salida);
 
 // Destruye el tweet.
 // Pre: El tweet fue creado.
@@ -1,24 +1,71 @@
 #include <stdbool.h>
-#include <stdio.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include "twitter.h"
 #include "tweet.h"
+#include "fragmento.h"
+#include "repartidor.h"
+#include "grupo.h"
+#include "consulta.h"
 #include "heap.h"
-#include "hash.h"
-#include "lista.h"
+#include "arreglo.h"
 
 #define TAM_INICIAL 100
+// Palabras de un tweet que entran en la pila sin pedir memoria (un mensaje
+// de 150 caracteres tiene a lo sumo 77, contando al autor).
+#define PALABRAS_EN_PILA 80
 
 /* ******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS
  * *****************************************************************/
 
+// Una palabra (usuario o hashtag) de un tweet, que no termina en '\0'.
+typedef struct clave
+{
+	const char* inicio;
+	size_t largo;
+} clave_t;
+
+// Las palabras distintas de un tweet, en la pila si entran.
+typedef struct claves
+{
+	clave_t* vector;
+	size_t cantidad;
+	clave_t en_pila[PALABRAS_EN_PILA];
+} claves_t;
+
+// Donde esta un tweet con favoritos en el ranking de cada una de sus
+// palabras, y en que fragmento esta cada palabra.
+typedef struct rankeada
+{
+	size_t fragmento;
+	ubicacion_t ubicacion;
+} rankeada_t;
+
+typedef struct ubicaciones
+{
+	size_t cantidad;
+	rankeada_t palabra[];
+} ubicaciones_t;
+
+// Las palabras estan repartidas en fragmentos. Si hay repartidor, cada
+// fragmento se modifica en su propio hilo; si no, en el que llama. Si hay
+// grupo, las busquedas de varios terminos recorren los fragmentos en
+// paralelo. marcas cuenta las veces que subio la cantidad de tweets de
+// alguna palabra, para desempatar el autocompletar entre fragmentos, y
+// favoritos los favoritos dados, para desempatar las busquedas populares
+// de varios terminos como los rankings.
+// Los tweets no se reparten: su id es su posicion en twits.
 struct twitter {
-	hash_t* palabras;
-	tweet_t** twits;
-	size_t tam_twits;
-	size_t cant_twits;
+	fragmento_t** fragmentos;
+	size_t cant_fragmentos;
+	repartidor_t* repartidor;
+	grupo_t* grupo;
+	arreglo_t* twits; // de tweet_t*, el id de cada tweet es su posicion
+	arreglo_t* rankeados; // de ubicaciones_t*, por id; NULL sin favoritos
+	size_t marcas;
+	size_t favoritos;
 };
 
 /* ******************************************************************
@@ -28,91 +75,186 @@ struct twitter {
  /*******************************************************************
  *                       Funciones auxiliares                      */
 
-// Redimensiona el arreglo de twits. Devuelve bool.
-// Pre: Los twits fueron creados.
-// Post: tam_nuevo es el nuevo tamaño del arreglo de twits.
-static bool _redimensionar_twits(twitter_t* twitter, size_t tam_nuevo)
+// Devuelve el fragmento de la clave de largo caracteres.
+static size_t elegir_fragmento(const twitter_t* twitter, const char* clave, size_t largo)
+{
+	if (twitter->cant_fragmentos == 1) return 0;
+	// FNV-1a, que no se parece a la funcion del hash: si fueran la misma,
+	// las claves de cada fragmento caerian siempre en las mismas listas.
+	uint64_t h = 14695981039346656037ULL;
+	for (size_t i = 0; i < largo; i++)
+	{
+		h ^= (unsigned char)clave[i];
+		h *= 1099511628211ULL;
+	}
+	return (size_t)(h % twitter->cant_fragmentos);
+}
+
+// Aplica el cambio en el fragmento, o se lo manda a su hilo.
+// Devuelve false en caso de error.
+static bool aplicar(twitter_t* twitter, size_t fragmento, const cambio_t* cambio)
+{
+	if (twitter->repartidor) return repartidor_enviar(twitter->repartidor, fragmento, cambio);
+	return fragmento_aplicar(twitter->fragmentos[fragmento], cambio);
+}
+
+// Devuelve la palabra con la clave, o NULL si no existe.
+static const palabra_t* buscar_palabra(const twitter_t* twitter, const char* clave)
+{
+	return fragmento_buscar(twitter->fragmentos[elegir_fragmento(twitter, clave, strlen(clave))], clave);
+}
+
+// Devuelve el comienzo de la proxima palabra de *resto que sea un usuario
+// o un hashtag, y guarda su largo en largo; NULL si no hay mas. Deja *resto
+// despues de la palabra. A diferencia de strtok, no modifica el texto.
+static const char* proxima_palabra(const char** resto, size_t* largo)
+{
+	const char* actual = *resto;
+	while (*actual)
+	{
+		while (*actual == ' ') actual++;
+		const char* fin = actual;
+		while (*fin && *fin != ' ') fin++;
+		if (fin > actual && (*actual == '@' || *actual == '#'))
+		{
+			*resto = fin;
+			*largo = (size_t)(fin - actual);
+			return actual;
+		}
+		actual = fin;
+	}
+	*resto = actual;
+	return NULL;
+}
+
+// Agrega la clave a claves si no estaba.
+static void agregar_sin_repetir(claves_t* claves, const char* inicio, size_t largo)
+{
+	for (size_t i = 0; i < claves->cantidad; i++)
+		if (claves->vector[i].largo == largo && memcmp(claves->vector[i].inicio, inicio, largo) == 0)
+			return;
+	claves->vector[claves->cantidad].inicio = inicio;
+	claves->vector[claves->cantidad].largo = largo;
+	claves->cantidad++;
+}
+
+// Junta en claves, sin repetir, las palabras del tweet: el autor y los
+// usuarios y hashtags del mensaje, recorriendolo una sola vez. Las claves
+// apuntan al autor y al mensaje. Hay que liberarlas con liberar_claves.
+// Devuelve false en caso de error.
+static bool juntar_claves(claves_t* claves, const char* autor, const char* mensaje)
 {
-	tweet_t** twits_nuevo = realloc(twitter->twits, tam_nuevo * sizeof(tweet_t*));
-	if (!twits_nuevo) return false;
+	// A lo sumo hay una palabra cada dos caracteres, mas el autor.
+	size_t maximo = strlen(mensaje) / 2 + 2;
+	claves->vector = maximo <= PALABRAS_EN_PILA ? claves->en_pila : malloc(maximo * sizeof(clave_t));
+	if (!claves->vector) return false;
+	claves->cantidad = 0;
 
-	twitter->twits = twits_nuevo;
-	twitter->tam_twits = tam_nuevo;
+	agregar_sin_repetir(claves, autor, strlen(autor));
+	size_t largo;
+	for (const char* inicio = proxima_palabra(&mensaje, &largo); inicio; inicio = proxima_palabra(&mensaje, &largo))
+		agregar_sin_repetir(claves, inicio, largo);
 	return true;
 }
 
-// Funcion de destruccion de listas sin destruir los elementos de la misma.
-static void wrapper_lista_destruir(void* lista)
+static void liberar_claves(claves_t* claves)
 {
-	lista_destruir((lista_t*)lista, NULL);
+	if (claves->vector != claves->en_pila) free(claves->vector);
 }
 
-// Agregara al hash, con la palabra como clave, el tweet.
-// Si es necesario creará la lista y, si la lista ya existia,
-// comprobará si el tweet ya se encontraba para no repetirlo.
+// Agrega el tweet, que acaba de recibir su primer favorito, al ranking de
+// cada una de sus palabras, y guarda en *ubicaciones donde quedo en cada
+// uno (cuando se apliquen los cambios).
 // Devuelve false en caso de error.
-static bool agregar_al_hash_sin_repetir(hash_t* palabras, char* palabra, tweet_t* tweet)
+static bool rankear(twitter_t* twitter, const tweet_t* tweet, ubicaciones_t** ubicaciones)
 {
-	lista_t* lista_de_tweets = hash_obtener(palabras, palabra);
-	if (!lista_de_tweets)
+	claves_t claves;
+	if (!juntar_claves(&claves, tweet_autor(tweet), tweet_mensaje(tweet))) return false;
+	*ubicaciones = malloc(sizeof(ubicaciones_t) + claves.cantidad * sizeof(rankeada_t));
+	if (!*ubicaciones)
 	{
-		lista_de_tweets = lista_crear();
-		if (!lista_de_tweets) return false;
-		hash_guardar(palabras, palabra, (void*)lista_de_tweets);
+		liberar_claves(&claves);
+		return false;
 	}
-	else // ya existia (si o si tiene algo), verificar por repeticion.
-		if ((tweet_t*)lista_ver_primero(lista_de_tweets) == tweet) return true;
 
-	if (!lista_insertar_primero(lista_de_tweets, (void*)tweet)) return false;
-	return true;
+	(*ubicaciones)->cantidad = claves.cantidad;
+	bool ok = true;
+	for (size_t i = 0; ok && i < claves.cantidad; i++)
+	{
+		rankeada_t* rankeada = &(*ubicaciones)->palabra[i];
+		rankeada->fragmento = elegir_fragmento(twitter, claves.vector[i].inicio, claves.vector[i].largo);
+		rankeada->ubicacion.ranking = NULL;
+		cambio_t cambio = {CAMBIO_FAVORITO, claves.vector[i].inicio, claves.vector[i].largo, tweet_id(tweet), 0, &rankeada->ubicacion};
+		ok = aplicar(twitter, rankeada->fragmento, &cambio);
+	}
+	liberar_claves(&claves);
+	return ok;
 }
 
-// Pensado para utilizar con lista_iterar.
-// Imprimira el tweet por salida estandar si la cantidad es mayor a 0.
-// Si la cantidad es 0, devolvera false para terminar la iteracion.
-// En cambio disminuira en 1 la cantidad y devolvera true.
-static bool imprimir_tweets(tweet_t* tweet, size_t* cantidad)
+// Escribe "OK numero" en la salida.
+static void imprimir_ok(salida_t* salida, size_t numero)
 {
-	if (!((*cantidad)--)) return false;
-	tweet_imprimir(tweet);
-	return true;
+	salida_cadena(salida, "OK ");
+	salida_numero(salida, numero);
+	salida_caracter(salida, '\n');
 }
 
-// Funcion de comparacion para el heap. (especificamente heap_min)
-// Recibe punteros a tweet y compara los favoritos de cada uno.
-// Devuelve positivo si A es menor a B, 0 si son iguales
-// y negativo si A es mayor a B.
-static int comparar_favoritos(const tweet_t* tweet_A, const tweet_t* tweet_B)
+// Devuelve el tweet con el id recibido.
+// Pre: el id es de un tweet del twitter.
+static tweet_t* ver_tweet(const twitter_t* twitter, size_t id)
 {
-	return (long)tweet_favorito(tweet_B) - (long)tweet_favorito(tweet_A);
+	return ARREGLO_VER(twitter->twits, tweet_t*, id);
 }
 
 /*                       Fin de f. auxiliares                      *
  *******************************************************************/
 
-// Crea el twitter.
+// Crea el twitter, con todas las palabras en un solo fragmento.
 // Post: Devuelve el twitter o NULL en caso de error.
 twitter_t* twitter_crear()
+{
+	return twitter_crear_con_fragmentos(1, false);
+}
+
+// Crea el twitter con las palabras repartidas en cant_fragmentos
+// fragmentos. Si en_paralelo es true, cada fragmento se modifica en un
+// hilo propio, y los cambios recien se ven despues de twitter_sincronizar.
+// Pre: cant_fragmentos esta entre 1 y TWITTER_MAX_FRAGMENTOS.
+// Post: Devuelve el twitter o NULL en caso de error.
+twitter_t* twitter_crear_con_fragmentos(size_t cant_fragmentos, bool en_paralelo)
 {
 	twitter_t* twitter = malloc(sizeof(twitter_t));
-	tweet_t** twits = malloc(TAM_INICIAL * sizeof(tweet_t*));
-	if (!twitter || !twits){
+	fragmento_t** fragmentos = calloc(cant_fragmentos, sizeof(fragmento_t*));
+	arreglo_t* twits = arreglo_crear_con_capacidad(sizeof(tweet_t*), TAM_INICIAL);
+	arreglo_t* rankeados = arreglo_crear_con_capacidad(sizeof(ubicaciones_t*), TAM_INICIAL);
+	if (!twitter || !fragmentos || !twits || !rankeados){
 		free(twitter);
-		free(twits);
+		free(fragmentos);
+		if (twits) arreglo_destruir(twits, NULL);
+		if (rankeados) arreglo_destruir(rankeados, NULL);
 		return NULL;
 	}
 
-	hash_t* palabras = hash_crear(wrapper_lista_destruir);
-	if (!palabras){
-		free(twitter);
-		free(twits);
+	twitter->fragmentos = fragmentos;
+	twitter->cant_fragmentos = cant_fragmentos;
+	twitter->repartidor = NULL;
+	twitter->grupo = NULL;
+	twitter->twits = twits;
+	twitter->rankeados = rankeados;
+	twitter->marcas = 0;
+	twitter->favoritos = 0;
+	for (size_t i = 0; i < cant_fragmentos; i++)
+		if (!(fragmentos[i] = fragmento_crear()))
+		{
+			twitter_destruir(twitter);
+			return NULL;
+		}
+	if (en_paralelo && (!(twitter->repartidor = repartidor_crear(fragmentos, cant_fragmentos)) ||
+		!(twitter->grupo = grupo_crear(cant_fragmentos - 1))))
+	{
+		twitter_destruir(twitter);
 		return NULL;
 	}
-
-	twitter->twits = twits;
-	twitter->tam_twits = TAM_INICIAL;
-	twitter->cant_twits = 0;
-	twitter->palabras = palabras;
 	return twitter;
 }
 
@@ -120,124 +262,528 @@ twitter_t* twitter_crear()
 // Pre: Twitter fue creado.
 void twitter_destruir(twitter_t* twitter)
 {
-	for (size_t i = 0; i < twitter->cant_twits; i++) tweet_destruir(twitter->twits[i]);
-	hash_destruir(twitter->palabras);
-	free(twitter->twits);
+	// Primero terminan los hilos, que pueden estar usando lo demas.
+	if (twitter->repartidor) repartidor_destruir(twitter->repartidor);
+	if (twitter->grupo) grupo_destruir(twitter->grupo);
+	for (size_t i = 0; i < arreglo_largo(twitter->twits); i++)
+	{
+		tweet_destruir(ARREGLO_VER(twitter->twits, tweet_t*, i));
+		free(ARREGLO_VER(twitter->rankeados, ubicaciones_t*, i));
+	}
+	for (size_t i = 0; i < twitter->cant_fragmentos; i++)
+		if (twitter->fragmentos[i]) fragmento_destruir(twitter->fragmentos[i]);
+	free(twitter->fragmentos);
+	arreglo_destruir(twitter->twits, NULL);
+	arreglo_destruir(twitter->rankeados, NULL);
 	free(twitter);
 }
 
-// Crea un nuevo tweet con el autor y mensaje especificado.
+// Si los fragmentos se modifican en paralelo, espera a que se apliquen
+// todos los cambios. Las busquedas solo ven lo sincronizado, y hasta el
+// proximo cambio se pueden hacer desde varios hilos a la vez.
 // Pre: Twitter fue creado.
-// Post: Devuelve false en caso de error.
-bool twitter_twittear(twitter_t* twitter, char* autor, char* mensaje)
+// Post: Devuelve false si fallo algun cambio.
+bool twitter_sincronizar(twitter_t* twitter)
+{
+	return !twitter->repartidor || repartidor_esperar(twitter->repartidor);
+}
+
+// Como twitter_sincronizar, pero solo espera a los cambios del fragmento
+// de la palabra formada por los primeros largo caracteres de clave. Alcanza
+// para buscarla; los demas fragmentos pueden seguir cambiando mientras.
+// Pre: Twitter fue creado.
+// Post: Devuelve false si fallo algun cambio de ese fragmento.
+bool twitter_sincronizar_palabra(twitter_t* twitter, const char* clave, size_t largo)
 {
-	if (twitter->cant_twits == twitter->tam_twits) 
-		if (!_redimensionar_twits(twitter, twitter->tam_twits * 3)) return false;
+	return !twitter->repartidor ||
+		repartidor_esperar_fragmento(twitter->repartidor, elegir_fragmento(twitter, clave, largo));
+}
 
-	size_t id = twitter->cant_twits++;
+// Crea un nuevo tweet con el autor y mensaje especificado, y escribe su id
+// en la salida.
+// Pre: Twitter fue creado.
+// Post: Devuelve false en caso de error.
+bool twitter_twittear(twitter_t* twitter, const char* autor, const char* mensaje, salida_t* salida)
+{
+	size_t id = arreglo_largo(twitter->twits);
 	tweet_t* tweet = tweet_crear(autor, mensaje, id);
 	if (!tweet) return false;
+	ubicaciones_t* sin_favoritos = NULL;
+	if (!arreglo_agregar(twitter->twits, &tweet)){
+		tweet_destruir(tweet);
+		return false;
+	}
+	if (!arreglo_agregar(twitter->rankeados, &sin_favoritos)){
+		arreglo_sacar(twitter->twits, NULL);
+		tweet_destruir(tweet);
+		return false;
+	}
 
-	if (!agregar_al_hash_sin_repetir(twitter->palabras, autor, tweet)) return false;
-	char* palabra = strtok(mensaje, " ");
-	while (palabra)
+	// Las claves apuntan a las copias del tweet, que duran lo que el
+	// twitter: los cambios pueden aplicarse despues, en otro hilo.
+	claves_t claves;
+	if (!juntar_claves(&claves, tweet_autor(tweet), tweet_mensaje(tweet))) return false;
+	bool ok = true;
+	for (size_t i = 0; ok && i < claves.cantidad; i++)
 	{
-		if (palabra[0] == '@' || palabra[0] == '#')
-			if (!agregar_al_hash_sin_repetir(twitter->palabras, palabra, tweet))
-				return false;
-		palabra = strtok(NULL, " ");
+		cambio_t cambio = {CAMBIO_TWEET, claves.vector[i].inicio, claves.vector[i].largo, id, twitter->marcas++, NULL};
+		ok = aplicar(twitter, elegir_fragmento(twitter, cambio.clave, cambio.largo), &cambio);
 	}
+	liberar_claves(&claves);
+	if (!ok) return false;
 
-	twitter->twits[id] = tweet;
-	printf("OK %zu\n", id);
+	imprimir_ok(salida, id);
 	return true;
 }
 
-// Incrementa la cantida de favoritos del tweet con el id especficado.
+// Devuelve la cantidad de tweets (el proximo id).
 // Pre: Twitter fue creado.
-// Post: Devuelve false en caso de ser un id invalido.
-bool twitter_favorito(twitter_t* twitter, size_t id)
+size_t twitter_cantidad(const twitter_t* twitter)
+{
+	return arreglo_largo(twitter->twits);
+}
+
+// Incrementa la cantida de favoritos del tweet con el id especficado, y
+// escribe el id en la salida. El tweet sube en el ranking de cada una de
+// sus palabras.
+// Pre: Twitter fue creado. id es menor a la cantidad de tweets.
+// Post: Devuelve false en caso de error.
+bool twitter_favorito(twitter_t* twitter, size_t id, salida_t* salida)
 {
-	if (id >= twitter->cant_twits) return false;
-	tweet_incrementar_favorito(twitter->twits[id]);
-	printf("OK %zu\n", id);
+	tweet_t* tweet = ver_tweet(twitter, id);
+	ubicaciones_t** ubicaciones = arreglo_ver(twitter->rankeados, id);
+	tweet_incrementar_favorito(tweet, ++twitter->favoritos);
+
+	if (!*ubicaciones)
+	{
+		if (!rankear(twitter, tweet, ubicaciones)) return false;
+	}
+	else
+		for (size_t i = 0; i < (*ubicaciones)->cantidad; i++)
+		{
+			rankeada_t* rankeada = &(*ubicaciones)->palabra[i];
+			cambio_t cambio = {CAMBIO_FAVORITO, NULL, 0, id, 0, &rankeada->ubicacion};
+			if (!aplicar(twitter, rankeada->fragmento, &cambio)) return false;
+		}
+
+	imprimir_ok(salida, id);
 	return true;
 }
 
-// Lleva a cabo la busqueda cronologica del termino especificado.
-// Recibe el usuario o hashtag a buscar y la cantidad de resultados.
-// Si cantidad es 0 se listaran todos los resultados.
-// Imprimira por salida estandar los resultados en sentido cronologico.
-// Pre: Twitter fue creado.
-void twitter_buscar_cronologico(twitter_t* twitter, char* busqueda, size_t cantidad)
+// Busqueda cronologica de una sola palabra (NULL si no existe).
+// Devuelve false en caso de error.
+static bool cronologico_palabra(twitter_t* twitter, const palabra_t* palabra, size_t cantidad, salida_t* salida)
 {
-	lista_t* lista = hash_obtener(twitter->palabras, busqueda);
-	if (lista){
-		size_t max_cant = (cantidad == 0 || cantidad > lista_largo(lista))? lista_largo(lista): cantidad;
-		printf("OK %zu\n", max_cant);
-		lista_iterar(lista, (bool(*)(void*, void*))imprimir_tweets, &max_cant);
+	if (!palabra){
+		imprimir_ok(salida, 0);
+		return true;
 	}
-	else printf("OK 0\n");
+	const posteos_t* posteos = palabra_posteos(palabra);
+	size_t max_cant = (cantidad == 0 || cantidad > posteos_cantidad(posteos))? posteos_cantidad(posteos): cantidad;
+
+	posteos_cursor_t* cursor = posteos_cursor_crear(posteos);
+	if (!cursor) return false;
+
+	imprimir_ok(salida, max_cant);
+	for (size_t i = 0; i < max_cant; i++, posteos_cursor_avanzar(cursor))
+		tweet_imprimir(ver_tweet(twitter, posteos_cursor_ver_actual(cursor)), salida);
+	posteos_cursor_destruir(cursor);
+	return true;
 }
 
-// Lleva a cabo la busqueda por popularidad del termino especificado.
-// Recibe el usuario o hashtag a buscar y la cantidad de resultados.
-// Si cantidad es 0 se listaran todos los resultados.
-// Imprimira por salida estandar los resultados de mayor a menor en popularidad.
-// Pre: Twitter fue creado.
-// Post: Devuelve false en caso de error.
-bool twitter_buscar_popular(twitter_t* twitter, char* busqueda, size_t cantidad)
+// Busqueda por popularidad de una sola palabra (NULL si no existe).
+// Usa el ranking de la palabra: cuesta O(cantidad), sin recorrer el resto.
+// Devuelve false en caso de error.
+static bool popular_palabra(twitter_t* twitter, const palabra_t* palabra, size_t cantidad, salida_t* salida)
 {
-	lista_t* lista = hash_obtener(twitter->palabras, busqueda);
-	if (!lista){
-		printf("OK 0\n");
+	if (!palabra){
+		imprimir_ok(salida, 0);
 		return true;
 	}
-	size_t max_cant = (cantidad == 0 || cantidad > lista_largo(lista))? lista_largo(lista): cantidad;
+	const posteos_t* posteos = palabra_posteos(palabra);
+	const ranking_t* ranking = palabra_ranking(palabra);
+	size_t total = posteos_cantidad(posteos);
+	size_t max_cant = (cantidad == 0 || cantidad > total)? total: cantidad;
 
-	lista_iter_t* iter = lista_iter_crear(lista);
-	if (!iter) return false;
+	// Primero los que tienen favoritos, de su ranking.
+	size_t rankeados = ranking ? ranking_cantidad(ranking) : 0;
+	size_t del_ranking = max_cant < rankeados ? max_cant : rankeados;
 
-	heap_t* heap = heap_crear((int(*)(const void*, const void*))comparar_favoritos);
-	if (!heap){
-		lista_iter_destruir(iter);
-		return false;
+	// Despues, si faltan, los que no tienen (del mas nuevo al mas viejo).
+	posteos_cursor_t* cursor = NULL;
+	if (del_ranking < max_cant)
+	{
+		cursor = posteos_cursor_crear(posteos);
+		if (!cursor) return false;
 	}
 
-	for (size_t i = 0; !lista_iter_al_final(iter); i++, lista_iter_avanzar(iter))
+	imprimir_ok(salida, max_cant);
+	const ranking_ref_t* ref = del_ranking > 0 ? ranking_primero(ranking) : NULL;
+	for (size_t i = 0; i < del_ranking; i++, ref = ranking_siguiente(ref))
+		tweet_imprimir(ver_tweet(twitter, ranking_ref_id(ref)), salida);
+
+	for (size_t i = del_ranking; i < max_cant; posteos_cursor_avanzar(cursor))
 	{
-		if (i >= max_cant) // Comparar con el tope
-		{
-			tweet_t* tweet = lista_iter_ver_actual(iter);
-			if (tweet_favorito(tweet) > tweet_favorito((tweet_t*)heap_ver_max(heap)))
-				heap_desencolar(heap);
-			else
-				continue;
-		}
-		if (!heap_encolar(heap, lista_iter_ver_actual(iter)))
+		tweet_t* tweet = ver_tweet(twitter, posteos_cursor_ver_actual(cursor));
+		if (tweet_favorito(tweet) > 0) continue;
+		tweet_imprimir(tweet, salida);
+		i++;
+	}
+	if (cursor) posteos_cursor_destruir(cursor);
+	return true;
+}
+
+// Funcion de comparacion para el heap de popular_consulta, que deja arriba
+// al menos popular segun el orden de twitter_buscar_popular. Que el ultimo
+// favorito de un tweet sea anterior es que llego antes a su cantidad, como
+// en el ranking de cada palabra.
+// Devuelve positivo si A es menos popular que B, 0 si son el mismo tweet
+// y negativo si A es mas popular.
+static int comparar_popularidad(const void* a, const void* b)
+{
+	size_t fav_a = tweet_favorito(a), fav_b = tweet_favorito(b);
+	if (fav_a != fav_b) return fav_a < fav_b ? 1 : -1;
+	if (fav_a > 0)
+	{
+		size_t marca_a = tweet_marca_favorito(a), marca_b = tweet_marca_favorito(b);
+		return (marca_a > marca_b) - (marca_a < marca_b);
+	}
+	size_t id_a = tweet_id(a), id_b = tweet_id(b);
+	return (id_a < id_b) - (id_a > id_b);
+}
+
+// Recorre todos los resultados de la consulta y deja en el heap (de
+// comparar_popularidad) los cantidad mas populares, o todos si cantidad es
+// 0.
+// Devuelve false en caso de error.
+static bool juntar_populares(const twitter_t* twitter, consulta_t* consulta, size_t cantidad, heap_t* heap)
+{
+	size_t id;
+	while (consulta_siguiente(consulta, &id))
+	{
+		tweet_t* tweet = ver_tweet(twitter, id);
+		if (cantidad > 0 && heap_cantidad(heap) == cantidad)
 		{
-			lista_iter_destruir(iter);
-			heap_destruir(heap, NULL);
-			return false;
+			if (comparar_popularidad(heap_ver_max(heap), tweet) <= 0) continue;
+			heap_desencolar(heap);
 		}
+		if (!heap_encolar(heap, tweet)) return false;
 	}
-	lista_iter_destruir(iter);
+	return !consulta_fallo(consulta);
+}
 
-	tweet_t** populares = malloc(max_cant * sizeof(tweet_t*));
-	if (!populares){
+// Busqueda por popularidad de varios terminos. Los favoritos no siguen el
+// orden de los ids, asi que se recorren todos los resultados de la
+// consulta, quedandose con los cantidad mejores en un heap.
+// Devuelve false en caso de error.
+static bool popular_consulta(twitter_t* twitter, consulta_t* consulta, size_t cantidad, salida_t* salida)
+{
+	heap_t* heap = heap_crear(comparar_popularidad);
+	if (!heap) return false;
+	if (!juntar_populares(twitter, consulta, cantidad, heap))
+	{
 		heap_destruir(heap, NULL);
 		return false;
 	}
 
-	for (size_t i = max_cant; i--;)
+	size_t total = heap_cantidad(heap);
+	tweet_t** populares = malloc(total * sizeof(tweet_t*));
+	if (total > 0 && !populares)
+	{
+		heap_destruir(heap, NULL);
+		return false;
+	}
+	for (size_t i = total; i--;)
 		populares[i] = heap_desencolar(heap);
-	
-	printf("OK %zu\n", max_cant);
-	for (size_t i = 0; i < max_cant; i++)
-		tweet_imprimir(populares[i]);
+
+	imprimir_ok(salida, total);
+	for (size_t i = 0; i < total; i++)
+		tweet_imprimir(populares[i], salida);
 
 	heap_destruir(heap, NULL);
 	free(populares);
 	return true;
 }
 
+// Busqueda cronologica de varios terminos: se corta apenas la consulta
+// dio cantidad resultados.
+// Devuelve false en caso de error.
+static bool cronologico_consulta(twitter_t* twitter, consulta_t* consulta, size_t cantidad, salida_t* salida)
+{
+	arreglo_t* ids = arreglo_crear(sizeof(size_t));
+	if (!ids) return false;
+
+	size_t id;
+	bool ok = true;
+	while (ok && (cantidad == 0 || arreglo_largo(ids) < cantidad) && consulta_siguiente(consulta, &id))
+		ok = arreglo_agregar(ids, &id);
+	if (!ok || consulta_fallo(consulta))
+	{
+		arreglo_destruir(ids, NULL);
+		return false;
+	}
+
+	imprimir_ok(salida, arreglo_largo(ids));
+	for (size_t i = 0; i < arreglo_largo(ids); i++)
+		tweet_imprimir(ver_tweet(twitter, ARREGLO_VER(ids, size_t, i)), salida);
+	arreglo_destruir(ids, NULL);
+	return true;
+}
+
+// Una parte de una busqueda repartida: las listas de los terminos de un
+// fragmento, y sus cantidad resultados mas populares.
+typedef struct parte
+{
+	const posteos_t** listas;
+	size_t cant_listas;
+	tweet_t** populares;
+	size_t cantidad;
+	bool ok;
+} parte_t;
+
+// Lo que comparten las tareas de una busqueda repartida.
+typedef struct reparto
+{
+	const twitter_t* twitter;
+	parte_t* partes;
+	size_t cantidad;
+} reparto_t;
+
+// Tarea del grupo: busca los mas populares de la parte numero indice.
+static void popular_parte(size_t indice, void* extra)
+{
+	reparto_t* reparto = extra;
+	parte_t* parte = &reparto->partes[indice];
+	parte->ok = false;
+	consulta_t* consulta = consulta_crear(parte->listas, parte->cant_listas, OPERADOR_O);
+	heap_t* heap = heap_crear(comparar_popularidad);
+	if (consulta && heap && juntar_populares(reparto->twitter, consulta, reparto->cantidad, heap))
+	{
+		parte->cantidad = heap_cantidad(heap);
+		parte->populares = malloc(parte->cantidad * sizeof(tweet_t*));
+		parte->ok = parte->cantidad == 0 || parte->populares;
+		for (size_t i = 0; parte->ok && i < parte->cantidad; i++)
+			parte->populares[i] = heap_desencolar(heap);
+	}
+	if (consulta) consulta_destruir(consulta);
+	if (heap) heap_destruir(heap, NULL);
+}
+
+// Funcion de comparacion de qsort para tweet_t*: del mas popular al menos.
+static int comparar_populares(const void* a, const void* b)
+{
+	return comparar_popularidad(*(tweet_t* const*)a, *(tweet_t* const*)b);
+}
+
+// Escribe los cantidad mas populares de todas las partes. Un tweet que
+// esta en varias partes aparece una vez en cada una.
+// Devuelve false en caso de error.
+static bool juntar_partes(parte_t* partes, size_t cant_partes, size_t cantidad, salida_t* salida)
+{
+	size_t total = 0;
+	for (size_t i = 0; i < cant_partes; i++)
+		total += partes[i].cantidad;
+	tweet_t** populares = malloc(total * sizeof(tweet_t*));
+	if (total > 0 && !populares) return false;
+	total = 0;
+	for (size_t i = 0; i < cant_partes; i++)
+	{
+		memcpy(populares + total, partes[i].populares, partes[i].cantidad * sizeof(tweet_t*));
+		total += partes[i].cantidad;
+	}
+
+	// Ordenados, las copias de un tweet quedan juntas.
+	if (total > 0) qsort(populares, total, sizeof(tweet_t*), comparar_populares);
+	size_t distintos = 0;
+	for (size_t i = 0; i < total && (cantidad == 0 || distintos < cantidad); i++)
+		if (distintos == 0 || populares[distintos - 1] != populares[i])
+			populares[distintos++] = populares[i];
+
+	imprimir_ok(salida, distintos);
+	for (size_t i = 0; i < distintos; i++)
+		tweet_imprimir(populares[i], salida);
+	free(populares);
+	return true;
+}
+
+// Busqueda por popularidad de varios terminos unidos por OPERADOR_O,
+// repartida entre los fragmentos: cada uno busca en paralelo los cantidad
+// mas populares de sus terminos, y despues se juntan. Como cada parte es
+// un subconjunto del resultado, los mejores del total estan entre los
+// mejores de alguna parte. Con todos los terminos en un fragmento es
+// popular_consulta.
+// Pre: cant_listas es mayor a 0. fragmentos tiene el fragmento de cada
+// lista.
+// Devuelve false en caso de error.
+static bool popular_repartida(twitter_t* twitter, const posteos_t** listas, const size_t* fragmentos, size_t cant_listas, size_t cantidad, salida_t* salida)
+{
+	// Se juntan las listas de cada fragmento; cada fragmento con alguna es
+	// una parte (hay a lo sumo una por lista).
+	const posteos_t** ordenadas = malloc(cant_listas * sizeof(posteos_t*));
+	parte_t* partes = malloc(cant_listas * sizeof(parte_t));
+	if (!ordenadas || !partes)
+	{
+		free(ordenadas);
+		free(partes);
+		return false;
+	}
+	size_t cant_partes = 0, usadas = 0;
+	for (size_t f = 0; f < twitter->cant_fragmentos && usadas < cant_listas; f++)
+	{
+		parte_t* parte = &partes[cant_partes];
+		parte->listas = &ordenadas[usadas];
+		parte->cant_listas = 0;
+		parte->populares = NULL;
+		parte->cantidad = 0;
+		for (size_t i = 0; i < cant_listas; i++)
+			if (fragmentos[i] == f)
+			{
+				ordenadas[usadas++] = listas[i];
+				parte->cant_listas++;
+			}
+		if (parte->cant_listas > 0) cant_partes++;
+	}
+
+	bool ok = true;
+	if (cant_partes == 1)
+	{
+		consulta_t* consulta = consulta_crear(listas, cant_listas, OPERADOR_O);
+		ok = consulta && popular_consulta(twitter, consulta, cantidad, salida);
+		if (consulta) consulta_destruir(consulta);
+	}
+	else
+	{
+		reparto_t reparto = {twitter, partes, cantidad};
+		grupo_ejecutar(twitter->grupo, cant_partes, popular_parte, &reparto);
+		for (size_t i = 0; i < cant_partes; i++)
+			ok &= partes[i].ok;
+		ok = ok && juntar_partes(partes, cant_partes, cantidad, salida);
+	}
+	for (size_t i = 0; i < cant_partes; i++)
+		free(partes[i].populares);
+	free(partes);
+	free(ordenadas);
+	return ok;
+}
+
+// Arma la consulta de los terminos y la pasa a buscar. Los terminos que no
+// existen no tienen resultados: con OPERADOR_Y la consulta es vacia, y con
+// OPERADOR_O se ignoran. Si hay grupo, la busqueda popular con OPERADOR_O
+// se reparte entre los fragmentos (ver popular_repartida); la cronologica
+// no, porque corta apenas tiene cantidad resultados, y la de OPERADOR_Y
+// tampoco, porque cada termino acota a los demas.
+// Devuelve false en caso de error.
+static bool buscar_varios(twitter_t* twitter, char** terminos, size_t cant_terminos, operador_t operador, size_t cantidad, salida_t* salida,
+			bool buscar(twitter_t*, consulta_t*, size_t, salida_t*))
+{
+	const posteos_t** listas = malloc(cant_terminos * sizeof(posteos_t*));
+	size_t* fragmentos = malloc(cant_terminos * sizeof(size_t));
+	if (!listas || !fragmentos)
+	{
+		free(listas);
+		free(fragmentos);
+		return false;
+	}
+
+	size_t cant_listas = 0;
+	for (size_t i = 0; i < cant_terminos; i++)
+	{
+		size_t fragmento = elegir_fragmento(twitter, terminos[i], strlen(terminos[i]));
+		const palabra_t* palabra = fragmento_buscar(twitter->fragmentos[fragmento], terminos[i]);
+		if (palabra)
+		{
+			fragmentos[cant_listas] = fragmento;
+			listas[cant_listas++] = palabra_posteos(palabra);
+		}
+		else if (operador == OPERADOR_Y)
+		{
+			cant_listas = 0;
+			break;
+		}
+	}
+
+	bool ok = true;
+	if (cant_listas == 0)
+		imprimir_ok(salida, 0);
+	else if (operador == OPERADOR_O && twitter->grupo && buscar == popular_consulta)
+		ok = popular_repartida(twitter, listas, fragmentos, cant_listas, cantidad, salida);
+	else
+	{
+		consulta_t* consulta = consulta_crear(listas, cant_listas, operador);
+		ok = consulta && buscar(twitter, consulta, cantidad, salida);
+		if (consulta) consulta_destruir(consulta);
+	}
+	free(listas);
+	free(fragmentos);
+	return ok;
+}
+
+// Lleva a cabo la busqueda cronologica de los terminos especificados.
+// Recibe los usuarios o hashtags a buscar, como se combinan (si hay mas de
+// uno) y la cantidad de resultados.
+// Si cantidad es 0 se listaran todos los resultados.
+// Escribira en la salida los resultados en sentido cronologico.
+// Pre: Twitter fue creado. cant_terminos es mayor a 0.
+// Post: Devuelve false en caso de error.
+bool twitter_buscar_cronologico(twitter_t* twitter, char** terminos, size_t cant_terminos, operador_t operador, size_t cantidad, salida_t* salida)
+{
+	if (cant_terminos == 1)
+		return cronologico_palabra(twitter, buscar_palabra(twitter, terminos[0]), cantidad, salida);
+	return buscar_varios(twitter, terminos, cant_terminos, operador, cantidad, salida, cronologico_consulta);
+}
+
+// Lleva a cabo la busqueda por popularidad de los terminos especificados.
+// Recibe los usuarios o hashtags a buscar, como se combinan (si hay mas de
+// uno) y la cantidad de resultados.
+// Si cantidad es 0 se listaran todos los resultados.
+// Escribira en la salida los resultados de mayor a menor en popularidad:
+// primero los de mas favoritos y, a igual cantidad, el que llego antes a
+// ella (el de ultimo favorito mas viejo). Los que no tienen favoritos
+// salen del mas nuevo al mas viejo.
+// Pre: Twitter fue creado. cant_terminos es mayor a 0.
+// Post: Devuelve false en caso de error.
+bool twitter_buscar_popular(twitter_t* twitter, char** terminos, size_t cant_terminos, operador_t operador, size_t cantidad, salida_t* salida)
+{
+	if (cant_terminos == 1)
+		return popular_palabra(twitter, buscar_palabra(twitter, terminos[0]), cantidad, salida);
+	return buscar_varios(twitter, terminos, cant_terminos, operador, cantidad, salida, popular_consulta);
+}
+
+// Funcion de comparacion para juntar las sugerencias de varios fragmentos:
+// primero la de mayor frecuencia y, a igual frecuencia, la que llego antes.
+static int comparar_sugerencias(const void* a, const void* b)
+{
+	const trie_sugerencia_t* sugerencia_a = a;
+	const trie_sugerencia_t* sugerencia_b = b;
+	if (sugerencia_a->frecuencia != sugerencia_b->frecuencia)
+		return sugerencia_a->frecuencia > sugerencia_b->frecuencia ? -1 : 1;
+	return (sugerencia_a->marca > sugerencia_b->marca) - (sugerencia_a->marca < sugerencia_b->marca);
+}
+
+// Escribe en la salida los hasta cantidad usuarios o hashtags que empiezan
+// con prefijo y estan en mas tweets, con la cantidad de tweets de cada uno.
+// Se dan a lo sumo 10 (TRIE_TOP), que es lo que se da si cantidad es 0.
+// Cuesta O(largo del prefijo + cantidad) por fragmento.
+// Pre: Twitter fue creado.
+void twitter_autocompletar(twitter_t* twitter, const char* prefijo, size_t cantidad, salida_t* salida)
+{
+	trie_sugerencia_t sugerencias[TWITTER_MAX_FRAGMENTOS * TRIE_TOP];
+	if (cantidad == 0 || cantidad > TRIE_TOP) cantidad = TRIE_TOP;
+
+	// Las mejores de todos los fragmentos estan entre las mejores de cada uno.
+	size_t encontradas = 0;
+	for (size_t i = 0; i < twitter->cant_fragmentos; i++)
+		encontradas += fragmento_completar(twitter->fragmentos[i], prefijo, cantidad, sugerencias + encontradas);
+	if (twitter->cant_fragmentos > 1)
+		qsort(sugerencias, encontradas, sizeof(trie_sugerencia_t), comparar_sugerencias);
+	if (encontradas > cantidad) encontradas = cantidad;
+
+	imprimir_ok(salida, encontradas);
+	for (size_t i = 0; i < encontradas; i++)
+	{
+		salida_cadena(salida, sugerencias[i].clave);
+		salida_caracter(salida, ' ');
+		salida_numero(salida, sugerencias[i].frecuencia);
+		salida_caracter(salida, '\n');
+	}
+}
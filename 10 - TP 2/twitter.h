@@ -3,48 +3,99 @@
 
 #include <stdbool.h>
 #include <stdlib.h>
+#include "salida.h"
+#include "consulta.h"
 
 /* ******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS
  * *****************************************************************/
 
+/* Las palabras (usuarios y hashtags) se pueden repartir en varios
+ * fragmentos, cada uno modificado en un hilo propio: los comandos que
+ * cambian el twitter se siguen llamando desde un solo hilo, en orden, y
+ * las respuestas y los ids son los mismos que con un solo fragmento. */
+
+// Maxima cantidad de fragmentos.
+#define TWITTER_MAX_FRAGMENTOS 64
+
 typedef struct twitter twitter_t;
 
 /* ******************************************************************
  *                    PRIMITIVAS DEL TWITTER
  * *****************************************************************/
 
-// Crea el twitter.
+// Crea el twitter, con todas las palabras en un solo fragmento.
 // Post: Devuelve el twitter o NULL en caso de error.
 twitter_t* twitter_crear();
 
+// Crea el twitter con las palabras repartidas en cant_fragmentos
+// fragmentos. Si en_paralelo es true, cada fragmento se modifica en un
+// hilo propio, y los cambios recien se ven despues de twitter_sincronizar.
+// Pre: cant_fragmentos esta entre 1 y TWITTER_MAX_FRAGMENTOS.
+// Post: Devuelve el twitter o NULL en caso de error.
+twitter_t* twitter_crear_con_fragmentos(size_t cant_fragmentos, bool en_paralelo);
+
 // Destruye el twitter.
 // Pre: Twitter fue creado.
 void twitter_destruir(twitter_t* twitter);
 
-// Crea un nuevo tweet con el autor y mensaje especificado.
+// Si los fragmentos se modifican en paralelo, espera a que se apliquen
+// todos los cambios. Las busquedas solo ven lo sincronizado, y hasta el
+// proximo cambio se pueden hacer desde varios hilos a la vez.
+// Pre: Twitter fue creado.
+// Post: Devuelve false si fallo algun cambio.
+bool twitter_sincronizar(twitter_t* twitter);
+
+// Como twitter_sincronizar, pero solo espera a los cambios del fragmento
+// de la palabra formada por los primeros largo caracteres de clave. Alcanza
+// para buscarla; los demas fragmentos pueden seguir cambiando mientras.
+// Pre: Twitter fue creado.
+// Post: Devuelve false si fallo algun cambio de ese fragmento.
+bool twitter_sincronizar_palabra(twitter_t* twitter, const char* clave, size_t largo);
+
+// Crea un nuevo tweet con el autor y mensaje especificado, y escribe su id
+// en la salida.
 // Pre: Twitter fue creado.
 // Post: Devuelve false en caso de error.
-bool twitter_twittear(twitter_t* twitter, char* autor, char* mensaje);
+bool twitter_twittear(twitter_t* twitter, const char* autor, const char* mensaje, salida_t* salida);
 
-// Incrementa la cantida de favoritos del tweet con el id especficado.
+// Devuelve la cantidad de tweets (el proximo id).
 // Pre: Twitter fue creado.
-// Post: Devuelve false en caso de ser un id invalido.
-bool twitter_favorito(twitter_t* twitter, size_t id);
+size_t twitter_cantidad(const twitter_t* twitter);
 
-// Lleva a cabo la busqueda cronologica del termino especificado.
-// Recibe el usuario o hashtag a buscar y la cantidad de resultados.
+// Incrementa la cantida de favoritos del tweet con el id especficado, y
+// escribe el id en la salida. El tweet sube en el ranking de cada una de
+// sus palabras.
+// Pre: Twitter fue creado. id es menor a la cantidad de tweets.
+// Post: Devuelve false en caso de error.
+bool twitter_favorito(twitter_t* twitter, size_t id, salida_t* salida);
+
+// Lleva a cabo la busqueda cronologica de los terminos especificados.
+// Recibe los usuarios o hashtags a buscar, como se combinan (si hay mas de
+// uno) y la cantidad de resultados.
 // Si cantidad es 0 se listaran todos los resultados.
-// Imprimira por salida estandar los resultados en sentido cronologico.
-// Pre: Twitter fue creado.
-void twitter_buscar_cronologico(twitter_t* twitter, char* busqueda, size_t cantidad);
+// Escribira en la salida los resultados en sentido cronologico.
+// Pre: Twitter fue creado. cant_terminos es mayor a 0.
+// Post: Devuelve false en caso de error.
+bool twitter_buscar_cronologico(twitter_t* twitter, char** terminos, size_t cant_terminos, operador_t operador, size_t cantidad, salida_t* salida);
 
-// Lleva a cabo la busqueda por popularidad del termino especificado.
-// Recibe el usuario o hashtag a buscar y la cantidad de resultados.
+// Lleva a cabo la busqueda por popularidad de los terminos especificados.
+// Recibe los usuarios o hashtags a buscar, como se combinan (si hay mas de
+// uno) y la cantidad de resultados.
 // Si cantidad es 0 se listaran todos los resultados.
-// Imprimira por salida estandar los resultados de mayor a menor en popularidad.
-// Pre: Twitter fue creado.
+// Escribira en la salida los resultados de mayor a menor en popularidad:
+// primero los de mas favoritos y, a igual cantidad, el que llego antes a
+// ella (el de ultimo favorito mas viejo). Los que no tienen favoritos
+// salen del mas nuevo al mas viejo.
+// Pre: Twitter fue creado. cant_terminos es mayor a 0.
 // Post: Devuelve false en caso de error.
-bool twitter_buscar_popular(twitter_t* twitter, char* busqueda, size_t cantidad);
+bool twitter_buscar_popular(twitter_t* twitter, char** terminos, size_t cant_terminos, operador_t operador, size_t cantidad, salida_t* salida);
+
+// Escribe en la salida los hasta cantidad usuarios o hashtags que empiezan
+// con prefijo y estan en mas tweets, con la cantidad de tweets de cada uno.
+// Se dan a lo sumo 10 (TRIE_TOP), que es lo que se da si cantidad es 0.
+// Cuesta O(largo del prefijo + cantidad) por fragmento.
+// Pre: Twitter fue creado.
+void twitter_autocompletar(twitter_t* twitter, const char* prefijo, size_t cantidad, salida_t* salida);
 
 #endif //TWITTER_H
\ No newline at end of file
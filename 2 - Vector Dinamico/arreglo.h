@@ -0,0 +1,112 @@
+#ifndef ARREGLO_H
+#define ARREGLO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+/* El arreglo es un vector dinamico generico: guarda por copia elementos
+ * de un tamaño fijo (tam_elemento bytes) en memoria contigua, y crece solo
+ * a medida que se le agregan elementos. */
+
+typedef struct arreglo arreglo_t;
+
+/* Acceso directo (sin chequeo de rango) al elemento pos, visto como tipo.
+ * Ej: ARREGLO_VER(arreglo, int, 3) = 5;
+ * Pre: pos < arreglo_largo(arreglo) y tipo ocupa tam_elemento bytes. */
+#define ARREGLO_VER(arreglo, tipo, pos) (((tipo*)arreglo_datos(arreglo))[pos])
+
+/*******************************************************************
+ *                    PRIMITIVAS DEL ARREGLO                       *
+ ******************************************************************/
+
+// Crea un arreglo vacio de elementos de tam_elemento bytes.
+// Pre: tam_elemento es mayor a 0.
+// Post: devuelve un arreglo vacio o NULL en caso de error.
+arreglo_t* arreglo_crear(size_t tam_elemento);
+
+// Crea un arreglo vacio con lugar para capacidad elementos sin redimensionar.
+// Pre: tam_elemento es mayor a 0.
+// Post: devuelve un arreglo vacio o NULL en caso de error.
+arreglo_t* arreglo_crear_con_capacidad(size_t tam_elemento, size_t capacidad);
+
+// Destruye el arreglo. Si se recibe la funcion destruir_elemento, se la llama
+// con un puntero a cada uno de los elementos guardados.
+// Pre: el arreglo fue creado.
+// Post: se eliminaron todos los elementos del arreglo.
+void arreglo_destruir(arreglo_t* arreglo, void destruir_elemento(void*));
+
+// Devuelve la cantidad de elementos guardados.
+// Pre: el arreglo fue creado.
+size_t arreglo_largo(const arreglo_t* arreglo);
+
+// Devuelve verdadero si el arreglo no tiene elementos.
+// Pre: el arreglo fue creado.
+bool arreglo_esta_vacio(const arreglo_t* arreglo);
+
+// Devuelve cuantos elementos entran sin tener que redimensionar.
+// Pre: el arreglo fue creado.
+size_t arreglo_capacidad(const arreglo_t* arreglo);
+
+// Se asegura de que entren al menos capacidad elementos sin redimensionar.
+// Nunca achica el arreglo.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si no se pudo reservar la memoria (el arreglo
+// queda intacto).
+bool arreglo_reservar(arreglo_t* arreglo, size_t capacidad);
+
+// Libera la memoria sobrante, dejando la capacidad igual al largo.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si no se pudo achicar (el arreglo queda intacto).
+bool arreglo_ajustar(arreglo_t* arreglo);
+
+// Agrega una copia del elemento al final del arreglo. O(1) amortizado.
+// Pre: el arreglo fue creado. elemento apunta a tam_elemento bytes.
+// Post: devuelve false en caso de error.
+bool arreglo_agregar(arreglo_t* arreglo, const void* elemento);
+
+// Saca el ultimo elemento del arreglo y, si elemento no es NULL, lo copia ahi.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si el arreglo estaba vacio.
+bool arreglo_sacar(arreglo_t* arreglo, void* elemento);
+
+// Agrega al final una copia de los n elementos consecutivos de elementos.
+// Pre: el arreglo fue creado.
+// Post: devuelve false en caso de error (el arreglo queda intacto).
+bool arreglo_agregar_n(arreglo_t* arreglo, const void* elementos, size_t n);
+
+// Inserta una copia de los n elementos en la posicion pos, corriendo
+// los que estaban desde pos en adelante.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si pos > largo o en caso de error.
+bool arreglo_insertar_n(arreglo_t* arreglo, size_t pos, const void* elementos, size_t n);
+
+// Borra los n elementos a partir de la posicion pos, corriendo los siguientes.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si el rango no esta dentro del arreglo.
+bool arreglo_borrar_n(arreglo_t* arreglo, size_t pos, size_t n);
+
+// Copia en elemento el dato guardado en la posicion pos.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si la posicion es invalida.
+bool arreglo_obtener(const arreglo_t* arreglo, size_t pos, void* elemento);
+
+// Guarda una copia de elemento en la posicion pos.
+// Pre: el arreglo fue creado.
+// Post: devuelve false si la posicion es invalida.
+bool arreglo_guardar(arreglo_t* arreglo, size_t pos, const void* elemento);
+
+// Devuelve un puntero al elemento de la posicion pos, sin chequear el rango.
+// Pre: el arreglo fue creado. pos < arreglo_largo(arreglo).
+// Post: el puntero es valido hasta la proxima modificacion del arreglo.
+void* arreglo_ver(const arreglo_t* arreglo, size_t pos);
+
+// Devuelve un puntero al comienzo de los elementos (memoria contigua).
+// Pre: el arreglo fue creado.
+// Post: el puntero es valido hasta la proxima modificacion del arreglo.
+void* arreglo_datos(const arreglo_t* arreglo);
+
+#endif // ARREGLO_H
@@ -0,0 +1,192 @@
+#include "arreglo.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*******************************************************************
+ *                        PRUEBAS UNITARIAS                        *
+ ******************************************************************/
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+typedef struct punto{
+	int x;
+	int y;
+} punto;
+
+int destruidos = 0;
+
+void destruir_puntero(void* elemento){
+	free(*(void**)elemento);
+	destruidos++;
+}
+
+/* Pruebas con un arreglo vacio */
+void pruebas_arreglo_vacio()
+{
+	printf("INICIO DE PRUEBAS CON ARREGLO VACIO\n");
+	arreglo_t* arreglo = arreglo_crear(sizeof(int));
+
+	print_test("crear arreglo de int", arreglo != NULL);
+	print_test("el largo es 0", arreglo_largo(arreglo) == 0);
+	print_test("el arreglo esta vacio", arreglo_esta_vacio(arreglo));
+
+	int valor = 7;
+	print_test("obtener [0] es false", !arreglo_obtener(arreglo, 0, &valor));
+	print_test("guardar en [0] es false", !arreglo_guardar(arreglo, 0, &valor));
+	print_test("sacar es false", !arreglo_sacar(arreglo, &valor));
+	print_test("el valor no fue modificado", valor == 7);
+	print_test("insertar fuera de rango es false", !arreglo_insertar_n(arreglo, 1, &valor, 1));
+	print_test("borrar fuera de rango es false", !arreglo_borrar_n(arreglo, 0, 1));
+
+	arreglo_destruir(arreglo, NULL);
+	print_test("el arreglo fue destruido", true);
+}
+
+/* Pruebas de agregar y sacar como si fuera una pila */
+void pruebas_arreglo_agregar_sacar()
+{
+	printf("INICIO DE PRUEBAS DE AGREGAR Y SACAR\n");
+	arreglo_t* arreglo = arreglo_crear(sizeof(punto));
+
+	bool ok = true;
+	for (int i = 0; i < 100; i++){
+		punto p = {i, -i};
+		ok &= arreglo_agregar(arreglo, &p);
+	}
+	print_test("agregar 100 puntos", ok);
+	print_test("el largo es 100", arreglo_largo(arreglo) == 100);
+	print_test("la capacidad alcanza", arreglo_capacidad(arreglo) >= 100);
+
+	punto p;
+	print_test("obtener [42]", arreglo_obtener(arreglo, 42, &p));
+	print_test("[42] es (42, -42)", p.x == 42 && p.y == -42);
+	print_test("acceso sin chequeo a [10]", ARREGLO_VER(arreglo, punto, 10).x == 10);
+	print_test("arreglo_ver apunta al elemento", ((punto*)arreglo_ver(arreglo, 99))->y == -99);
+
+	ok = true;
+	for (int i = 99; i >= 0; i--){
+		ok &= arreglo_sacar(arreglo, &p);
+		ok &= (p.x == i);
+	}
+	print_test("sacar devuelve en orden inverso", ok);
+	print_test("el arreglo quedo vacio", arreglo_esta_vacio(arreglo));
+
+	arreglo_destruir(arreglo, NULL);
+}
+
+/* Pruebas de insercion y borrado en bloque */
+void pruebas_arreglo_en_bloque()
+{
+	printf("INICIO DE PRUEBAS EN BLOQUE\n");
+	arreglo_t* arreglo = arreglo_crear(sizeof(int));
+	int inicio[] = {1, 2, 6, 7};
+	int medio[] = {3, 4, 5};
+
+	print_test("agregar 4 elementos juntos", arreglo_agregar_n(arreglo, inicio, 4));
+	print_test("insertar 3 en el medio", arreglo_insertar_n(arreglo, 2, medio, 3));
+	print_test("el largo es 7", arreglo_largo(arreglo) == 7);
+
+	bool ok = true;
+	for (int i = 0; i < 7; i++)
+		ok &= ARREGLO_VER(arreglo, int, i) == i + 1;
+	print_test("los elementos quedaron en orden", ok);
+
+	int cero = 0;
+	print_test("insertar al principio", arreglo_insertar_n(arreglo, 0, &cero, 1));
+	print_test("el primero es 0", ARREGLO_VER(arreglo, int, 0) == 0);
+
+	print_test("borrar [1, 4)", arreglo_borrar_n(arreglo, 1, 3));
+	int esperado[] = {0, 4, 5, 6, 7};
+	print_test("el largo es 5", arreglo_largo(arreglo) == 5);
+	print_test("quedan los elementos correctos", memcmp(arreglo_datos(arreglo), esperado, sizeof(esperado)) == 0);
+	print_test("borrar mas de lo que hay es false", !arreglo_borrar_n(arreglo, 3, 3));
+
+	print_test("guardar en [4]", arreglo_guardar(arreglo, 4, &cero));
+	print_test("[4] es 0", ARREGLO_VER(arreglo, int, 4) == 0);
+
+	arreglo_destruir(arreglo, NULL);
+}
+
+/* Pruebas de reservar y ajustar la capacidad */
+void pruebas_arreglo_capacidad()
+{
+	printf("INICIO DE PRUEBAS DE CAPACIDAD\n");
+	arreglo_t* arreglo = arreglo_crear_con_capacidad(sizeof(long), 0);
+	print_test("crear con capacidad 0", arreglo != NULL && arreglo_capacidad(arreglo) == 0);
+
+	print_test("reservar 1000", arreglo_reservar(arreglo, 1000));
+	print_test("la capacidad es al menos 1000", arreglo_capacidad(arreglo) >= 1000);
+	size_t capacidad = arreglo_capacidad(arreglo);
+	void* datos = arreglo_datos(arreglo);
+
+	bool ok = true;
+	for (long i = 0; i < 1000; i++)
+		ok &= arreglo_agregar(arreglo, &i);
+	print_test("agregar lo reservado no redimensiona", ok && datos == arreglo_datos(arreglo) &&
+		capacidad == arreglo_capacidad(arreglo));
+
+	print_test("reservar menos no achica", arreglo_reservar(arreglo, 10) && arreglo_capacidad(arreglo) == capacidad);
+	arreglo_borrar_n(arreglo, 10, 990);
+	print_test("ajustar", arreglo_ajustar(arreglo));
+	print_test("la capacidad es igual al largo", arreglo_capacidad(arreglo) == 10);
+	print_test("los datos siguen estando", ARREGLO_VER(arreglo, long, 9) == 9);
+
+	arreglo_destruir(arreglo, NULL);
+}
+
+/* Pruebas del arreglo al trabajar con un volumen grande de elementos */
+void pruebas_arreglo_volumen()
+{
+	printf("INICIO DE PRUEBAS DE VOLUMEN\n");
+	size_t tam = 1000000;
+	arreglo_t* arreglo = arreglo_crear(sizeof(size_t));
+
+	bool ok = true;
+	for (size_t i = 0; i < tam; i++)
+		ok &= arreglo_agregar(arreglo, &i);
+	print_test("se pudieron agregar todos los elementos", ok);
+
+	ok = true;
+	for (size_t i = 0; i < tam; i++)
+		ok &= ARREGLO_VER(arreglo, size_t, i) == i;
+	print_test("se pudieron obtener todos los elementos", ok);
+
+	arreglo_destruir(arreglo, NULL);
+}
+
+/* Prueba la funcion de destruccion con elementos que son punteros */
+void pruebas_arreglo_destruir()
+{
+	printf("INICIO DE PRUEBAS DE DESTRUCCION\n");
+	arreglo_t* arreglo = arreglo_crear(sizeof(punto*));
+	for (int i = 0; i < 10; i++){
+		punto* p = malloc(sizeof(punto));
+		arreglo_agregar(arreglo, &p);
+	}
+	arreglo_destruir(arreglo, destruir_puntero);
+	print_test("se destruyeron los 10 elementos", destruidos == 10);
+}
+
+/* Ejecuta todas las pruebas. */
+void pruebas_arreglo()
+{
+	pruebas_arreglo_vacio();
+	pruebas_arreglo_agregar_sacar();
+	pruebas_arreglo_en_bloque();
+	pruebas_arreglo_capacidad();
+	pruebas_arreglo_volumen();
+	pruebas_arreglo_destruir();
+}
+
+/* Programa principal. */
+int main(void)
+{
+	pruebas_arreglo();
+	return 0;
+}
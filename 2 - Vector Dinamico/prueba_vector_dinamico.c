@@ -0,0 +1,325 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "vector_dinamico.h"
+
+/*******************************************************************
+ *                        PRUEBAS UNITARIAS
+ ******************************************************************/
+
+/* Funcin auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+/* Pruebas para un vector de tamanio 0*/
+void pruebas_vector_nulo()
+{
+	printf("INICIO DE PRUEBAS CON VECTOR DE TAMANIO 0\n");
+
+	/* Declaro las variables a utilizar*/
+	vector_t* vec = vector_crear(0);
+	
+	/* Inicio de pruebas */
+	print_test("crear vector con tamanio 0", vec != NULL);
+	print_test("obtener tamanio vector es 0", vector_obtener_tamanio(vec) == 0);  
+	
+	/* Pruebo que guardar en un vector de tamanio 0 devuelve false siempre (no se puede guardar) */
+	print_test("guardar en vec[0] es false", !vector_guardar(vec, 0, 5));
+	print_test("guardar en vec[1] es false", !vector_guardar(vec, 1, 10));
+	print_test("guardar en vec[15] es false", !vector_guardar(vec, 15, 0));
+	
+	/* Pruebo que obtener valores de un vector de tamao 0 devuelve false */
+	int valor;
+	print_test("obtener vec[0] es false", !vector_obtener(vec, 0, &valor));
+	print_test("obtener vec[1] es false", !vector_obtener(vec, 1, &valor));
+	
+	/* Destruyo el vector*/
+	vector_destruir(vec);
+	print_test("el vector fue destruido", true);
+}
+
+/* Pruebas de guardar y obtener algunos elementos*/
+void pruebas_vector_algunos_elementos()
+{
+	printf("INICIO DE PRUEBAS CON ALGUNOS ELEMENTOS\n");
+	
+	/* Creo un vector de tamanio 5*/
+	vector_t* vec2 = vector_crear(5);
+	
+	print_test("crear vec2 con tamanio 5", vec2 != NULL);
+	print_test("obtener tamanio es 5", vector_obtener_tamanio(vec2) == 5);
+	
+	/* Pruebo que guardar en un vector de tamanio 5 funciona para posiciones menores que 5 */
+	print_test("guardar 20 en vec2[0] es true", vector_guardar(vec2, 0, 20));
+	print_test("guardar 30 en vec2[1] es true", vector_guardar(vec2, 1, 30));
+	print_test("guardar 15 en vec2[0] es true", vector_guardar(vec2,0,15));
+	print_test("guardar 7 en vec2[4] es true", vector_guardar(vec2, 4, 7));
+	
+	/* Pruebo que guardar en un vector de tamanio 5 no funciona para posiciones mayores o iguales que 5 */
+	print_test("guardar 35 en vec2[5] es false", !vector_guardar(vec2, 5, 35));
+	print_test("guardar 40 en vec2[6] es false", !vector_guardar(vec2, 6, 40));
+	
+	/* Pruebo obtener los valores de un vector previamente guardados */
+	int valor;
+	print_test("se puede obtener vec2[0]", vector_obtener(vec2, 0, &valor));
+	print_test("obtener vec2[0] es 15", valor == 15);
+	print_test("se puede obtener vec2[1]", vector_obtener(vec2, 1, &valor));
+	print_test("obtener vec2[1] es 30", valor == 30);
+	print_test("no se puede obtener vec2[5]", !vector_obtener(vec2, 5, &valor));
+	print_test("valor no fue modificado", valor == 30);
+	
+	/* Destruyo el vector*/
+	vector_destruir(vec2);
+	print_test("el vector fue destruido", true);
+}
+
+/* Pruebas al redimensionar un vector (agrandar y achicar) */
+void pruebas_vector_redimension()
+{
+	printf("INICIO DE PRUEBAS DE REDIMENSION\n");
+	/* Creo un vector de tamanio 3*/
+	vector_t* vec3 = vector_crear(3);
+	
+	/* Pruebo guardar elementos en el vector de tamanio 3*/
+	print_test("guardar 5 en vec3[0] es true", vector_guardar(vec3, 0, 5));
+	print_test("guardar 10 en vec3[1] es true", vector_guardar(vec3, 1, 10));
+	
+	/* Pruebo redimensionar (agrandar) el vector */
+	print_test("redimensionar a tamanio 10", vector_redimensionar(vec3, 10));
+	print_test("El nuevo tamanio del vector es 10", vector_obtener_tamanio(vec3) == 10);
+	
+	/* Pruebo que los elementos guardados antes son correctos*/
+	int valor;
+	print_test("puedo obtener el valor de vec3[0] luego de redimensionar (agrandar)", vector_obtener(vec3, 0, &valor));
+	print_test("el valor contenido en vec3[0] es 5", valor == 5);
+	print_test("puedo obtener el valor de vec3[1] luego de redimensionar (agrandar)", vector_obtener(vec3, 1, &valor));
+	print_test("el valor contenido en vec3[1] es 10", valor == 10);
+	
+	/* Pruebo que se pueda agregar ahora en la posicion 5 */
+	print_test("guardar 50 en vec3[5] es true, luego de redimensionar", vector_guardar(vec3, 5, 50));
+	print_test("puedo obtener el valor de vec3[5], luego de redimensionar", vector_obtener(vec3, 5, &valor));
+	print_test("el valor contenido en vec3[5] es 50", valor == 50);
+	
+	/* Pruebo redimensionar (achicar) el vector */
+	print_test("redimensionar a tamanio 2", vector_redimensionar(vec3, 2));
+	print_test("El nuevo tamanio del vector es 2", vector_obtener_tamanio(vec3) == 2);
+	
+	/* Pruebo que los elementos de las primeras posiciones sigan estando*/
+	print_test("puedo obtener el valor de vec3[0] luego de redimensionar (achicar)", vector_obtener(vec3, 0, &valor));
+	print_test("el valor contenido en vec3[0] es 5", valor == 5);
+	print_test("puedo obtener el valor de vec3[1] luego de redimensionar (achicar)", vector_obtener(vec3, 1, &valor));
+	print_test("el valor contenido en vec3[1] es 10", valor == 10);
+	
+	/* Pruebo que no puedo leer lo que esta en la posicion 5*/
+	print_test("no puedo obtener el valor de vec3[5] luego de redimensionar (achicar)", !vector_obtener(vec3, 5, &valor));
+	
+	/* Puebo que no puedo guardar en la posicion 5*/
+	print_test("no puedo guardar 0 en vec3[5] luego de redimensionar (achicar)", !vector_guardar(vec3, 5, 0));
+	
+	/* Destruyo el vector*/
+	vector_destruir(vec3);
+	print_test("el vector fue destruido", true);
+}
+
+/* Pruebas del vector al trabajar con un volumen grande de elementos */ 
+void pruebas_vector_volumen()
+{
+	printf("INICIO DE PRUEBAS DE VOLUMEN\n");
+	
+	/* Defino el tamanio del vector*/
+	size_t tam = 10000;
+	
+	/* Creo el vector con ese tamanio*/ 
+	vector_t* vec_vol = vector_crear(tam);
+	
+	/* Prueba de correcta creacion del vector */
+	print_test("crear vec_vol con tamanio grande", vec_vol != NULL);
+	print_test("obtener tamanio vec_vol es el indicado", vector_obtener_tamanio(vec_vol) == tam);
+	
+	/* Pruebo guardar en todas las posiciones */
+	size_t i;
+	bool ok = true;
+	for (i = 0; i < tam; i++)
+	{
+		// Si algun elemento no se pudo guardar correctamente, ok sera false
+		ok &= vector_guardar(vec_vol, i, i);
+	}
+	print_test("se pudieron guardar todos los elementos", ok);
+	print_test("no se puede guardar un elemento en vec_vol[tam]", !vector_guardar(vec_vol, tam, 10));
+	
+	/* Pruebo que lo guardado sea correcto */
+	ok = true;
+	int valor;
+	for (i = 0; i < tam; i++)
+	{
+		ok &= vector_obtener(vec_vol, i, &valor);
+		ok &= (valor == i);
+	}
+	print_test("se pudieron obtener todos los elementos", ok);
+	print_test("no se puede obtener el valor de vec_vol[tam]", !vector_obtener(vec_vol, tam, &valor));
+	
+	/* Destruyo el vector*/
+	vector_destruir(vec_vol);
+	print_test("el vector fue destruido", true);
+}
+
+/* Pruebas de las operaciones sobre todo el vector, con cada version */
+void pruebas_vector_operaciones_con(vector_simd_t nivel)
+{
+	vector_usar_simd(nivel);
+	printf("INICIO DE PRUEBAS DE OPERACIONES (%s)\n", vector_simd_nombre());
+
+	/* Vector de tamanio 0 */
+	vector_t* vacio = vector_crear(0);
+	size_t pos = 42;
+	print_test("maximo de vector vacio es false", !vector_maximo(vacio, &pos));
+	print_test("sumar vector vacio es 0", vector_sumar(vacio) == 0);
+	print_test("buscar en vector vacio es false", !vector_buscar(vacio, 0, &pos));
+	print_test("pos no fue modificada", pos == 42);
+
+	/* Pruebo todos los largos hasta 100 para cubrir los restos de los bloques */
+	bool ok_max = true, ok_suma = true, ok_buscar = true, ok_comparar = true, ok_llenar = true;
+	for (size_t tam = 1; tam <= 100; tam++)
+	{
+		vector_t* vec = vector_crear(tam);
+		vector_t* copia = vector_crear(tam);
+		size_t pos_max = 0;
+		long long suma = 0;
+		int valor, max = 0, encontrado;
+		for (size_t i = 0; i < tam; i++)
+		{
+			valor = (rand() % 2001) - 1000;
+			vector_guardar(vec, i, valor);
+			vector_guardar(copia, i, valor);
+			if (i == 0 || valor > max)
+			{
+				max = valor;
+				pos_max = i;
+			}
+			suma += valor;
+		}
+		ok_max &= vector_maximo(vec, &pos) && pos == pos_max;
+		ok_suma &= vector_sumar(vec) == suma;
+
+		/* Busco el ultimo elemento y uno que no esta */
+		vector_obtener(vec, tam - 1, &valor);
+		ok_buscar &= vector_buscar(vec, valor, &pos) && vector_obtener(vec, pos, &encontrado) && encontrado == valor;
+		ok_buscar &= !vector_buscar(vec, 5000, &pos);
+
+		/* Iguales, y despues cambio el ultimo elemento */
+		ok_comparar &= vector_comparar(vec, copia) == 0;
+		vector_guardar(copia, tam - 1, valor + 1);
+		ok_comparar &= vector_comparar(vec, copia) == -1 && vector_comparar(copia, vec) == 1;
+		vector_guardar(copia, tam - 1, valor);
+		vector_redimensionar(copia, tam - 1);
+		ok_comparar &= vector_comparar(copia, vec) == -1 && vector_comparar(vec, copia) == 1;
+
+		vector_llenar(vec, 7);
+		ok_llenar &= vector_sumar(vec) == 7 * (long long)tam;
+
+		vector_destruir(vec);
+		vector_destruir(copia);
+	}
+	print_test("maximo de vectores de tamanio 1 a 100", ok_max);
+	print_test("sumar vectores de tamanio 1 a 100", ok_suma);
+	print_test("buscar en vectores de tamanio 1 a 100", ok_buscar);
+	print_test("comparar vectores de tamanio 1 a 100", ok_comparar);
+	print_test("llenar vectores de tamanio 1 a 100", ok_llenar);
+
+	/* La suma no desborda con valores extremos */
+	vector_t* grande = vector_crear(1000);
+	vector_llenar(grande, 2147483647);
+	print_test("sumar no desborda con el maximo int", vector_sumar(grande) == 2147483647LL * 1000);
+	vector_llenar(grande, -2147483647 - 1);
+	print_test("sumar no desborda con el minimo int", vector_sumar(grande) == (-2147483647LL - 1) * 1000);
+	vector_guardar(grande, 999, 0);
+	print_test("el maximo esta al final", vector_maximo(grande, &pos) && pos == 999);
+	vector_guardar(grande, 500, 0);
+	print_test("el maximo repetido devuelve el primero", vector_maximo(grande, &pos) && pos == 500);
+	vector_destruir(grande);
+
+	vector_destruir(vacio);
+	vector_usar_simd(VECTOR_AVX2);
+}
+
+void pruebas_vector_operaciones()
+{
+	// Si el procesador no tiene alguna, se repite la anterior.
+	pruebas_vector_operaciones_con(VECTOR_AVX2);
+	pruebas_vector_operaciones_con(VECTOR_SSE2);
+	pruebas_vector_operaciones_con(VECTOR_ESCALAR);
+}
+
+#define ARCHIVO_MAPEADO "prueba_vector_mapeado.dat"
+
+/* Pruebas de un vector respaldado en un archivo */
+void pruebas_vector_mapeado()
+{
+	printf("INICIO DE PRUEBAS DE VECTOR MAPEADO\n");
+	remove(ARCHIVO_MAPEADO);
+
+	vector_t* vec = vector_mapear(ARCHIVO_MAPEADO, 100);
+	print_test("mapear un vector de tamanio 100", vec != NULL);
+	print_test("el tamanio es 100", vector_obtener_tamanio(vec) == 100);
+
+	int valor = -1;
+	print_test("un archivo nuevo empieza en 0", vector_obtener(vec, 99, &valor) && valor == 0);
+	print_test("no puedo guardar en vec[100]", !vector_guardar(vec, 100, 1));
+
+	bool ok = true;
+	for (int i = 0; i < 100; i++)
+		ok &= vector_guardar(vec, i, i * 3);
+	print_test("guardar 100 elementos", ok);
+	print_test("la suma es correcta", vector_sumar(vec) == 3 * 99 * 100 / 2);
+
+	print_test("redimensionar (agrandar) a 100000", vector_redimensionar(vec, 100000));
+	print_test("los datos se conservan", vector_obtener(vec, 42, &valor) && valor == 126);
+	print_test("las posiciones nuevas valen 0", vector_obtener(vec, 99999, &valor) && valor == 0);
+	print_test("guardar en vec[99999]", vector_guardar(vec, 99999, 7));
+
+	print_test("redimensionar (achicar) a 50", vector_redimensionar(vec, 50));
+	print_test("no puedo obtener vec[50]", !vector_obtener(vec, 50, &valor));
+	print_test("sincronizar", vector_sincronizar(vec));
+	vector_destruir(vec);
+
+	/* El contenido sobrevive a la destruccion del vector */
+	vec = vector_mapear(ARCHIVO_MAPEADO, 60);
+	print_test("volver a mapear el archivo", vec != NULL);
+	print_test("vec[49] sigue siendo 147", vector_obtener(vec, 49, &valor) && valor == 147);
+	print_test("vec[59] vale 0", vector_obtener(vec, 59, &valor) && valor == 0);
+
+	print_test("redimensionar a 0", vector_redimensionar(vec, 0));
+	print_test("el tamanio es 0", vector_obtener_tamanio(vec) == 0);
+	print_test("no puedo obtener vec[0]", !vector_obtener(vec, 0, &valor));
+	print_test("redimensionar de 0 a 10", vector_redimensionar(vec, 10));
+	print_test("vec[0] vale 0", vector_obtener(vec, 0, &valor) && valor == 0);
+	vector_destruir(vec);
+
+	print_test("mapear en una ruta invalida es NULL", vector_mapear("/no/existe/vector.dat", 10) == NULL);
+
+	vector_t* comun = vector_crear(5);
+	print_test("sincronizar un vector comun es true", vector_sincronizar(comun));
+	vector_destruir(comun);
+
+	remove(ARCHIVO_MAPEADO);
+}
+
+/* Ejecuta todas las pruebas. */
+void pruebas_vector()
+{
+	pruebas_vector_nulo();
+	pruebas_vector_algunos_elementos();
+	pruebas_vector_redimension();
+	pruebas_vector_volumen();
+	pruebas_vector_operaciones();
+	pruebas_vector_mapeado();
+}
+
+/* Programa principal. */
+int main(void)
+{
+	pruebas_vector();
+	return 0;
+}
@@ -0,0 +1,104 @@
+#define _POSIX_C_SOURCE 200809L
+#include "vector_dinamico.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*******************************************************************
+ *                  MEDICION DE LAS OPERACIONES                    *
+ ******************************************************************/
+
+#define TAM_POR_DEFECTO 16000000
+#define REPETICIONES 10
+
+double segundos_desde(struct timespec* inicio)
+{
+	struct timespec fin;
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	return (fin.tv_sec - inicio->tv_sec) + (fin.tv_nsec - inicio->tv_nsec) / 1e9;
+}
+
+// Corre cada operacion REPETICIONES veces y devuelve los milisegundos
+// promedio de cada una en tiempos (maximo, sumar, buscar, comparar, llenar).
+// El resultado de cada operacion se acumula en control para que el
+// compilador no pueda descartar las llamadas.
+void medir(vector_t* vec, vector_t* copia, double tiempos[5], long long* control)
+{
+	struct timespec inicio;
+	size_t pos;
+
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (int i = 0; i < REPETICIONES; i++)
+		if (vector_maximo(vec, &pos)) *control += pos;
+	tiempos[0] = segundos_desde(&inicio);
+
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (int i = 0; i < REPETICIONES; i++)
+		*control += vector_sumar(vec);
+	tiempos[1] = segundos_desde(&inicio);
+
+	// Se busca un valor que no esta: recorre todo el vector.
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (int i = 0; i < REPETICIONES; i++)
+		if (vector_buscar(vec, -1, &pos)) *control += pos;
+	tiempos[2] = segundos_desde(&inicio);
+
+	// Los vectores son iguales: compara todo.
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (int i = 0; i < REPETICIONES; i++)
+		*control += vector_comparar(vec, copia);
+	tiempos[3] = segundos_desde(&inicio);
+
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (int i = 0; i < REPETICIONES; i++)
+		vector_llenar(copia, i);
+	tiempos[4] = segundos_desde(&inicio);
+	// Se deja la copia igual al original para la proxima medicion.
+	for (size_t i = 0; i < vector_obtener_tamanio(vec); i++)
+	{
+		int valor;
+		vector_obtener(vec, i, &valor);
+		vector_guardar(copia, i, valor);
+	}
+
+	for (int i = 0; i < 5; i++)
+		tiempos[i] = tiempos[i] * 1000 / REPETICIONES;
+}
+
+/* Programa principal. Recibe opcionalmente el tamanio del vector. */
+int main(int argc, char** argv)
+{
+	size_t tam = argc > 1 ? (size_t)atol(argv[1]) : TAM_POR_DEFECTO;
+	vector_t* vec = vector_crear(tam);
+	vector_t* copia = vector_crear(tam);
+	if (!vec || !copia) return 1;
+
+	for (size_t i = 0; i < tam; i++)
+	{
+		int valor = rand() % 1000000;
+		vector_guardar(vec, i, valor);
+		vector_guardar(copia, i, valor);
+	}
+
+	const char* nombres[] = {"maximo", "sumar", "buscar", "comparar", "llenar"};
+	double escalar[5], sse2[5], simd[5];
+	long long control = 0;
+
+	vector_usar_simd(VECTOR_ESCALAR);
+	medir(vec, copia, escalar, &control);
+	vector_usar_simd(VECTOR_SSE2);
+	medir(vec, copia, sse2, &control);
+	vector_usar_simd(VECTOR_AVX2);
+	medir(vec, copia, simd, &control);
+
+	printf("Vector de %zu elementos, %d repeticiones (control %lld)\n", tam, REPETICIONES, control);
+	printf("%-10s %12s %12s %12s %10s\n", "operacion", "escalar ms", "sse2 ms", "simd ms", "mejora");
+	for (int i = 0; i < 5; i++)
+		printf("%-10s %12.2f %12.2f %12.2f %9.2fx  (%s)\n", nombres[i], escalar[i], sse2[i], simd[i],
+			escalar[i] / simd[i], vector_simd_nombre());
+
+	vector_destruir(vec);
+	vector_destruir(copia);
+	return 0;
+}
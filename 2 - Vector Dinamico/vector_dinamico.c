@@ -1,53 +1,88 @@
+#define _GNU_SOURCE // mremap
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "vector_dinamico.h"
 
 /*******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS
  ******************************************************************/
 
-typedef struct vector
+struct vector
 {
 	size_t tam;
 	int *datos;
-} vector_t;
+	int archivo; // descriptor del archivo si el vector es mapeado, o -1
+};
 
 /*******************************************************************
- *                    PRIMITIVAS DEL VECTOR
+ *                       FUNCIONES AUXILIARES
  ******************************************************************/
 
-// Crea un vector de tamao tam
-// Post: vector es una vector vaco de tamao tam
-vector_t* vector_crear(size_t tam);
-
-// Destruye el vector
-// Pre: el vector fue creado
-// Post: se eliminaron todos los elementos del vector
-void vector_destruir(vector_t *vector);
+// Pasa el mapeo de datos (de bytes_viejo bytes del archivo) a bytes_nuevo.
+// Post: devuelve el nuevo mapeo (NULL si bytes_nuevo es 0), o MAP_FAILED
+// si no se pudo, y entonces datos sigue mapeado como antes.
+static void *mapear_de_nuevo(int archivo, void *datos, size_t bytes_viejo, size_t bytes_nuevo)
+{
+	void *datos_nuevo = NULL;
+	if (bytes_nuevo > 0 && bytes_viejo > 0)
+	{
+#ifdef MREMAP_MAYMOVE
+		datos_nuevo = mremap(datos, bytes_viejo, bytes_nuevo, MREMAP_MAYMOVE);
+#else
+		datos_nuevo = mmap(NULL, bytes_nuevo, PROT_READ | PROT_WRITE, MAP_SHARED, archivo, 0);
+		if (datos_nuevo != MAP_FAILED) munmap(datos, bytes_viejo);
+#endif
+	}
+	else if (bytes_nuevo > 0)
+		datos_nuevo = mmap(NULL, bytes_nuevo, PROT_READ | PROT_WRITE, MAP_SHARED, archivo, 0);
+	else
+		munmap(datos, bytes_viejo);
+	return datos_nuevo;
+}
 
-// Cambia el tamao del vector
-// Pre: el vector fue creado
-// Post: el vector cambi de tamao a nuevo_tam y devuelve true
-// o el vector queda intacto y devuelve false si no se pudo cambiar el tamao
-// a nuevo_tam
-bool vector_redimensionar(vector_t *vector, size_t nuevo_tam);
+// Cambia el tamao del archivo de un vector mapeado y vuelve a mapearlo.
+// Post: devuelve false si no se pudo (el vector queda intacto).
+static bool vector_remapear(vector_t *vector, size_t tam_nuevo)
+{
+	size_t bytes_viejo = vector->tam * sizeof(int);
+	size_t bytes_nuevo = tam_nuevo * sizeof(int);
 
-// Almacena en valor el dato guardado en la posicin pos del vector
-// Pre: el vector fue creado
-// Post: se almacen en valor el dato en la posicin pos. Devuelve false si la
-// posicin es invlida (fuera del rango del vector, que va de 0 a tamao-1)
-bool vector_obtener(vector_t *vector, size_t pos, int *valor);
+	// Al crecer, el archivo se agranda antes de mapear la parte nueva. Al
+	// achicarse se recorta despues de remapear: si el remapeo falla, los
+	// datos del final siguen en el archivo.
+	bool crece = bytes_nuevo > bytes_viejo;
+	if (crece && ftruncate(vector->archivo, (off_t)bytes_nuevo) != 0) return false;
 
-// Almacena el valor en la posicin pos
-// Pre: el vector fue creado
-// Post: se almacen el valor en la posicin pos. Devuelve false si la posicin
-// es invlida (fuera del rango del vector, que va de 0 a tamao-1) y true si
-// se guard el valor con xito.
-bool vector_guardar(vector_t *vector, size_t pos, int valor);
+	void *datos_nuevo = mapear_de_nuevo(vector->archivo, vector->datos, bytes_viejo, bytes_nuevo);
+	if (datos_nuevo == MAP_FAILED)
+	{
+		if (crece)
+		{
+			// Se intenta dejar el archivo como estaba.
+			int restaurado = ftruncate(vector->archivo, (off_t)bytes_viejo);
+			(void)restaurado;
+		}
+		return false;
+	}
 
-// Devuelve el tamao del vector
-// Pre: el vector fue creado
-size_t vector_obtener_tamanio(vector_t *vector);
+	if (!crece && ftruncate(vector->archivo, (off_t)bytes_nuevo) != 0)
+	{
+		// El archivo sigue entero: se vuelve al mapeo de antes.
+		void *restaurado = mapear_de_nuevo(vector->archivo, datos_nuevo, bytes_nuevo, bytes_viejo);
+		if (restaurado != MAP_FAILED)
+		{
+			vector->datos = restaurado;
+			return false;
+		}
+	}
+	vector->datos = datos_nuevo;
+	vector->tam = tam_nuevo;
+	return true;
+}
 
 /*******************************************************************
  *                        IMPLEMENTACION
@@ -67,14 +102,60 @@ vector_t* vector_crear(size_t tam)
 	    return NULL;
 	}
 	vector->tam = tam;
+	vector->archivo = -1;
 	return vector;
 }
 
+// Crea un vector de tamao tam cuyos datos estan en el archivo ruta.
+// Si el archivo ya existia conserva su contenido (hasta tam elementos);
+// las posiciones que no estaban en el archivo valen 0.
+// Post: devuelve el vector o NULL en caso de error.
+vector_t* vector_mapear(const char *ruta, size_t tam)
+{
+	vector_t* vector = malloc(sizeof(vector_t));
+	if (vector == NULL) return NULL;
+
+	vector->archivo = open(ruta, O_RDWR | O_CREAT, 0644);
+	if (vector->archivo < 0)
+	{
+		free(vector);
+		return NULL;
+	}
+	// Se arranca como un vector vacio y se lo lleva al tamao pedido.
+	vector->datos = NULL;
+	vector->tam = 0;
+	if (!vector_remapear(vector, tam))
+	{
+		close(vector->archivo);
+		free(vector);
+		return NULL;
+	}
+	return vector;
+}
+
+// Escribe en el archivo los cambios hechos al vector. Un vector mapeado
+// tambien se sincroniza al destruirlo.
+// Pre: el vector fue creado
+// Post: devuelve false en caso de error. Para un vector que no es mapeado
+// no hace nada y devuelve true.
+bool vector_sincronizar(vector_t *vector)
+{
+	if (vector->archivo < 0 || vector->tam == 0) return true;
+	return msync(vector->datos, vector->tam * sizeof(int), MS_SYNC) == 0;
+}
+
 // Destruye el vector
 // Pre: el vector fue creado
 // Post: se eliminaron todos los elementos del vector
 void vector_destruir(vector_t *vector){
-	free(vector->datos);
+	if (vector->archivo >= 0)
+	{
+		vector_sincronizar(vector);
+		if (vector->tam > 0) munmap(vector->datos, vector->tam * sizeof(int));
+		close(vector->archivo);
+	}
+	else
+		free(vector->datos);
 	free(vector);
 }
 
@@ -85,6 +166,8 @@ void vector_destruir(vector_t *vector){
 // a nuevo_tam
 bool vector_redimensionar(vector_t *vector, size_t tam_nuevo)
 {
+	if (vector->archivo >= 0) return vector_remapear(vector, tam_nuevo);
+
 	int* datos_nuevo = realloc(vector->datos, tam_nuevo * sizeof(int));
 	// Cuando tam_nuevo es 0, es correcto que devuelva NULL
 	// En toda otra situacin significa que fall el realloc
@@ -130,180 +213,333 @@ size_t vector_obtener_tamanio(vector_t *vector)
 }
 
 
+
 /*******************************************************************
- *                        PRUEBAS UNITARIAS
+ *                 OPERACIONES SOBRE TODO EL VECTOR
  ******************************************************************/
 
-/* Funcin auxiliar para imprimir si estuvo OK o no. */
-void print_test(char* name, bool result)
+// Cada operacion tiene una version escalar y, en x86, versiones SSE2 y AVX2.
+// Se usa la mejor que soporte el procesador, salvo que se limite con
+// vector_usar_simd.
+typedef struct operaciones
+{
+	const char* nombre;
+	int (*maximo)(const int *datos, size_t n);
+	long long (*sumar)(const int *datos, size_t n);
+	size_t (*buscar)(const int *datos, size_t n, int valor);
+	size_t (*diferencia)(const int *a, const int *b, size_t n);
+	void (*llenar)(int *datos, size_t n, int valor);
+} operaciones_t;
+
+/*                          Version escalar                       */
+
+// Devuelve el mayor de los n elementos.
+// Pre: n > 0
+static int maximo_escalar(const int *datos, size_t n)
 {
-	printf("%s: %s\n", name, result? "OK" : "ERROR");
+	int max = datos[0];
+	for (size_t i = 1; i < n; i++)
+		if (datos[i] > max) max = datos[i];
+	return max;
 }
 
-/* Pruebas para un vector de tamanio 0*/
-void pruebas_vector_nulo()
+static long long sumar_escalar(const int *datos, size_t n)
 {
-	printf("INICIO DE PRUEBAS CON VECTOR DE TAMANIO 0\n");
+	long long suma = 0;
+	for (size_t i = 0; i < n; i++)
+		suma += datos[i];
+	return suma;
+}
 
-	/* Declaro las variables a utilizar*/
-	vector_t* vec = vector_crear(0);
-	
-	/* Inicio de pruebas */
-	print_test("crear vector con tamanio 0", vec != NULL);
-	print_test("obtener tamanio vector es 0", vector_obtener_tamanio(vec) == 0);  
-	
-	/* Pruebo que guardar en un vector de tamanio 0 devuelve false siempre (no se puede guardar) */
-	print_test("guardar en vec[0] es false", !vector_guardar(vec, 0, 5));
-	print_test("guardar en vec[1] es false", !vector_guardar(vec, 1, 10));
-	print_test("guardar en vec[15] es false", !vector_guardar(vec, 15, 0));
-	
-	/* Pruebo que obtener valores de un vector de tamao 0 devuelve false */
-	int valor;
-	print_test("obtener vec[0] es false", !vector_obtener(vec, 0, &valor));
-	print_test("obtener vec[1] es false", !vector_obtener(vec, 1, &valor));
-	
-	/* Destruyo el vector*/
-	vector_destruir(vec);
-	print_test("el vector fue destruido", true);
+// Devuelve la primera posicion de valor, o n si no esta.
+static size_t buscar_escalar(const int *datos, size_t n, int valor)
+{
+	size_t i = 0;
+	while (i < n && datos[i] != valor) i++;
+	return i;
 }
 
-/* Pruebas de guardar y obtener algunos elementos*/
-void pruebas_vector_algunos_elementos()
+// Devuelve la primera posicion donde a y b difieren, o n si son iguales.
+static size_t diferencia_escalar(const int *a, const int *b, size_t n)
 {
-	printf("INICIO DE PRUEBAS CON ALGUNOS ELEMENTOS\n");
-	
-	/* Creo un vector de tamanio 5*/
-	vector_t* vec2 = vector_crear(5);
-	
-	print_test("crear vec2 con tamanio 5", vec2 != NULL);
-	print_test("obtener tamanio es 5", vector_obtener_tamanio(vec2) == 5);
-	
-	/* Pruebo que guardar en un vector de tamanio 5 funciona para posiciones menores que 5 */
-	print_test("guardar 20 en vec2[0] es true", vector_guardar(vec2, 0, 20));
-	print_test("guardar 30 en vec2[1] es true", vector_guardar(vec2, 1, 30));
-	print_test("guardar 15 en vec2[0] es true", vector_guardar(vec2,0,15));
-	print_test("guardar 7 en vec2[4] es true", vector_guardar(vec2, 4, 7));
-	
-	/* Pruebo que guardar en un vector de tamanio 5 no funciona para posiciones mayores o iguales que 5 */
-	print_test("guardar 35 en vec2[5] es false", !vector_guardar(vec2, 5, 35));
-	print_test("guardar 40 en vec2[6] es false", !vector_guardar(vec2, 6, 40));
-	
-	/* Pruebo obtener los valores de un vector previamente guardados */
-	int valor;
-	print_test("se puede obtener vec2[0]", vector_obtener(vec2, 0, &valor));
-	print_test("obtener vec2[0] es 15", valor == 15);
-	print_test("se puede obtener vec2[1]", vector_obtener(vec2, 1, &valor));
-	print_test("obtener vec2[1] es 30", valor == 30);
-	print_test("no se puede obtener vec2[5]", !vector_obtener(vec2, 5, &valor));
-	print_test("valor no fue modificado", valor == 30);
-	
-	/* Destruyo el vector*/
-	vector_destruir(vec2);
-	print_test("el vector fue destruido", true);
+	size_t i = 0;
+	while (i < n && a[i] == b[i]) i++;
+	return i;
 }
 
-/* Pruebas al redimensionar un vector (agrandar y achicar) */
-void pruebas_vector_redimension()
+static void llenar_escalar(int *datos, size_t n, int valor)
 {
-	printf("INICIO DE PRUEBAS DE REDIMENSION\n");
-	/* Creo un vector de tamanio 3*/
-	vector_t* vec3 = vector_crear(3);
-	
-	/* Pruebo guardar elementos en el vector de tamanio 3*/
-	print_test("guardar 5 en vec3[0] es true", vector_guardar(vec3, 0, 5));
-	print_test("guardar 10 en vec3[1] es true", vector_guardar(vec3, 1, 10));
-	
-	/* Pruebo redimensionar (agrandar) el vector */
-	print_test("redimensionar a tamanio 10", vector_redimensionar(vec3, 10));
-	print_test("El nuevo tamanio del vector es 10", vector_obtener_tamanio(vec3) == 10);
-	
-	/* Pruebo que los elementos guardados antes son correctos*/
-	int valor;
-	print_test("puedo obtener el valor de vec3[0] luego de redimensionar (agrandar)", vector_obtener(vec3, 0, &valor));
-	print_test("el valor contenido en vec3[0] es 5", valor == 5);
-	print_test("puedo obtener el valor de vec3[1] luego de redimensionar (agrandar)", vector_obtener(vec3, 1, &valor));
-	print_test("el valor contenido en vec3[1] es 10", valor == 10);
-	
-	/* Pruebo que se pueda agregar ahora en la posicion 5 */
-	print_test("guardar 50 en vec3[5] es true, luego de redimensionar", vector_guardar(vec3, 5, 50));
-	print_test("puedo obtener el valor de vec3[5], luego de redimensionar", vector_obtener(vec3, 5, &valor));
-	print_test("el valor contenido en vec3[5] es 50", valor == 50);
-	
-	/* Pruebo redimensionar (achicar) el vector */
-	print_test("redimensionar a tamanio 2", vector_redimensionar(vec3, 2));
-	print_test("El nuevo tamanio del vector es 2", vector_obtener_tamanio(vec3) == 2);
-	
-	/* Pruebo que los elementos de las primeras posiciones sigan estando*/
-	print_test("puedo obtener el valor de vec3[0] luego de redimensionar (achicar)", vector_obtener(vec3, 0, &valor));
-	print_test("el valor contenido en vec3[0] es 5", valor == 5);
-	print_test("puedo obtener el valor de vec3[1] luego de redimensionar (achicar)", vector_obtener(vec3, 1, &valor));
-	print_test("el valor contenido en vec3[1] es 10", valor == 10);
-	
-	/* Pruebo que no puedo leer lo que esta en la posicion 5*/
-	print_test("no puedo obtener el valor de vec3[5] luego de redimensionar (achicar)", !vector_obtener(vec3, 5, &valor));
-	
-	/* Puebo que no puedo guardar en la posicion 5*/
-	print_test("no puedo guardar 0 en vec3[5] luego de redimensionar (achicar)", !vector_guardar(vec3, 5, 0));
-	
-	/* Destruyo el vector*/
-	vector_destruir(vec3);
-	print_test("el vector fue destruido", true);
+	for (size_t i = 0; i < n; i++)
+		datos[i] = valor;
 }
 
-/* Pruebas del vector al trabajar con un volumen grande de elementos */ 
-void pruebas_vector_volumen()
+static const operaciones_t operaciones_escalar =
 {
-	printf("INICIO DE PRUEBAS DE VOLUMEN\n");
-	
-	/* Defino el tamanio del vector*/
-	size_t tam = 10000;
-	
-	/* Creo el vector con ese tamanio*/ 
-	vector_t* vec_vol = vector_crear(tam);
-	
-	/* Prueba de correcta creacion del vector */
-	print_test("crear vec_vol con tamanio grande", vec_vol != NULL);
-	print_test("obtener tamanio vec_vol es el indicado", vector_obtener_tamanio(vec_vol) == tam);
-	
-	/* Pruebo guardar en todas las posiciones */
+	"escalar", maximo_escalar, sumar_escalar, buscar_escalar,
+	diferencia_escalar, llenar_escalar
+};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VECTOR_SIMD_X86
+
+/*                         Version SSE2 (4 int)                   */
+
+// SSE2 no tiene max de enteros de 32 bits: se arma con una comparacion.
+__attribute__((target("sse2")))
+static inline __m128i max_epi32_sse2(__m128i a, __m128i b)
+{
+	__m128i mayor = _mm_cmpgt_epi32(a, b);
+	return _mm_or_si128(_mm_and_si128(mayor, a), _mm_andnot_si128(mayor, b));
+}
+
+__attribute__((target("sse2")))
+static int maximo_sse2(const int *datos, size_t n)
+{
+	if (n < 4) return maximo_escalar(datos, n);
+
+	__m128i max = _mm_loadu_si128((const __m128i*)datos);
 	size_t i;
-	bool ok = true;
-	for (i = 0; i < tam; i++)
+	for (i = 4; i + 4 <= n; i += 4)
+		max = max_epi32_sse2(max, _mm_loadu_si128((const __m128i*)(datos + i)));
+
+	int parcial[4];
+	_mm_storeu_si128((__m128i*)parcial, max);
+	int resultado = maximo_escalar(parcial, 4);
+	for (; i < n; i++)
+		if (datos[i] > resultado) resultado = datos[i];
+	return resultado;
+}
+
+__attribute__((target("sse2")))
+static long long sumar_sse2(const int *datos, size_t n)
+{
+	// Se acumula en 64 bits para no desbordar: cada int se extiende con su signo.
+	__m128i suma = _mm_setzero_si128();
+	size_t i;
+	for (i = 0; i + 4 <= n; i += 4)
 	{
-		// Si algun elemento no se pudo guardar correctamente, ok sera false
-		ok &= vector_guardar(vec_vol, i, i);
+		__m128i v = _mm_loadu_si128((const __m128i*)(datos + i));
+		__m128i signo = _mm_srai_epi32(v, 31);
+		suma = _mm_add_epi64(suma, _mm_unpacklo_epi32(v, signo));
+		suma = _mm_add_epi64(suma, _mm_unpackhi_epi32(v, signo));
 	}
-	print_test("se pudieron guardar todos los elementos", ok);
-	print_test("no se puede guardar un elemento en vec_vol[tam]", !vector_guardar(vec_vol, tam, 10));
-	
-	/* Pruebo que lo guardado sea correcto */
-	ok = true;
-	int valor;
-	for (i = 0; i < tam; i++)
+	long long parcial[2];
+	_mm_storeu_si128((__m128i*)parcial, suma);
+	return parcial[0] + parcial[1] + sumar_escalar(datos + i, n - i);
+}
+
+__attribute__((target("sse2")))
+static size_t buscar_sse2(const int *datos, size_t n, int valor)
+{
+	__m128i buscado = _mm_set1_epi32(valor);
+	size_t i;
+	for (i = 0; i + 4 <= n; i += 4)
 	{
-		ok &= vector_obtener(vec_vol, i, &valor);
-		ok &= (valor == i);
+		__m128i iguales = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(datos + i)), buscado);
+		int mascara = _mm_movemask_ps(_mm_castsi128_ps(iguales));
+		if (mascara) return i + __builtin_ctz(mascara);
 	}
-	print_test("se pudieron obtener todos los elementos", ok);
-	print_test("no se puede obtener el valor de vec_vol[tam]", !vector_obtener(vec_vol, tam, &valor));
-	
-	/* Destruyo el vector*/
-	vector_destruir(vec_vol);
-	print_test("el vector fue destruido", true);
+	return i + buscar_escalar(datos + i, n - i, valor);
+}
+
+__attribute__((target("sse2")))
+static size_t diferencia_sse2(const int *a, const int *b, size_t n)
+{
+	size_t i;
+	for (i = 0; i + 4 <= n; i += 4)
+	{
+		__m128i iguales = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(a + i)),
+										  _mm_loadu_si128((const __m128i*)(b + i)));
+		int mascara = _mm_movemask_ps(_mm_castsi128_ps(iguales)) ^ 0xF;
+		if (mascara) return i + __builtin_ctz(mascara);
+	}
+	return i + diferencia_escalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("sse2")))
+static void llenar_sse2(int *datos, size_t n, int valor)
+{
+	__m128i v = _mm_set1_epi32(valor);
+	size_t i;
+	for (i = 0; i + 4 <= n; i += 4)
+		_mm_storeu_si128((__m128i*)(datos + i), v);
+	llenar_escalar(datos + i, n - i, valor);
+}
+
+static const operaciones_t operaciones_sse2 =
+{
+	"sse2", maximo_sse2, sumar_sse2, buscar_sse2, diferencia_sse2, llenar_sse2
+};
+
+/*                         Version AVX2 (8 int)                   */
+
+__attribute__((target("avx2")))
+static int maximo_avx2(const int *datos, size_t n)
+{
+	if (n < 8) return maximo_escalar(datos, n);
+
+	__m256i max = _mm256_loadu_si256((const __m256i*)datos);
+	size_t i;
+	for (i = 8; i + 8 <= n; i += 8)
+		max = _mm256_max_epi32(max, _mm256_loadu_si256((const __m256i*)(datos + i)));
+
+	int parcial[8];
+	_mm256_storeu_si256((__m256i*)parcial, max);
+	int resultado = maximo_escalar(parcial, 8);
+	for (; i < n; i++)
+		if (datos[i] > resultado) resultado = datos[i];
+	return resultado;
 }
 
-/* Ejecuta todas las pruebas. */
-void pruebas_vector()
+__attribute__((target("avx2")))
+static long long sumar_avx2(const int *datos, size_t n)
 {
-	pruebas_vector_nulo();
-	pruebas_vector_algunos_elementos();
-	pruebas_vector_redimension();
-	pruebas_vector_volumen();
+	__m256i suma = _mm256_setzero_si256();
+	size_t i;
+	for (i = 0; i + 8 <= n; i += 8)
+	{
+		__m128i bajo = _mm_loadu_si128((const __m128i*)(datos + i));
+		__m128i alto = _mm_loadu_si128((const __m128i*)(datos + i + 4));
+		suma = _mm256_add_epi64(suma, _mm256_cvtepi32_epi64(bajo));
+		suma = _mm256_add_epi64(suma, _mm256_cvtepi32_epi64(alto));
+	}
+	long long parcial[4];
+	_mm256_storeu_si256((__m256i*)parcial, suma);
+	return parcial[0] + parcial[1] + parcial[2] + parcial[3] + sumar_escalar(datos + i, n - i);
 }
 
-/* Programa principal. */
-int main(void)
+__attribute__((target("avx2")))
+static size_t buscar_avx2(const int *datos, size_t n, int valor)
 {
-	pruebas_vector();
+	__m256i buscado = _mm256_set1_epi32(valor);
+	size_t i;
+	for (i = 0; i + 8 <= n; i += 8)
+	{
+		__m256i iguales = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(datos + i)), buscado);
+		int mascara = _mm256_movemask_ps(_mm256_castsi256_ps(iguales));
+		if (mascara) return i + __builtin_ctz(mascara);
+	}
+	return i + buscar_escalar(datos + i, n - i, valor);
+}
+
+__attribute__((target("avx2")))
+static size_t diferencia_avx2(const int *a, const int *b, size_t n)
+{
+	size_t i;
+	for (i = 0; i + 8 <= n; i += 8)
+	{
+		__m256i iguales = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(a + i)),
+											 _mm256_loadu_si256((const __m256i*)(b + i)));
+		int mascara = _mm256_movemask_ps(_mm256_castsi256_ps(iguales)) ^ 0xFF;
+		if (mascara) return i + __builtin_ctz(mascara);
+	}
+	return i + diferencia_escalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static void llenar_avx2(int *datos, size_t n, int valor)
+{
+	__m256i v = _mm256_set1_epi32(valor);
+	size_t i;
+	for (i = 0; i + 8 <= n; i += 8)
+		_mm256_storeu_si256((__m256i*)(datos + i), v);
+	llenar_escalar(datos + i, n - i, valor);
+}
+
+static const operaciones_t operaciones_avx2 =
+{
+	"avx2", maximo_avx2, sumar_avx2, buscar_avx2, diferencia_avx2, llenar_avx2
+};
+#endif // VECTOR_SIMD_X86
+
+static vector_simd_t nivel_maximo = VECTOR_AVX2;
+
+// Devuelve las operaciones a usar segun el procesador y nivel_maximo.
+static const operaciones_t* operaciones(void)
+{
+#ifdef VECTOR_SIMD_X86
+	static bool hay_avx2, hay_sse2, consultado = false;
+	if (!consultado)
+	{
+		__builtin_cpu_init();
+		hay_avx2 = __builtin_cpu_supports("avx2");
+		hay_sse2 = __builtin_cpu_supports("sse2");
+		consultado = true;
+	}
+	if (nivel_maximo >= VECTOR_AVX2 && hay_avx2) return &operaciones_avx2;
+	if (nivel_maximo >= VECTOR_SSE2 && hay_sse2) return &operaciones_sse2;
+#endif
+	return &operaciones_escalar;
+}
+
+// Almacena en pos la posicion del mayor elemento del vector (la primera,
+// si se repite).
+// Pre: el vector fue creado
+// Post: devuelve false si el vector es de tamao 0.
+bool vector_maximo(vector_t *vector, size_t *pos)
+{
+	if (vector->tam == 0) return false;
+
+	const operaciones_t* op = operaciones();
+	int max = op->maximo(vector->datos, vector->tam);
+	*pos = op->buscar(vector->datos, vector->tam, max);
+	return true;
+}
+
+// Devuelve la suma de todos los elementos del vector (0 si es de tamao 0).
+// Pre: el vector fue creado
+long long vector_sumar(vector_t *vector)
+{
+	return operaciones()->sumar(vector->datos, vector->tam);
+}
+
+// Almacena en pos la primera posicion donde esta valor.
+// Pre: el vector fue creado
+// Post: devuelve false si valor no esta en el vector.
+bool vector_buscar(vector_t *vector, int valor, size_t *pos)
+{
+	size_t i = operaciones()->buscar(vector->datos, vector->tam, valor);
+	if (i == vector->tam) return false;
+
+	*pos = i;
+	return true;
+}
+
+// Compara los vectores elemento a elemento. Devuelve -1 si vector1 es menor,
+// 0 si son iguales y 1 si vector2 es menor. Un vector es menor a otro cuando
+// el primer elemento en el que difieren no existe o es menor.
+// Pre: los vectores fueron creados
+int vector_comparar(vector_t *vector1, vector_t *vector2)
+{
+	size_t comun = vector1->tam < vector2->tam ? vector1->tam : vector2->tam;
+	size_t i = operaciones()->diferencia(vector1->datos, vector2->datos, comun);
+
+	if (i < comun) return vector1->datos[i] < vector2->datos[i] ? -1 : 1;
+	if (vector1->tam < vector2->tam) return -1;
+	if (vector1->tam > vector2->tam) return 1;
 	return 0;
 }
+
+// Guarda valor en todas las posiciones del vector.
+// Pre: el vector fue creado
+void vector_llenar(vector_t *vector, int valor)
+{
+	operaciones()->llenar(vector->datos, vector->tam, valor);
+}
+
+// Limita las operaciones anteriores a la version nivel: se usa la mayor
+// que no lo supere y que el procesador soporte (con VECTOR_AVX2, que es lo
+// que se usa al empezar, la mejor que haya). Sirve para probar cada version
+// y para comparar rendimiento.
+void vector_usar_simd(vector_simd_t nivel)
+{
+	nivel_maximo = nivel;
+}
+
+// Devuelve el nombre de la version que se esta usando: "avx2", "sse2"
+// o "escalar".
+const char* vector_simd_nombre(void)
+{
+	return operaciones()->nombre;
+}
@@ -0,0 +1,122 @@
+#ifndef VECTOR_DINAMICO_H
+#define VECTOR_DINAMICO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ ******************************************************************/
+
+/* El vector guarda enteros. El vector en s est definido en el .c. */
+
+typedef struct vector vector_t;
+
+/*******************************************************************
+ *                    PRIMITIVAS DEL VECTOR
+ ******************************************************************/
+
+// Crea un vector de tamao tam
+// Post: vector es una vector vaco de tamao tam
+vector_t* vector_crear(size_t tam);
+
+// Destruye el vector
+// Pre: el vector fue creado
+// Post: se eliminaron todos los elementos del vector
+void vector_destruir(vector_t *vector);
+
+// Cambia el tamao del vector
+// Pre: el vector fue creado
+// Post: el vector cambi de tamao a nuevo_tam y devuelve true
+// o el vector queda intacto y devuelve false si no se pudo cambiar el tamao
+// a nuevo_tam
+bool vector_redimensionar(vector_t *vector, size_t nuevo_tam);
+
+// Almacena en valor el dato guardado en la posicin pos del vector
+// Pre: el vector fue creado
+// Post: se almacen en valor el dato en la posicin pos. Devuelve false si la
+// posicin es invlida (fuera del rango del vector, que va de 0 a tamao-1)
+bool vector_obtener(vector_t *vector, size_t pos, int *valor);
+
+// Almacena el valor en la posicin pos
+// Pre: el vector fue creado
+// Post: se almacen el valor en la posicin pos. Devuelve false si la posicin
+// es invlida (fuera del rango del vector, que va de 0 a tamao-1) y true si
+// se guard el valor con xito.
+bool vector_guardar(vector_t *vector, size_t pos, int valor);
+
+// Devuelve el tamao del vector
+// Pre: el vector fue creado
+size_t vector_obtener_tamanio(vector_t *vector);
+
+/*******************************************************************
+ *                  VECTOR RESPALDADO EN UN ARCHIVO
+ ******************************************************************/
+
+/* Un vector mapeado guarda sus datos en un archivo (con mmap) en vez de en
+ * memoria pedida con malloc: puede ser mas grande que la memoria disponible
+ * y su contenido sobrevive al programa. Todas las primitivas anteriores
+ * funcionan igual sobre un vector mapeado. */
+
+// Crea un vector de tamao tam cuyos datos estan en el archivo ruta.
+// Si el archivo ya existia conserva su contenido (hasta tam elementos);
+// las posiciones que no estaban en el archivo valen 0.
+// Post: devuelve el vector o NULL en caso de error.
+vector_t* vector_mapear(const char *ruta, size_t tam);
+
+// Escribe en el archivo los cambios hechos al vector. Un vector mapeado
+// tambien se sincroniza al destruirlo.
+// Pre: el vector fue creado
+// Post: devuelve false en caso de error. Para un vector que no es mapeado
+// no hace nada y devuelve true.
+bool vector_sincronizar(vector_t *vector);
+
+/*******************************************************************
+ *                 OPERACIONES SOBRE TODO EL VECTOR
+ ******************************************************************/
+
+/* Estas operaciones recorren el vector completo. Usan instrucciones SIMD
+ * (AVX2 o SSE2) cuando el procesador las tiene, y si no un ciclo comun. */
+
+// Almacena en pos la posicion del mayor elemento del vector (la primera,
+// si se repite).
+// Pre: el vector fue creado
+// Post: devuelve false si el vector es de tamao 0.
+bool vector_maximo(vector_t *vector, size_t *pos);
+
+// Devuelve la suma de todos los elementos del vector (0 si es de tamao 0).
+// Pre: el vector fue creado
+long long vector_sumar(vector_t *vector);
+
+// Almacena en pos la primera posicion donde esta valor.
+// Pre: el vector fue creado
+// Post: devuelve false si valor no esta en el vector.
+bool vector_buscar(vector_t *vector, int valor, size_t *pos);
+
+// Compara los vectores elemento a elemento. Devuelve -1 si vector1 es menor,
+// 0 si son iguales y 1 si vector2 es menor. Un vector es menor a otro cuando
+// el primer elemento en el que difieren no existe o es menor.
+// Pre: los vectores fueron creados
+int vector_comparar(vector_t *vector1, vector_t *vector2);
+
+// Guarda valor en todas las posiciones del vector.
+// Pre: el vector fue creado
+void vector_llenar(vector_t *vector, int valor);
+
+// Versiones de las operaciones anteriores, de menor a mayor.
+typedef enum vector_simd
+{
+	VECTOR_ESCALAR, VECTOR_SSE2, VECTOR_AVX2
+} vector_simd_t;
+
+// Limita las operaciones anteriores a la version nivel: se usa la mayor
+// que no lo supere y que el procesador soporte (con VECTOR_AVX2, que es lo
+// que se usa al empezar, la mejor que haya). Sirve para probar cada version
+// y para comparar rendimiento.
+void vector_usar_simd(vector_simd_t nivel);
+
+// Devuelve el nombre de la version que se esta usando: "avx2", "sse2"
+// o "escalar".
+const char* vector_simd_nombre(void);
+
+#endif // VECTOR_DINAMICO_H
@@ -2,6 +2,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Capacidad de pila_crear, y por debajo de la cual nunca se achica la pila
+// (salvo que se pida otra con pila_crear_con_capacidad o pila_reservar).
+#define CAPACIDAD_INICIAL 16
 
 /*******************************************************************
  *Nombre: Francisco Joaquin Ordoñez Goncalves                      *
@@ -18,6 +24,7 @@ struct _pila
     void** datos;
     size_t tamanio;
     size_t cantidad;
+    size_t minimo; // la pila no se achica a menos de minimo
 };
 
 
@@ -30,6 +37,8 @@ struct _pila
  // o la pila queda intacta y devuelve false si no se pudo cambiar el tamanio
  // a nuevo_tam
 bool pila_redimensionar(pila_t *pila, size_t tam_nuevo){
+	if (tam_nuevo > SIZE_MAX / sizeof(void*))
+	    return false;
 	void* datos_nuevo = realloc(pila->datos, tam_nuevo * sizeof(void*));
 	if (datos_nuevo == NULL)
 	    return false;
@@ -39,6 +48,35 @@ bool pila_redimensionar(pila_t *pila, size_t tam_nuevo){
 	return true;
 }
 
+ // Se asegura de que entren n elementos mas, duplicando el tamanio las
+ // veces que haga falta (con un solo realloc).
+ // Post: devuelve false si no se pudo (la pila queda intacta).
+static bool pila_hacer_lugar(pila_t *pila, size_t n){
+	if (n > SIZE_MAX - pila->cantidad)
+	    return false;
+	size_t necesario = pila->cantidad + n;
+	if (necesario <= pila->tamanio)
+	    return true;
+
+	size_t tam_nuevo = pila->tamanio > 0 ? pila->tamanio : 1;
+	while (tam_nuevo < necesario)
+	    tam_nuevo = tam_nuevo > SIZE_MAX / 2 ? necesario : tam_nuevo * 2;
+	return pila_redimensionar(pila, tam_nuevo);
+}
+
+ // Achica la pila a la mitad (las veces que haga falta) mientras quede
+ // ocupada a lo sumo una cuarta parte. Crecer al llenarse y achicarse recien
+ // al cuarto hace que, despues de cualquier redimension, hagan falta muchas
+ // operaciones para la siguiente: apilar y desapilar alrededor de un mismo
+ // punto no puede llamar a realloc una y otra vez.
+static void pila_achicar_si_sobra(pila_t *pila){
+	size_t tam_nuevo = pila->tamanio;
+	while (pila->cantidad <= tam_nuevo / 4 && tam_nuevo / 2 >= pila->minimo && tam_nuevo / 2 > 0)
+	    tam_nuevo /= 2;
+	if (tam_nuevo != pila->tamanio)
+	    pila_redimensionar(pila, tam_nuevo); // si falla, queda mas grande
+}
+
 
 /*******************************************************************
  *                        IMPLEMENTACION                           *
@@ -47,12 +85,20 @@ bool pila_redimensionar(pila_t *pila, size_t tam_nuevo){
  // Crea una pila.
  // Post: devuelve una nueva pila vacía.
  pila_t* pila_crear(){
+	return pila_crear_con_capacidad(CAPACIDAD_INICIAL);
+ }
+
+ // Crea una pila con lugar para capacidad elementos, que no se va a
+ // achicar por debajo de ese tamanio.
+ // Post: devuelve una nueva pila vacía, o NULL en caso de error.
+ pila_t* pila_crear_con_capacidad(size_t capacidad){
 	pila_t* pila = malloc(sizeof(pila_t));
 	if (pila == NULL) return NULL;
 
-	pila->tamanio = 10;
+	pila->tamanio = capacidad > 0 ? capacidad : 1;
 	pila->cantidad = 0;
-	void** datos = malloc(pila->tamanio * sizeof(void*));
+	pila->minimo = capacidad;
+	void** datos = capacidad <= SIZE_MAX / sizeof(void*) ? malloc(pila->tamanio * sizeof(void*)) : NULL;
 	if (datos == NULL)
 	{
 	    free(pila);
@@ -62,6 +108,18 @@ bool pila_redimensionar(pila_t *pila, size_t tam_nuevo){
 	return pila;
  }
 
+// Se asegura de que entren capacidad elementos sin redimensionar, y a
+// partir de ahora la pila no se achica por debajo de ese tamanio.
+// Pre: la pila fue creada.
+// Post: devuelve false si no se pudo reservar la memoria (la pila queda
+// intacta).
+bool pila_reservar(pila_t *pila, size_t capacidad){
+	if (capacidad > pila->tamanio && !pila_redimensionar(pila, capacidad))
+	    return false;
+	pila->minimo = capacidad;
+	return true;
+}
+
 // Destruye la pila.
 // Pre: la pila fue creada.
 // Post: se eliminaron todos los elementos de la pila.
@@ -83,11 +141,9 @@ bool pila_esta_vacia(const pila_t *pila){
 // Pre: la pila fue creada.
 // Post: se agregó un nuevo elemento a la pila, valor es el nuevo tope.
 bool pila_apilar(pila_t *pila, void *valor){
-	int tam_limite = pila->tamanio * 0.8;
-
-	//Si cantidad supera el 80% de tamanio, se duplica la memoria disponible.
-	if (pila->cantidad > tam_limite){
-		if (! pila_redimensionar(pila, pila->tamanio * 2))
+	//Si la pila esta llena, se duplica la memoria disponible.
+	if (pila->cantidad == pila->tamanio){
+		if (! pila_hacer_lugar(pila, 1))
 			return false;
 	}
 	pila->datos[pila->cantidad] = valor;
@@ -95,6 +151,17 @@ bool pila_apilar(pila_t *pila, void *valor){
 	return true;
 }
 
+// Apila los n elementos de valores, en orden: valores[n-1] queda en el
+// tope. Devuelve falso en caso de error, y en ese caso no apila ninguno.
+// Pre: la pila fue creada. valores tiene al menos n elementos.
+bool pila_apilar_n(pila_t *pila, void **valores, size_t n){
+	if (! pila_hacer_lugar(pila, n))
+		return false;
+	memcpy(pila->datos + pila->cantidad, valores, n * sizeof(void*));
+	pila->cantidad += n;
+	return true;
+}
+
 // Obtiene el valor del tope de la pila. Si la pila tiene elementos,
 // se devuelve el valor del tope. Si está vacía devuelve NULL.
 // Pre: la pila fue creada.
@@ -119,13 +186,25 @@ void* pila_desapilar(pila_t *pila){
 		return NULL;
 	
 	pila->cantidad -= 1;
-	int tam_limite = pila->tamanio * 0.3;
+	void* valor = pila->datos[pila->cantidad];
 
-	//Si cantidad es menor que el 30% de tamanio, se disminuye
+	//Si queda ocupada a lo sumo la cuarta parte, se disminuye
 	//la memoria disponible a la mitad.
-	if(pila->cantidad < tam_limite){
-		size_t nuevo_tam = pila->tamanio * 0.5;
-		pila_redimensionar(pila, nuevo_tam);
-	}
-	return pila->datos[pila->cantidad];
+	if (pila->cantidad <= pila->tamanio / 4)
+		pila_achicar_si_sobra(pila);
+	return valor;
+}
+
+// Desapila hasta n elementos y los guarda en valores: valores[0] es el que
+// estaba en el tope. Devuelve cuántos desapiló (menos de n si la pila se
+// vació antes).
+// Pre: la pila fue creada. valores tiene lugar para n elementos.
+size_t pila_desapilar_n(pila_t *pila, void **valores, size_t n){
+	if (n > pila->cantidad)
+		n = pila->cantidad;
+	for (size_t i = 0; i < n; i++)
+		valores[i] = pila->datos[pila->cantidad - 1 - i];
+	pila->cantidad -= n;
+	pila_achicar_si_sobra(pila);
+	return n;
 }
@@ -2,6 +2,7 @@
 #define PILA_H
 
 #include <stdbool.h>
+#include <stddef.h>
 
 /* *****************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS
@@ -20,6 +21,18 @@ typedef struct _pila pila_t;
 // Post: devuelve una nueva pila vaca.
 pila_t* pila_crear();
 
+// Crea una pila con lugar para capacidad elementos sin redimensionar. La
+// pila no se achica por debajo de ese tamao.
+// Post: devuelve una nueva pila vaca, o NULL en caso de error.
+pila_t* pila_crear_con_capacidad(size_t capacidad);
+
+// Se asegura de que entren capacidad elementos sin redimensionar, y a
+// partir de ahora la pila no se achica por debajo de ese tamao.
+// Pre: la pila fue creada.
+// Post: devuelve false si no se pudo reservar la memoria (la pila queda
+// intacta).
+bool pila_reservar(pila_t *pila, size_t capacidad);
+
 // Destruye la pila.
 // Pre: la pila fue creada.
 // Post: se eliminaron todos los elementos de la pila.
@@ -49,4 +62,17 @@ void* pila_ver_tope(const pila_t *pila);
 // y la pila contiene un elemento menos.
 void* pila_desapilar(pila_t *pila);
 
+// Apila los n elementos de valores, en orden: valores[n-1] queda en el
+// tope. Devuelve falso en caso de error, y en ese caso no apila ninguno.
+// Pre: la pila fue creada. valores tiene al menos n elementos.
+// Post: la pila contiene n elementos ms.
+bool pila_apilar_n(pila_t *pila, void **valores, size_t n);
+
+// Desapila hasta n elementos y los guarda en valores: valores[0] es el que
+// estaba en el tope. Devuelve cuntos desapil (menos de n si la pila se
+// vaci antes).
+// Pre: la pila fue creada. valores tiene lugar para n elementos.
+// Post: la pila contiene tantos elementos menos como los devueltos.
+size_t pila_desapilar_n(pila_t *pila, void **valores, size_t n);
+
 #endif // PILA_H
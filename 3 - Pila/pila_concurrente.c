@@ -0,0 +1,294 @@
+#define _POSIX_C_SOURCE 200809L
+#include "pila_concurrente.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#define TAM_LINEA_CACHE 64
+
+// Los nodos se identifican con un indice de 32 bits: el 0 significa "ningun
+// nodo". Se piden de a bloques de NODOS_POR_BLOQUE, hasta MAX_BLOQUES.
+#define NODOS_POR_BLOQUE 4096
+#define MAX_BLOQUES 65536
+
+// Nodos libres que cada hilo guarda para si.
+#define TAM_CACHE 64
+
+#define TAM_ELIMINACION 16
+// Vueltas que espera un hilo en el arreglo de eliminacion a que llegue
+// otro con la operacion opuesta.
+#define ESPERA_ELIMINACION 128
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+typedef struct nodo{
+	void *dato;
+	uint32_t proximo;
+}nodo_t;
+
+// Tope de una pila de nodos: en los 32 bits bajos el indice del nodo y en
+// los altos un contador de cambios. Si un hilo lee el tope, otro saca ese
+// nodo y lo vuelve a poner, el indice es el mismo pero el contador no, y la
+// comparacion del primero falla (asi se evita el problema ABA).
+typedef uint64_t tope_t;
+
+struct pila_concurrente{
+	tope_t tope __attribute__((aligned(TAM_LINEA_CACHE)));
+	// Cada posicion esta vacia, tiene el dato de un hilo que quiere apilar,
+	// o esta marcada como tomada por un hilo que desapilo ese dato.
+	void *eliminacion[TAM_ELIMINACION] __attribute__((aligned(TAM_LINEA_CACHE)));
+};
+
+/*******************************************************************
+ *                 RESERVA COMUN DE NODOS                          *
+ ******************************************************************/
+
+static nodo_t *bloques[MAX_BLOQUES];
+static uint32_t nodos_entregados = 0;
+static pthread_mutex_t mutex_bloques = PTHREAD_MUTEX_INITIALIZER;
+static tope_t nodos_libres; // pila de nodos devueltos por los hilos
+
+static __thread uint32_t cache[TAM_CACHE];
+static __thread size_t cache_cantidad;
+static pthread_once_t cache_inicializada = PTHREAD_ONCE_INIT;
+static pthread_key_t clave_cache;
+
+// Marca de una posicion de eliminacion cuyo dato ya se llevo otro hilo.
+static char tomado;
+
+static uint32_t tope_indice(tope_t tope){
+	return (uint32_t)tope;
+}
+
+static tope_t tope_siguiente(tope_t tope, uint32_t indice){
+	return ((tope >> 32) + 1) << 32 | indice;
+}
+
+static nodo_t *nodo(uint32_t indice){
+	nodo_t *bloque = __atomic_load_n(&bloques[indice / NODOS_POR_BLOQUE], __ATOMIC_ACQUIRE);
+	return &bloque[indice % NODOS_POR_BLOQUE];
+}
+
+// Apila el nodo en la pila de nodos con tope *tope.
+static void tope_apilar(tope_t *tope, uint32_t indice){
+	tope_t actual = __atomic_load_n(tope, __ATOMIC_RELAXED);
+	do {
+		__atomic_store_n(&nodo(indice)->proximo, tope_indice(actual), __ATOMIC_RELAXED);
+	} while (!__atomic_compare_exchange_n(tope, &actual, tope_siguiente(actual, indice),
+			true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+// Intenta una vez sacar el nodo del tope *tope. Devuelve false si otro
+// hilo cambio el tope en el medio; si no, deja en *indice el nodo sacado
+// (0 si la pila estaba vacia).
+static bool tope_intentar_desapilar(tope_t *tope, uint32_t *indice){
+	tope_t actual = __atomic_load_n(tope, __ATOMIC_ACQUIRE);
+	*indice = tope_indice(actual);
+	if (*indice == 0) return true;
+
+	// El nodo puede haber sido sacado y reusado por otro hilo: entonces
+	// proximo no tiene sentido, pero el tope tampoco es el mismo y el
+	// intercambio falla. El nodo sigue siendo memoria valida.
+	uint32_t proximo = __atomic_load_n(&nodo(*indice)->proximo, __ATOMIC_RELAXED);
+	return __atomic_compare_exchange_n(tope, &actual, tope_siguiente(actual, proximo),
+		false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+// Agrega cantidad nodos nuevos a la cache del hilo, pidiendo el bloque si
+// hace falta.
+// Pre: cantidad divide a NODOS_POR_BLOQUE.
+static bool reserva_crear_nodos(uint32_t cantidad){
+	uint32_t primero = __atomic_fetch_add(&nodos_entregados, cantidad, __ATOMIC_RELAXED);
+	if ((uint64_t)primero + cantidad > (uint64_t)MAX_BLOQUES * NODOS_POR_BLOQUE)
+		return false;
+
+	// Todos los pedidos son del mismo tamaño, asi que los nodos estan en un
+	// solo bloque.
+	size_t b = primero / NODOS_POR_BLOQUE;
+	if (__atomic_load_n(&bloques[b], __ATOMIC_ACQUIRE) == NULL){
+		pthread_mutex_lock(&mutex_bloques);
+		if (bloques[b] == NULL){
+			nodo_t *bloque = malloc(NODOS_POR_BLOQUE * sizeof(nodo_t));
+			if (bloque == NULL){
+				pthread_mutex_unlock(&mutex_bloques);
+				return false;
+			}
+			__atomic_store_n(&bloques[b], bloque, __ATOMIC_RELEASE);
+		}
+		pthread_mutex_unlock(&mutex_bloques);
+	}
+	for (uint32_t i = 0; i < cantidad; i++)
+		if (primero + i != 0) // el indice 0 no se usa
+			cache[cache_cantidad++] = primero + i;
+	return true;
+}
+
+// Al terminar un hilo, sus nodos libres vuelven a la reserva comun.
+static void vaciar_cache(void *extra){
+	while (cache_cantidad > 0)
+		tope_apilar(&nodos_libres, cache[--cache_cantidad]);
+}
+
+static void inicializar_cache(void){
+	pthread_key_create(&clave_cache, vaciar_cache);
+}
+
+// Devuelve un nodo libre, o 0 si no hay memoria.
+static uint32_t reserva_pedir(void){
+	if (cache_cantidad == 0){
+		pthread_once(&cache_inicializada, inicializar_cache);
+		pthread_setspecific(clave_cache, &tomado); // cualquier valor no NULL
+
+		// Se trae media cache de la reserva comun, o nodos nuevos.
+		uint32_t indice;
+		while (cache_cantidad < TAM_CACHE / 2){
+			if (!tope_intentar_desapilar(&nodos_libres, &indice)) continue;
+			if (indice == 0) break;
+			cache[cache_cantidad++] = indice;
+		}
+		if (cache_cantidad == 0 && !reserva_crear_nodos(TAM_CACHE / 2))
+			return 0;
+	}
+	return cache[--cache_cantidad];
+}
+
+// Devuelve un nodo que ya no se usa.
+static void reserva_devolver(uint32_t indice){
+	if (cache_cantidad == TAM_CACHE){
+		while (cache_cantidad > TAM_CACHE / 2)
+			tope_apilar(&nodos_libres, cache[--cache_cantidad]);
+	}
+	cache[cache_cantidad++] = indice;
+}
+
+/*******************************************************************
+ *                 ARREGLO DE ELIMINACION                          *
+ ******************************************************************/
+
+static size_t aleatorio(void){
+	static __thread uint64_t semilla = 0;
+	if (semilla == 0) semilla = (uint64_t)(uintptr_t)&semilla | 1;
+
+	semilla ^= semilla << 13;
+	semilla ^= semilla >> 7;
+	semilla ^= semilla << 17;
+	return (size_t)semilla;
+}
+
+// Deja valor en una posicion al azar y espera un poco a que otro hilo se
+// lo lleve. Devuelve true si se lo llevaron (y entonces ya esta apilado y
+// desapilado).
+static bool eliminacion_apilar(pila_concurrente_t *pila, void *valor){
+	void **posicion = &pila->eliminacion[aleatorio() % TAM_ELIMINACION];
+	void *vacio = NULL;
+	if (!__atomic_compare_exchange_n(posicion, &vacio, valor, false,
+			__ATOMIC_RELEASE, __ATOMIC_RELAXED))
+		return false;
+
+	for (int i = 0; i < ESPERA_ELIMINACION; i++)
+		if (__atomic_load_n(posicion, __ATOMIC_ACQUIRE) == &tomado)
+			break;
+
+	// Si nadie lo tomo, se retira el dato. Si el intercambio falla es porque
+	// justo lo tomaron.
+	void *esperado = valor;
+	if (__atomic_compare_exchange_n(posicion, &esperado, NULL, false,
+			__ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+		return false;
+	__atomic_store_n(posicion, NULL, __ATOMIC_RELEASE);
+	return true;
+}
+
+// Busca en una posicion al azar un dato dejado por un hilo que quiere
+// apilar. Devuelve el dato, o NULL si no habia.
+static void *eliminacion_desapilar(pila_concurrente_t *pila){
+	void **posicion = &pila->eliminacion[aleatorio() % TAM_ELIMINACION];
+	void *valor = __atomic_load_n(posicion, __ATOMIC_ACQUIRE);
+	if (valor == NULL || valor == &tomado) return NULL;
+	if (!__atomic_compare_exchange_n(posicion, &valor, &tomado, false,
+			__ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+		return NULL;
+	return valor;
+}
+
+/*******************************************************************
+ *                        IMPLEMENTACION                           *
+ ******************************************************************/
+
+// Crea una pila.
+// Post: devuelve una nueva pila vacía, o NULL en caso de error.
+pila_concurrente_t* pila_concurrente_crear(void){
+	pila_concurrente_t *pila = NULL;
+	if (posix_memalign((void**)&pila, TAM_LINEA_CACHE, sizeof(pila_concurrente_t)) != 0)
+		return NULL;
+	pila->tope = 0;
+	for (size_t i = 0; i < TAM_ELIMINACION; i++)
+		pila->eliminacion[i] = NULL;
+	return pila;
+}
+
+// Destruye la pila. Si se recibe la función destruir_dato por parámetro,
+// para cada uno de los elementos de la pila llama a destruir_dato.
+// Pre: la pila fue creada y ningún otro hilo la está usando.
+// Post: se eliminaron todos los elementos de la pila.
+void pila_concurrente_destruir(pila_concurrente_t *pila, void destruir_dato(void*)){
+	void *dato;
+	while ((dato = pila_concurrente_desapilar(pila)) != NULL)
+		if (destruir_dato != NULL)
+			destruir_dato(dato);
+	free(pila);
+}
+
+// Devuelve verdadero o falso, según si la pila tiene o no elementos
+// apilados. Con otros hilos operando en simultáneo el resultado puede
+// dejar de ser cierto enseguida.
+// Pre: la pila fue creada.
+bool pila_concurrente_esta_vacia(const pila_concurrente_t *pila){
+	return tope_indice(__atomic_load_n(&pila->tope, __ATOMIC_ACQUIRE)) == 0;
+}
+
+// Agrega un nuevo elemento a la pila. Devuelve falso en caso de error.
+// Puede llamarse desde varios hilos a la vez.
+// Pre: la pila fue creada, valor no es NULL.
+// Post: se agregó un nuevo elemento a la pila.
+bool pila_concurrente_apilar(pila_concurrente_t *pila, void *valor){
+	uint32_t indice = reserva_pedir();
+	if (indice == 0) return false;
+	nodo_t *nuevo = nodo(indice);
+	__atomic_store_n(&nuevo->dato, valor, __ATOMIC_RELAXED);
+
+	tope_t actual = __atomic_load_n(&pila->tope, __ATOMIC_RELAXED);
+	while (true){
+		__atomic_store_n(&nuevo->proximo, tope_indice(actual), __ATOMIC_RELAXED);
+		if (__atomic_compare_exchange_n(&pila->tope, &actual, tope_siguiente(actual, indice),
+				false, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+			return true;
+		// Hay contencion: se prueba pasarle el dato a uno que desapila.
+		if (eliminacion_apilar(pila, valor)){
+			reserva_devolver(indice);
+			return true;
+		}
+		actual = __atomic_load_n(&pila->tope, __ATOMIC_RELAXED);
+	}
+}
+
+// Saca el elemento tope de la pila y devuelve su valor, o NULL si la pila
+// está vacía. Puede llamarse desde varios hilos a la vez.
+// Pre: la pila fue creada.
+void* pila_concurrente_desapilar(pila_concurrente_t *pila){
+	while (true){
+		uint32_t indice;
+		if (tope_intentar_desapilar(&pila->tope, &indice)){
+			if (indice == 0) return NULL;
+			void *valor = __atomic_load_n(&nodo(indice)->dato, __ATOMIC_RELAXED);
+			reserva_devolver(indice);
+			return valor;
+		}
+		// Hay contencion: se busca un dato que otro hilo este apilando.
+		void *valor = eliminacion_desapilar(pila);
+		if (valor != NULL) return valor;
+	}
+}
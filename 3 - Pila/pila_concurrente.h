@@ -0,0 +1,60 @@
+#ifndef PILA_CONCURRENTE_H
+#define PILA_CONCURRENTE_H
+
+#include <stdbool.h>
+
+/* *****************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* Pila de punteros genéricos que pueden usar varios hilos a la vez, sin
+ * mutex (pila de Treiber): el tope se cambia con una única operación
+ * atómica de comparar e intercambiar.
+ *
+ * Para evitar el problema ABA, el tope guarda junto al nodo un contador
+ * que aumenta en cada cambio, y los nodos nunca se devuelven al sistema:
+ * salen de una reserva común a todas las pilas concurrentes y vuelven a
+ * ella al desapilar. Cada hilo se queda con algunos nodos libres propios,
+ * así casi nunca tiene que tocar la reserva común.
+ *
+ * Cuando hay mucha contención, un hilo que apila y otro que desapila
+ * pueden encontrarse en un arreglo de eliminación y pasarse el dato
+ * directamente, sin tocar el tope.
+ *
+ * Como en pila.h, NULL indica una pila vacía, así que no se pueden apilar
+ * datos NULL. */
+
+typedef struct pila_concurrente pila_concurrente_t;
+
+/* *****************************************************************
+ *                    PRIMITIVAS DE LA PILA
+ * *****************************************************************/
+
+// Crea una pila.
+// Post: devuelve una nueva pila vacía, o NULL en caso de error.
+pila_concurrente_t* pila_concurrente_crear(void);
+
+// Destruye la pila. Si se recibe la función destruir_dato por parámetro,
+// para cada uno de los elementos de la pila llama a destruir_dato.
+// Pre: la pila fue creada y ningún otro hilo la está usando.
+// Post: se eliminaron todos los elementos de la pila.
+void pila_concurrente_destruir(pila_concurrente_t *pila, void destruir_dato(void*));
+
+// Devuelve verdadero o falso, según si la pila tiene o no elementos
+// apilados. Con otros hilos operando en simultáneo el resultado puede
+// dejar de ser cierto enseguida.
+// Pre: la pila fue creada.
+bool pila_concurrente_esta_vacia(const pila_concurrente_t *pila);
+
+// Agrega un nuevo elemento a la pila. Devuelve falso en caso de error.
+// Puede llamarse desde varios hilos a la vez.
+// Pre: la pila fue creada, valor no es NULL.
+// Post: se agregó un nuevo elemento a la pila.
+bool pila_concurrente_apilar(pila_concurrente_t *pila, void *valor);
+
+// Saca el elemento tope de la pila y devuelve su valor, o NULL si la pila
+// está vacía. Puede llamarse desde varios hilos a la vez.
+// Pre: la pila fue creada.
+void* pila_concurrente_desapilar(pila_concurrente_t *pila);
+
+#endif // PILA_CONCURRENTE_H
@@ -94,12 +94,66 @@ void pruebas_pila_con_strings()
 
 }
 
+void pruebas_pila_en_bloque()
+{	puts("\nPruebas de capacidad y en bloque \n");
+
+	int numeros[1000];
+	void* valores[1000];
+	for (int i = 0; i < 1000; i++)
+		valores[i] = &numeros[i];
+//16
+	pila_t *pila = pila_crear_con_capacidad(100);
+	print_test("Crear pila con capacidad 100", pila != NULL && pila_esta_vacia(pila));
+//17
+	print_test("Apilar 1000 elementos en bloque", pila_apilar_n(pila, valores, 1000));
+//18
+	print_test("El tope es el ultimo del bloque", pila_ver_tope(pila) == valores[999]);
+//19
+	void* sacados[1000];
+	bool ok = pila_desapilar_n(pila, sacados, 10) == 10;
+	for (int i = 0; i < 10; i++)
+		ok &= sacados[i] == valores[999 - i];
+	print_test("Desapilar 10 en bloque empieza por el tope", ok);
+//20
+	print_test("El tope es el siguiente", pila_desapilar(pila) == valores[989]);
+//21
+	ok = pila_desapilar_n(pila, sacados, 1000) == 989;
+	for (int i = 0; i < 989; i++)
+		ok &= sacados[i] == valores[988 - i];
+	print_test("Desapilar mas de los que hay devuelve los que habia", ok && pila_esta_vacia(pila));
+//22
+	print_test("Desapilar en bloque una pila vacia devuelve 0", pila_desapilar_n(pila, sacados, 5) == 0);
+//23
+	print_test("Apilar 0 elementos en bloque", pila_apilar_n(pila, valores, 0) && pila_esta_vacia(pila));
+//24
+	ok = pila_reservar(pila, 5000);
+	for (int i = 0; i < 5000 && ok; i++)
+		ok = pila_apilar(pila, valores[i % 1000]);
+	while (!pila_esta_vacia(pila))
+		pila_desapilar(pila);
+	print_test("Reservar 5000, apilar y desapilar 5000", ok);
+//25
+	ok = true;
+	for (int i = 0; i < 100000 && ok; i++){
+		ok = pila_apilar(pila, valores[i % 1000]);
+		if (i % 3 == 2){
+			ok &= pila_desapilar(pila) == valores[i % 1000];
+			ok &= pila_desapilar(pila) == valores[(i - 1) % 1000];
+		}
+	}
+	print_test("Apilar y desapilar alternando mantiene el orden", ok);
+//26
+	pila_destruir(pila);
+	print_test("Destruir pila", true);
+}
+
 
 /* Ejecuta todas las pruebas. */
 void pruebas_pila()
 {
 	pruebas_pila_con_numeros();
 	pruebas_pila_con_strings();
+	pruebas_pila_en_bloque();
 
 }
 
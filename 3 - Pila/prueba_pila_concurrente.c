@@ -0,0 +1,206 @@
+#define _POSIX_C_SOURCE 200809L
+#include "pila.h"
+#include "pila_concurrente.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+
+#define MAX_HILOS 8
+#define ELEMENTOS 1000000
+
+/*******************************************************************
+ *                        PRUEBAS UNITARIAS                        *
+ ******************************************************************/
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+double segundos_desde(struct timespec* inicio)
+{
+	struct timespec fin;
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	return (fin.tv_sec - inicio->tv_sec) + (fin.tv_nsec - inicio->tv_nsec) / 1e9;
+}
+
+// Los elementos de las pruebas son los numeros 1, 2, ..., pasados como
+// punteros, asi no hace falta memoria para ellos.
+#define ELEMENTO(i) ((void*)(uintptr_t)(i))
+#define NUMERO(p) ((size_t)(uintptr_t)(p))
+
+int destruidos = 0;
+
+void contar_destruido(void* dato){
+	destruidos++;
+}
+
+void pruebas_pila_concurrente_un_hilo()
+{	puts("Pruebas con un hilo \n");
+
+//1
+	pila_concurrente_t *pila = pila_concurrente_crear();
+	print_test("Crear una pila concurrente", pila != NULL);
+//2
+	print_test("La pila esta vacia", pila_concurrente_esta_vacia(pila));
+	print_test("Desapilar la pila vacia es NULL", pila_concurrente_desapilar(pila) == NULL);
+//3
+	bool ok = true;
+	for (size_t i = 1; i <= 1000; i++)
+		ok &= pila_concurrente_apilar(pila, ELEMENTO(i));
+	print_test("Apila 1000 elementos", ok && !pila_concurrente_esta_vacia(pila));
+//4
+	ok = true;
+	for (size_t i = 1000; i >= 1; i--)
+		ok &= pila_concurrente_desapilar(pila) == ELEMENTO(i);
+	print_test("Desapila 1000 elementos en orden inverso", ok && pila_concurrente_esta_vacia(pila));
+//5
+	ok = true;
+	for (size_t i = 1; i <= ELEMENTOS; i++)
+		ok &= pila_concurrente_apilar(pila, ELEMENTO(i));
+	print_test("Apila 1000000 elementos", ok);
+	pila_concurrente_t *otra = pila_concurrente_crear();
+	ok = true;
+	for (size_t i = ELEMENTOS; i > ELEMENTOS / 2; i--)
+		ok &= pila_concurrente_apilar(otra, pila_concurrente_desapilar(pila));
+	print_test("Pasa la mitad a otra pila reusando los nodos", ok);
+//6
+	pila_concurrente_destruir(pila, contar_destruido);
+	pila_concurrente_destruir(otra, contar_destruido);
+	print_test("Destruye las pilas con 1000000 de elementos", destruidos == ELEMENTOS);
+	puts("");
+}
+
+/*******************************************************************
+ *                   PRUEBAS CON VARIOS HILOS                      *
+ ******************************************************************/
+
+// Pila a medir: la concurrente o un pila_t comun protegido por un unico
+// mutex global.
+typedef struct pila_medida{
+	pila_concurrente_t* concurrente;
+	pila_t* pila;
+	pthread_mutex_t mutex;
+} pila_medida_t;
+
+bool medida_apilar(pila_medida_t* pila, void* valor)
+{
+	if (pila->concurrente) return pila_concurrente_apilar(pila->concurrente, valor);
+
+	pthread_mutex_lock(&pila->mutex);
+	bool ok = pila_apilar(pila->pila, valor);
+	pthread_mutex_unlock(&pila->mutex);
+	return ok;
+}
+
+void* medida_desapilar(pila_medida_t* pila)
+{
+	if (pila->concurrente) return pila_concurrente_desapilar(pila->concurrente);
+
+	pthread_mutex_lock(&pila->mutex);
+	void* valor = pila_desapilar(pila->pila);
+	pthread_mutex_unlock(&pila->mutex);
+	return valor;
+}
+
+typedef struct trabajo{
+	pila_medida_t* pila;
+	size_t desde;         // el hilo apila desde, ..., hasta - 1
+	size_t hasta;
+	unsigned char* vistos; // cuantas veces salio cada elemento
+} trabajo_t;
+
+// Cada hilo usa la pila como una lista de libres compartida: apila una
+// rafaga de sus elementos y despues desapila otra rafaga (que pueden ser
+// de cualquier hilo).
+#define RAFAGA 16
+
+void* hilo_trabajador(void* extra)
+{
+	trabajo_t* trabajo = extra;
+	for (size_t i = trabajo->desde; i < trabajo->hasta; i += RAFAGA){
+		for (size_t j = i; j < i + RAFAGA && j < trabajo->hasta; j++)
+			medida_apilar(trabajo->pila, ELEMENTO(j));
+		for (size_t j = i; j < i + RAFAGA && j < trabajo->hasta; j++){
+			void* valor = medida_desapilar(trabajo->pila);
+			if (valor) __atomic_add_fetch(&trabajo->vistos[NUMERO(valor)], 1, __ATOMIC_RELAXED);
+		}
+	}
+	return NULL;
+}
+
+// Reparte ELEMENTOS entre cant_hilos hilos que los apilan y desapilan, y
+// devuelve las operaciones (apilar + desapilar) por segundo. Verifica que
+// cada elemento haya salido exactamente una vez.
+double medir(pila_medida_t* pila, size_t cant_hilos, bool* ok)
+{
+	pthread_t hilos[MAX_HILOS];
+	trabajo_t trabajos[MAX_HILOS];
+	unsigned char* vistos = calloc(ELEMENTOS + 1, 1);
+	if (!vistos){
+		*ok = false;
+		return 0;
+	}
+
+	size_t por_hilo = ELEMENTOS / cant_hilos;
+	struct timespec inicio;
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (size_t i = 0; i < cant_hilos; i++){
+		trabajos[i].pila = pila;
+		trabajos[i].desde = 1 + i * por_hilo;
+		trabajos[i].hasta = i == cant_hilos - 1 ? ELEMENTOS + 1 : 1 + (i + 1) * por_hilo;
+		trabajos[i].vistos = vistos;
+		pthread_create(&hilos[i], NULL, hilo_trabajador, &trabajos[i]);
+	}
+	for (size_t i = 0; i < cant_hilos; i++)
+		pthread_join(hilos[i], NULL);
+	double segundos = segundos_desde(&inicio);
+
+	// Lo que quedo en la pila tambien cuenta.
+	void* valor;
+	while ((valor = medida_desapilar(pila)) != NULL)
+		vistos[NUMERO(valor)]++;
+	for (size_t i = 1; i <= ELEMENTOS; i++)
+		*ok &= vistos[i] == 1;
+	free(vistos);
+	return 2.0 * ELEMENTOS / segundos;
+}
+
+void pruebas_pila_concurrente_varios_hilos()
+{	puts("Pruebas con varios hilos (1000000 de elementos) \n");
+
+	pila_medida_t global = { NULL, pila_crear() };
+	pthread_mutex_init(&global.mutex, NULL);
+	pila_medida_t concurrente = { pila_concurrente_crear(), NULL };
+
+	bool ok = true;
+	printf("%8s %18s %18s\n", "hilos", "mutex global", "pila concurrente");
+	for (size_t cant_hilos = 1; cant_hilos <= MAX_HILOS; cant_hilos *= 2){
+		double ops_global = medir(&global, cant_hilos, &ok);
+		double ops_concurrente = medir(&concurrente, cant_hilos, &ok);
+		printf("%8zu %13.0f op/s %13.0f op/s\n", cant_hilos, ops_global, ops_concurrente);
+	}
+	print_test("Con varios hilos no se pierde ni se repite ningun elemento", ok);
+
+	pila_destruir(global.pila);
+	pthread_mutex_destroy(&global.mutex);
+	pila_concurrente_destruir(concurrente.concurrente, NULL);
+}
+
+/* Ejecuta todas las pruebas. */
+void pruebas_pila_concurrente()
+{
+	pruebas_pila_concurrente_un_hilo();
+	pruebas_pila_concurrente_varios_hilos();
+}
+
+/* Programa principal. */
+int main(void)
+{
+	pruebas_pila_concurrente();
+	return 0;
+}
@@ -0,0 +1,104 @@
+#define _POSIX_C_SOURCE 200809L
+#include "pila.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*******************************************************************
+ *              MEDICION DE LAS REDIMENSIONES DE LA PILA            *
+ ******************************************************************/
+
+/* Se compila con -Wl,--wrap=realloc: cada llamada a realloc de pila.c pasa
+ * por __wrap_realloc, que las cuenta antes de llamar a la verdadera. */
+
+void* __real_realloc(void* ptr, size_t tam);
+
+static size_t reallocs = 0;
+
+void* __wrap_realloc(void* ptr, size_t tam)
+{
+	reallocs++;
+	return __real_realloc(ptr, tam);
+}
+
+#define OPERACIONES 10000000
+
+double segundos_desde(struct timespec* inicio)
+{
+	struct timespec fin;
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	return (fin.tv_sec - inicio->tv_sec) + (fin.tv_nsec - inicio->tv_nsec) / 1e9;
+}
+
+// Desde cada profundidad entre 0 y 63 apila AMPLITUD elementos y los vuelve
+// a desapilar, muchas veces: es el peor caso para una pila que crece y se
+// achica con umbrales cercanos entre si.
+#define AMPLITUD 8
+void oscilar(pila_t* pila, int dato)
+{
+	for (int profundidad = 0; profundidad < 64; profundidad++)
+	{
+		for (int i = 0; i < OPERACIONES / 64 / (2 * AMPLITUD); i++)
+		{
+			for (int j = 0; j < AMPLITUD; j++)
+				pila_apilar(pila, &dato);
+			for (int j = 0; j < AMPLITUD; j++)
+				pila_desapilar(pila);
+		}
+		pila_apilar(pila, &dato);
+	}
+	while (!pila_esta_vacia(pila))
+		pila_desapilar(pila);
+}
+
+// Simula un DFS: rafagas de apilados y desapilados de largo al azar, con
+// la profundidad moviendose entre 0 y unos cientos de miles.
+void rafagas(pila_t* pila, int dato)
+{
+	size_t cantidad = 0;
+	srand(42);
+	for (size_t hechas = 0; hechas < OPERACIONES; )
+	{
+		size_t largo = rand() % 2000;
+		bool apilar = cantidad < 1000 || (cantidad < 500000 && rand() % 2);
+		for (size_t i = 0; i < largo; i++, hechas++)
+		{
+			if (apilar)
+			{
+				pila_apilar(pila, &dato);
+				cantidad++;
+			}
+			else if (cantidad > 0)
+			{
+				pila_desapilar(pila);
+				cantidad--;
+			}
+		}
+	}
+	while (!pila_esta_vacia(pila))
+		pila_desapilar(pila);
+}
+
+// Corre el escenario sobre la pila e imprime el tiempo y los realloc.
+void medir(const char* nombre, pila_t* pila, void escenario(pila_t*, int))
+{
+	struct timespec inicio;
+	reallocs = 0;
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	escenario(pila, 1);
+	double ms = segundos_desde(&inicio) * 1000;
+	printf("%-24s %10.2f %10zu\n", nombre, ms, reallocs);
+	pila_destruir(pila);
+}
+
+/* Programa principal. */
+int main(void)
+{
+	printf("%d operaciones por escenario\n", OPERACIONES);
+	printf("%-24s %10s %10s\n", "escenario", "ms", "reallocs");
+	medir("oscilar", pila_crear(), oscilar);
+	medir("rafagas", pila_crear(), rafagas);
+	medir("rafagas reservando", pila_crear_con_capacidad(500000), rafagas);
+	return 0;
+}
@@ -20,12 +20,28 @@
  struct cola{
  	nodo_cola_t *ultimo;
  	nodo_cola_t *primero;
+ 	pool_t *pool; // de donde salen los nodos, o NULL si se usa malloc
+ 	bool pool_propio;
  };
 
  /*******************************************************************
  *                        FUNCIONES AUXILIARES                      *
  *******************************************************************/
 
+// Pide un nodo al pool de la cola o, si no tiene, a malloc.
+static nodo_cola_t *nodo_crear(cola_t *cola){
+	if (cola->pool != NULL) return pool_pedir(cola->pool);
+	return malloc(sizeof(nodo_cola_t));
+}
+
+// Libera un nodo pedido con nodo_crear.
+static void nodo_destruir(cola_t *cola, nodo_cola_t *nodo){
+	if (cola->pool != NULL)
+		pool_devolver(cola->pool, nodo);
+	else
+		free(nodo);
+}
+
  /*******************************************************************
  *                        IMPLEMENTACION                            *
  *******************************************************************/
@@ -33,21 +49,58 @@
  // Crea una cola.
 // Post: devuelve una nueva cola vacía.
 cola_t* cola_crear(){
-	cola_t* cola = malloc(sizeof(nodo_cola_t));
+	cola_t* cola = malloc(sizeof(cola_t));
 	if (cola == NULL)
 		return NULL;
 	cola->ultimo = NULL;
 	cola->primero = NULL;
+	cola->pool = NULL;
+	cola->pool_propio = false;
+	return cola;
+}
+
+// Crea una cola que pide sus nodos a pool en lugar de hacer un malloc por
+// cada elemento. Si pool es NULL, la cola crea un pool propio.
+// Pre: pool es NULL o fue creado con un tamaño de al menos cola_tam_nodo().
+// Post: devuelve una nueva cola vacía, o NULL en caso de error.
+cola_t* cola_crear_con_pool(pool_t *pool){
+	if (pool != NULL && pool_tam_objeto(pool) < sizeof(nodo_cola_t))
+		return NULL;
+
+	cola_t* cola = cola_crear();
+	if (cola == NULL)
+		return NULL;
+	cola->pool = pool;
+	if (pool == NULL){
+		cola->pool = pool_crear(sizeof(nodo_cola_t));
+		cola->pool_propio = true;
+		if (cola->pool == NULL){
+			free(cola);
+			return NULL;
+		}
+	}
 	return cola;
 }
 
+// Devuelve el tamaño de los nodos de la cola, para crear un pool para ellos.
+size_t cola_tam_nodo(){
+	return sizeof(nodo_cola_t);
+}
+
 // Destruye la cola. Si se recibe la función destruir_dato por parámetro,
 // para cada uno de los elementos de la cola llama a destruir_dato.
 // Pre: la cola fue creada. destruir_dato es una función capaz de destruir
 // los datos de la cola, o NULL en caso de que no se la utilice.
 // Post: se eliminaron todos los elementos de la cola.
 void cola_destruir(cola_t *cola, void destruir_dato(void*)){
-	if (destruir_dato == NULL){
+	if (cola->pool_propio){
+		// Los nodos se liberan todos juntos con el pool.
+		if (destruir_dato != NULL)
+			for (nodo_cola_t *nodo = cola->primero; nodo != NULL; nodo = nodo->proximo)
+				destruir_dato(nodo->dato);
+		pool_destruir(cola->pool);
+	}
+	else if (destruir_dato == NULL){
 		while (cola->primero != NULL){
 			cola_desencolar(cola);
 		}
@@ -55,7 +108,8 @@ void cola_destruir(cola_t *cola, void destruir_dato(void*)){
 	else{
 		while (cola->primero != NULL){
 			nodo_cola_t *nodo_prox = cola->primero->proximo;
-			destruir_dato(cola->primero);
+			destruir_dato(cola->primero->dato);
+			nodo_destruir(cola, cola->primero);
 			cola->primero = nodo_prox;
 		}
 	}
@@ -73,7 +127,7 @@ bool cola_esta_vacia(const cola_t *cola){
 // Post: se agregó un nuevo elemento a la cola, valor se encuentra al final
 // de la cola.
 bool cola_encolar(cola_t *cola, void* valor){
-	nodo_cola_t* nodo_nuevo = malloc(sizeof(nodo_cola_t));
+	nodo_cola_t* nodo_nuevo = nodo_crear(cola);
 
 	if (nodo_nuevo == NULL)
 		return false;
@@ -115,8 +169,58 @@ void* cola_desencolar(cola_t *cola){
 
 	void *aux = cola->primero->dato;
 	nodo_cola_t *nodo_prox = cola->primero->proximo;
-	free(cola->primero);
+	nodo_destruir(cola, cola->primero);
 	cola->primero = nodo_prox;
 	return aux;
 	
+}
+
+// Agrega los n elementos de valores a la cola, en orden. Devuelve falso en
+// caso de error, y en ese caso no se agrega ninguno.
+// Pre: la cola fue creada. valores tiene al menos n elementos.
+// Post: los n elementos se encuentran al final de la cola, valores[n-1]
+// es el último.
+bool cola_encolar_n(cola_t *cola, void **valores, size_t n){
+	if (n == 0)
+		return true;
+
+	// Se arma la cadena de nodos aparte y se engancha recién al final, para
+	// no dejar la cola a medias si falla un pedido de memoria.
+	nodo_cola_t *primero = NULL, *ultimo = NULL;
+	for (size_t i = 0; i < n; i++){
+		nodo_cola_t *nodo = nodo_crear(cola);
+		if (nodo == NULL){
+			while (primero != NULL){
+				nodo_cola_t *nodo_prox = primero->proximo;
+				nodo_destruir(cola, primero);
+				primero = nodo_prox;
+			}
+			return false;
+		}
+		nodo->dato = valores[i];
+		nodo->proximo = NULL;
+		if (ultimo == NULL)
+			primero = nodo;
+		else
+			ultimo->proximo = nodo;
+		ultimo = nodo;
+	}
+
+	if (cola_esta_vacia(cola))
+		cola->primero = primero;
+	else
+		cola->ultimo->proximo = primero;
+	cola->ultimo = ultimo;
+	return true;
+}
+
+// Saca hasta n elementos del principio de la cola y los guarda en valores,
+// en orden. Devuelve cuántos sacó (menos de n si la cola se vació antes).
+// Pre: la cola fue creada. valores tiene lugar para n elementos.
+// Post: la cola contiene tantos elementos menos como los devueltos.
+size_t cola_desencolar_n(cola_t *cola, void **valores, size_t n){
+	size_t cantidad = 0;
+	while (cantidad < n && !cola_esta_vacia(cola))
+		valores[cantidad++] = cola_desencolar(cola);
+	return cantidad;
 }
\ No newline at end of file
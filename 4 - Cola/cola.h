@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include "pool.h"
 
 /* ******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS
@@ -20,6 +21,17 @@ typedef struct cola cola_t;
 // Post: devuelve una nueva cola vaca.
 cola_t* cola_crear();
 
+// Crea una cola que pide sus nodos a pool en lugar de hacer un malloc por
+// cada elemento. Varias colas (de un mismo hilo) pueden compartir un pool.
+// Si pool es NULL, la cola crea un pool propio y al destruirla libera todos
+// los nodos de una sola vez.
+// Pre: pool es NULL o fue creado con un tamao de al menos cola_tam_nodo().
+// Post: devuelve una nueva cola vaca, o NULL en caso de error.
+cola_t* cola_crear_con_pool(pool_t *pool);
+
+// Devuelve el tamao de los nodos de la cola, para crear un pool para ellos.
+size_t cola_tam_nodo();
+
 // Destruye la cola. Si se recibe la funcin destruir_dato por parmetro,
 // para cada uno de los elementos de la cola llama a destruir_dato.
 // Pre: la cola fue creada. destruir_dato es una funcin capaz de destruir
@@ -50,4 +62,17 @@ void* cola_ver_primero(const cola_t *cola);
 // contiene un elemento menos, si la cola no estaba vaca.
 void* cola_desencolar(cola_t *cola);
 
+// Agrega los n elementos de valores a la cola, en orden. Devuelve falso en
+// caso de error, y en ese caso no se agrega ninguno.
+// Pre: la cola fue creada. valores tiene al menos n elementos.
+// Post: los n elementos se encuentran al final de la cola, valores[n-1]
+// es el ltimo.
+bool cola_encolar_n(cola_t *cola, void **valores, size_t n);
+
+// Saca hasta n elementos del principio de la cola y los guarda en valores,
+// en orden. Devuelve cuntos sac (menos de n si la cola se vaci antes).
+// Pre: la cola fue creada. valores tiene lugar para n elementos.
+// Post: la cola contiene tantos elementos menos como los devueltos.
+size_t cola_desencolar_n(cola_t *cola, void **valores, size_t n);
+
 #endif // COLA_H
@@ -0,0 +1,198 @@
+#include "cola.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*******************************************************************
+ * Cola circular: implementa la misma interfaz que cola.c con un    *
+ * arreglo circular en vez de nodos enlazados. Encolar y desencolar *
+ * son O(1) (amortizado) y no piden memoria por cada elemento.      *
+ * Como no tiene nodos, ignora el pool de cola_crear_con_pool.      *
+ ******************************************************************/
+
+// La capacidad siempre es una potencia de 2, asi la posicion en el arreglo
+// se calcula con una mascara en lugar de con el resto de una division.
+#define CAPACIDAD_INICIAL 16
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+// Los elementos son datos[primero], datos[primero + 1], ... (con las
+// posiciones tomadas modulo capacidad).
+struct cola{
+	void **datos;
+	size_t capacidad;
+	size_t primero;
+	size_t cantidad;
+};
+
+ /*******************************************************************
+ *                        FUNCIONES AUXILIARES                      *
+ *******************************************************************/
+
+static size_t posicion(const cola_t *cola, size_t i){
+	return (cola->primero + i) & (cola->capacidad - 1);
+}
+
+// Se asegura de que entren n elementos mas, duplicando la capacidad las
+// veces que haga falta. Al agrandar, los elementos quedan al principio
+// del arreglo nuevo.
+static bool cola_hacer_lugar(cola_t *cola, size_t n){
+	if (n > SIZE_MAX / 2 - cola->cantidad)
+		return false;
+	size_t necesario = cola->cantidad + n;
+	if (necesario <= cola->capacidad)
+		return true;
+
+	size_t capacidad = cola->capacidad;
+	while (capacidad < necesario)
+		capacidad *= 2;
+	if (capacidad > SIZE_MAX / sizeof(void*))
+		return false;
+	void **datos = malloc(capacidad * sizeof(void*));
+	if (datos == NULL)
+		return false;
+
+	// Los elementos pueden estar partidos en dos tramos: desde primero
+	// hasta el final del arreglo, y desde el principio.
+	size_t tramo = cola->capacidad - cola->primero;
+	if (tramo > cola->cantidad)
+		tramo = cola->cantidad;
+	memcpy(datos, cola->datos + cola->primero, tramo * sizeof(void*));
+	memcpy(datos + tramo, cola->datos, (cola->cantidad - tramo) * sizeof(void*));
+
+	free(cola->datos);
+	cola->datos = datos;
+	cola->capacidad = capacidad;
+	cola->primero = 0;
+	return true;
+}
+
+ /*******************************************************************
+ *                        IMPLEMENTACION                            *
+ *******************************************************************/
+
+// Crea una cola.
+// Post: devuelve una nueva cola vacía.
+cola_t* cola_crear(){
+	cola_t* cola = malloc(sizeof(cola_t));
+	if (cola == NULL)
+		return NULL;
+	cola->datos = malloc(CAPACIDAD_INICIAL * sizeof(void*));
+	if (cola->datos == NULL){
+		free(cola);
+		return NULL;
+	}
+	cola->capacidad = CAPACIDAD_INICIAL;
+	cola->primero = 0;
+	cola->cantidad = 0;
+	return cola;
+}
+
+// Crea una cola. La cola circular no tiene nodos, asi que no usa el pool.
+// Post: devuelve una nueva cola vacía, o NULL en caso de error.
+cola_t* cola_crear_con_pool(pool_t *pool){
+	return cola_crear();
+}
+
+// Devuelve el tamaño que ocupa cada elemento en el arreglo de la cola.
+size_t cola_tam_nodo(){
+	return sizeof(void*);
+}
+
+// Destruye la cola. Si se recibe la función destruir_dato por parámetro,
+// para cada uno de los elementos de la cola llama a destruir_dato.
+// Pre: la cola fue creada. destruir_dato es una función capaz de destruir
+// los datos de la cola, o NULL en caso de que no se la utilice.
+// Post: se eliminaron todos los elementos de la cola.
+void cola_destruir(cola_t *cola, void destruir_dato(void*)){
+	if (destruir_dato != NULL)
+		for (size_t i = 0; i < cola->cantidad; i++)
+			destruir_dato(cola->datos[posicion(cola, i)]);
+	free(cola->datos);
+	free(cola);
+}
+
+// Devuelve verdadero o falso, según si la cola tiene o no elementos encolados.
+// Pre: la cola fue creada.
+bool cola_esta_vacia(const cola_t *cola){
+	return cola->cantidad == 0;
+}
+
+// Agrega un nuevo elemento a la cola. Devuelve falso en caso de error.
+// Pre: la cola fue creada.
+// Post: se agregó un nuevo elemento a la cola, valor se encuentra al final
+// de la cola.
+bool cola_encolar(cola_t *cola, void* valor){
+	if (cola->cantidad == cola->capacidad && !cola_hacer_lugar(cola, 1))
+		return false;
+
+	cola->datos[posicion(cola, cola->cantidad)] = valor;
+	cola->cantidad++;
+	return true;
+}
+
+// Obtiene el valor del primer elemento de la cola. Si la cola tiene
+// elementos, se devuelve el valor del primero, si está vacía devuelve NULL.
+// Pre: la cola fue creada.
+// Post: se devolvió el primer elemento de la cola, cuando no está vacía.
+void* cola_ver_primero(const cola_t *cola){
+	if (cola_esta_vacia(cola))
+		return NULL;
+	return cola->datos[cola->primero];
+}
+
+// Saca el primer elemento de la cola. Si la cola tiene elementos, se quita el
+// primero de la cola, y se devuelve su valor, si está vacía, devuelve NULL.
+// Pre: la cola fue creada.
+// Post: se devolvió el valor del primer elemento anterior, la cola
+// contiene un elemento menos, si la cola no estaba vacía.
+void* cola_desencolar(cola_t *cola){
+	if (cola_esta_vacia(cola))
+		return NULL;
+
+	void *valor = cola->datos[cola->primero];
+	cola->primero = posicion(cola, 1);
+	cola->cantidad--;
+	return valor;
+}
+
+// Agrega los n elementos de valores a la cola, en orden. Devuelve falso en
+// caso de error, y en ese caso no se agrega ninguno.
+// Pre: la cola fue creada. valores tiene al menos n elementos.
+// Post: los n elementos se encuentran al final de la cola, valores[n-1]
+// es el último.
+bool cola_encolar_n(cola_t *cola, void **valores, size_t n){
+	if (!cola_hacer_lugar(cola, n))
+		return false;
+
+	// Se copian a lo sumo dos tramos contiguos.
+	size_t fin = posicion(cola, cola->cantidad);
+	size_t tramo = cola->capacidad - fin;
+	if (tramo > n)
+		tramo = n;
+	memcpy(cola->datos + fin, valores, tramo * sizeof(void*));
+	memcpy(cola->datos, valores + tramo, (n - tramo) * sizeof(void*));
+	cola->cantidad += n;
+	return true;
+}
+
+// Saca hasta n elementos del principio de la cola y los guarda en valores,
+// en orden. Devuelve cuántos sacó (menos de n si la cola se vació antes).
+// Pre: la cola fue creada. valores tiene lugar para n elementos.
+// Post: la cola contiene tantos elementos menos como los devueltos.
+size_t cola_desencolar_n(cola_t *cola, void **valores, size_t n){
+	if (n > cola->cantidad)
+		n = cola->cantidad;
+
+	size_t tramo = cola->capacidad - cola->primero;
+	if (tramo > n)
+		tramo = n;
+	memcpy(valores, cola->datos + cola->primero, tramo * sizeof(void*));
+	memcpy(valores + tramo, cola->datos, (n - tramo) * sizeof(void*));
+	cola->primero = posicion(cola, n);
+	cola->cantidad -= n;
+	return n;
+}
@@ -0,0 +1,211 @@
+#define _POSIX_C_SOURCE 200809L
+#include "cola_mpmc.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define TAM_LINEA_CACHE 64
+// Intentos de desencolar antes de dormir en cola_mpmc_desencolar_esperando.
+#define INTENTOS_ANTES_DE_ESPERAR 64
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+// La celda de la posicion i (con los indices sin mascara) esta libre para
+// el encolado numero i cuando secuencia == i, y tiene el dato listo para
+// el desencolado numero i cuando secuencia == i + 1. Al desencolar se deja
+// en i + capacidad, libre para la siguiente vuelta.
+typedef struct celda{
+	size_t secuencia;
+	void *dato;
+}celda_t;
+
+struct cola_mpmc{
+	celda_t *celdas;
+	size_t mascara;
+
+	// Proximo encolado y proximo desencolado, en lineas de cache separadas.
+	size_t fondo __attribute__((aligned(TAM_LINEA_CACHE)));
+	size_t frente __attribute__((aligned(TAM_LINEA_CACHE)));
+
+	// Solo para cola_mpmc_desencolar_esperando.
+	pthread_mutex_t mutex __attribute__((aligned(TAM_LINEA_CACHE)));
+	pthread_cond_t hay_datos;
+	size_t esperando; // hilos dormidos o por dormir, con operaciones atomicas
+	bool cerrada;
+};
+
+/*******************************************************************
+ *                        FUNCIONES AUXILIARES                     *
+ ******************************************************************/
+
+// Despierta a los hilos que esperan un dato, si hay alguno.
+static void despertar(cola_mpmc_t *cola, bool a_todos){
+	// El encolado (o el cierre) tiene que quedar visible antes de leer
+	// esperando; del otro lado, el que espera incrementa esperando antes de
+	// volver a mirar la cola. Asi alguno de los dos ve al otro.
+	__atomic_thread_fence(__ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&cola->esperando, __ATOMIC_RELAXED) == 0) return;
+
+	pthread_mutex_lock(&cola->mutex);
+	if (a_todos)
+		pthread_cond_broadcast(&cola->hay_datos);
+	else
+		pthread_cond_signal(&cola->hay_datos);
+	pthread_mutex_unlock(&cola->mutex);
+}
+
+/*******************************************************************
+ *                        IMPLEMENTACION                           *
+ ******************************************************************/
+
+// Crea una cola con lugar para al menos capacidad elementos (se redondea
+// a una potencia de 2).
+// Pre: capacidad es mayor a 0.
+// Post: devuelve una nueva cola vacía, o NULL en caso de error.
+cola_mpmc_t* cola_mpmc_crear(size_t capacidad){
+	size_t tam = 1;
+	while (tam < capacidad){
+		if (tam > SIZE_MAX / 2 / sizeof(celda_t)) return NULL;
+		tam *= 2;
+	}
+
+	cola_mpmc_t* cola = NULL;
+	if (posix_memalign((void**)&cola, TAM_LINEA_CACHE, sizeof(cola_mpmc_t)) != 0)
+		return NULL;
+	cola->celdas = malloc(tam * sizeof(celda_t));
+	if (cola->celdas == NULL){
+		free(cola);
+		return NULL;
+	}
+	for (size_t i = 0; i < tam; i++)
+		cola->celdas[i].secuencia = i;
+	cola->mascara = tam - 1;
+	cola->fondo = 0;
+	cola->frente = 0;
+	pthread_mutex_init(&cola->mutex, NULL);
+	pthread_cond_init(&cola->hay_datos, NULL);
+	cola->esperando = 0;
+	cola->cerrada = false;
+	return cola;
+}
+
+// Destruye la cola. Si se recibe la función destruir_dato por parámetro,
+// para cada uno de los elementos de la cola llama a destruir_dato.
+// Pre: la cola fue creada y ningún hilo la está usando.
+// Post: se eliminaron todos los elementos de la cola.
+void cola_mpmc_destruir(cola_mpmc_t *cola, void destruir_dato(void*)){
+	if (destruir_dato != NULL){
+		void* dato;
+		while ((dato = cola_mpmc_desencolar(cola)) != NULL)
+			destruir_dato(dato);
+	}
+	pthread_mutex_destroy(&cola->mutex);
+	pthread_cond_destroy(&cola->hay_datos);
+	free(cola->celdas);
+	free(cola);
+}
+
+// Devuelve verdadero o falso, según si la cola tiene o no elementos
+// encolados. Con otros hilos operando en simultáneo el resultado puede
+// dejar de ser cierto enseguida.
+// Pre: la cola fue creada.
+bool cola_mpmc_esta_vacia(const cola_mpmc_t *cola){
+	size_t frente = __atomic_load_n(&cola->frente, __ATOMIC_ACQUIRE);
+	celda_t *celda = &cola->celdas[frente & cola->mascara];
+	return __atomic_load_n(&celda->secuencia, __ATOMIC_ACQUIRE) != frente + 1;
+}
+
+// Agrega un nuevo elemento a la cola. Devuelve falso si la cola está llena
+// o cerrada. Puede llamarse desde varios hilos a la vez.
+// Pre: la cola fue creada, valor no es NULL.
+// Post: se agregó un nuevo elemento al final de la cola.
+bool cola_mpmc_encolar(cola_mpmc_t *cola, void* valor){
+	if (__atomic_load_n(&cola->cerrada, __ATOMIC_RELAXED)) return false;
+
+	size_t fondo = __atomic_load_n(&cola->fondo, __ATOMIC_RELAXED);
+	celda_t *celda;
+	while (true){
+		celda = &cola->celdas[fondo & cola->mascara];
+		size_t secuencia = __atomic_load_n(&celda->secuencia, __ATOMIC_ACQUIRE);
+		intptr_t diferencia = (intptr_t)secuencia - (intptr_t)fondo;
+		if (diferencia == 0){
+			// La celda esta libre: se intenta reservarla avanzando el fondo.
+			// Si otro hilo la gano, fondo queda con el valor actual.
+			if (__atomic_compare_exchange_n(&cola->fondo, &fondo, fondo + 1, true,
+					__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				break;
+		}
+		else if (diferencia < 0)
+			return false; // la celda todavia tiene el dato de la vuelta anterior
+		else
+			fondo = __atomic_load_n(&cola->fondo, __ATOMIC_RELAXED);
+	}
+	celda->dato = valor;
+	__atomic_store_n(&celda->secuencia, fondo + 1, __ATOMIC_RELEASE);
+	despertar(cola, false);
+	return true;
+}
+
+// Saca el primer elemento de la cola y devuelve su valor, o NULL si la
+// cola está vacía. Nunca se bloquea. Puede llamarse desde varios hilos.
+// Pre: la cola fue creada.
+void* cola_mpmc_desencolar(cola_mpmc_t *cola){
+	size_t frente = __atomic_load_n(&cola->frente, __ATOMIC_RELAXED);
+	celda_t *celda;
+	while (true){
+		celda = &cola->celdas[frente & cola->mascara];
+		size_t secuencia = __atomic_load_n(&celda->secuencia, __ATOMIC_ACQUIRE);
+		intptr_t diferencia = (intptr_t)secuencia - (intptr_t)(frente + 1);
+		if (diferencia == 0){
+			if (__atomic_compare_exchange_n(&cola->frente, &frente, frente + 1, true,
+					__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				break;
+		}
+		else if (diferencia < 0)
+			return NULL; // todavia no se encolo nada en esta celda
+		else
+			frente = __atomic_load_n(&cola->frente, __ATOMIC_RELAXED);
+	}
+	void* valor = celda->dato;
+	__atomic_store_n(&celda->secuencia, frente + cola->mascara + 1, __ATOMIC_RELEASE);
+	return valor;
+}
+
+// Como cola_mpmc_desencolar, pero si la cola está vacía espera hasta que
+// otro hilo encole algo. Devuelve NULL solo si la cola se cerró y no
+// quedan elementos.
+// Pre: la cola fue creada.
+void* cola_mpmc_desencolar_esperando(cola_mpmc_t *cola){
+	// Primero se reintenta un poco sin dormir, que es mucho mas barato si
+	// el productor esta por encolar.
+	for (int i = 0; i < INTENTOS_ANTES_DE_ESPERAR; i++){
+		void* valor = cola_mpmc_desencolar(cola);
+		if (valor != NULL) return valor;
+		sched_yield();
+	}
+
+	pthread_mutex_lock(&cola->mutex);
+	__atomic_add_fetch(&cola->esperando, 1, __ATOMIC_SEQ_CST);
+	void* valor;
+	while ((valor = cola_mpmc_desencolar(cola)) == NULL &&
+			!__atomic_load_n(&cola->cerrada, __ATOMIC_SEQ_CST))
+		pthread_cond_wait(&cola->hay_datos, &cola->mutex);
+	__atomic_sub_fetch(&cola->esperando, 1, __ATOMIC_RELAXED);
+	pthread_mutex_unlock(&cola->mutex);
+
+	// Si se cerro mientras se encolaba lo ultimo, puede quedar algo.
+	return valor != NULL ? valor : cola_mpmc_desencolar(cola);
+}
+
+// Cierra la cola: a partir de ahora no se puede encolar, y los hilos que
+// esperan en cola_mpmc_desencolar_esperando se despiertan cuando la cola
+// queda vacía. Sirve para avisar a los consumidores que terminó el trabajo.
+// Pre: la cola fue creada y ningún hilo va a volver a encolar.
+void cola_mpmc_cerrar(cola_mpmc_t *cola){
+	__atomic_store_n(&cola->cerrada, true, __ATOMIC_SEQ_CST);
+	despertar(cola, true);
+}
@@ -0,0 +1,69 @@
+#ifndef COLA_MPMC_H
+#define COLA_MPMC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* Cola de punteros genéricos de capacidad fija que pueden usar varios
+ * hilos a la vez, tanto para encolar como para desencolar. Es un arreglo
+ * circular en el que cada posición tiene un número de secuencia que indica
+ * si está libre o tiene un dato listo (cola de Vyukov): los hilos compiten
+ * por las posiciones con operaciones atómicas, sin mutex.
+ * Desencolar tiene dos versiones: cola_mpmc_desencolar devuelve NULL si
+ * la cola está vacía, y cola_mpmc_desencolar_esperando duerme al hilo
+ * hasta que haya un elemento o la cola se cierre.
+ * Como en cola.h, NULL indica una cola vacía, así que no se pueden
+ * encolar datos NULL. */
+
+typedef struct cola_mpmc cola_mpmc_t;
+
+/* ******************************************************************
+ *                    PRIMITIVAS DE LA COLA
+ * *****************************************************************/
+
+// Crea una cola con lugar para al menos capacidad elementos (se redondea
+// a una potencia de 2).
+// Pre: capacidad es mayor a 0.
+// Post: devuelve una nueva cola vacía, o NULL en caso de error.
+cola_mpmc_t* cola_mpmc_crear(size_t capacidad);
+
+// Destruye la cola. Si se recibe la función destruir_dato por parámetro,
+// para cada uno de los elementos de la cola llama a destruir_dato.
+// Pre: la cola fue creada y ningún hilo la está usando.
+// Post: se eliminaron todos los elementos de la cola.
+void cola_mpmc_destruir(cola_mpmc_t *cola, void destruir_dato(void*));
+
+// Devuelve verdadero o falso, según si la cola tiene o no elementos
+// encolados. Con otros hilos operando en simultáneo el resultado puede
+// dejar de ser cierto enseguida.
+// Pre: la cola fue creada.
+bool cola_mpmc_esta_vacia(const cola_mpmc_t *cola);
+
+// Agrega un nuevo elemento a la cola. Devuelve falso si la cola está llena
+// o cerrada. Puede llamarse desde varios hilos a la vez.
+// Pre: la cola fue creada, valor no es NULL.
+// Post: se agregó un nuevo elemento al final de la cola.
+bool cola_mpmc_encolar(cola_mpmc_t *cola, void* valor);
+
+// Saca el primer elemento de la cola y devuelve su valor, o NULL si la
+// cola está vacía. Nunca se bloquea. Puede llamarse desde varios hilos.
+// Pre: la cola fue creada.
+void* cola_mpmc_desencolar(cola_mpmc_t *cola);
+
+// Como cola_mpmc_desencolar, pero si la cola está vacía espera hasta que
+// otro hilo encole algo. Devuelve NULL solo si la cola se cerró y no
+// quedan elementos.
+// Pre: la cola fue creada.
+void* cola_mpmc_desencolar_esperando(cola_mpmc_t *cola);
+
+// Cierra la cola: a partir de ahora no se puede encolar, y los hilos que
+// esperan en cola_mpmc_desencolar_esperando se despiertan cuando la cola
+// queda vacía. Sirve para avisar a los consumidores que terminó el trabajo.
+// Pre: la cola fue creada y ningún hilo va a volver a encolar.
+void cola_mpmc_cerrar(cola_mpmc_t *cola);
+
+#endif // COLA_MPMC_H
@@ -0,0 +1,125 @@
+#define _POSIX_C_SOURCE 200809L
+#include "cola_spsc.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TAM_LINEA_CACHE 64
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+// frente solo lo escribe el consumidor y fondo solo el productor; cada uno
+// va en su propia linea de cache para que los dos hilos no se peleen por
+// ella. Ademas cada hilo recuerda el ultimo valor que vio del indice del
+// otro, y solo lo vuelve a leer cuando con ese valor la cola parece llena
+// (o vacia).
+// Los indices crecen sin volver a 0: la posicion en el arreglo es el indice
+// con la mascara aplicada, y fondo - frente es la cantidad de elementos.
+struct cola_spsc{
+	void **datos;
+	size_t mascara;
+
+	// Del consumidor
+	size_t frente __attribute__((aligned(TAM_LINEA_CACHE)));
+	size_t fondo_visto;
+
+	// Del productor
+	size_t fondo __attribute__((aligned(TAM_LINEA_CACHE)));
+	size_t frente_visto;
+};
+
+/*******************************************************************
+ *                        IMPLEMENTACION                           *
+ ******************************************************************/
+
+// Crea una cola con lugar para al menos capacidad elementos (se redondea
+// a una potencia de 2).
+// Pre: capacidad es mayor a 0.
+// Post: devuelve una nueva cola vacía, o NULL en caso de error.
+cola_spsc_t* cola_spsc_crear(size_t capacidad){
+	size_t tam = 1;
+	while (tam < capacidad){
+		if (tam > SIZE_MAX / 2 / sizeof(void*)) return NULL;
+		tam *= 2;
+	}
+
+	cola_spsc_t* cola = NULL;
+	if (posix_memalign((void**)&cola, TAM_LINEA_CACHE, sizeof(cola_spsc_t)) != 0)
+		return NULL;
+	cola->datos = malloc(tam * sizeof(void*));
+	if (cola->datos == NULL){
+		free(cola);
+		return NULL;
+	}
+	cola->mascara = tam - 1;
+	cola->frente = 0;
+	cola->fondo_visto = 0;
+	cola->fondo = 0;
+	cola->frente_visto = 0;
+	return cola;
+}
+
+// Destruye la cola. Si se recibe la función destruir_dato por parámetro,
+// para cada uno de los elementos de la cola llama a destruir_dato.
+// Pre: la cola fue creada y ningún hilo la está usando.
+// Post: se eliminaron todos los elementos de la cola.
+void cola_spsc_destruir(cola_spsc_t *cola, void destruir_dato(void*)){
+	if (destruir_dato != NULL)
+		for (size_t i = cola->frente; i != cola->fondo; i++)
+			destruir_dato(cola->datos[i & cola->mascara]);
+	free(cola->datos);
+	free(cola);
+}
+
+// Devuelve verdadero o falso, según si la cola tiene o no elementos encolados.
+// Solo es exacto para el consumidor: el productor puede agregar más.
+// Pre: la cola fue creada.
+bool cola_spsc_esta_vacia(const cola_spsc_t *cola){
+	return __atomic_load_n(&cola->frente, __ATOMIC_ACQUIRE) ==
+		__atomic_load_n(&cola->fondo, __ATOMIC_ACQUIRE);
+}
+
+// Agrega un nuevo elemento a la cola. Devuelve falso si la cola está llena.
+// Pre: la cola fue creada, valor no es NULL. Solo la llama el productor.
+// Post: se agregó un nuevo elemento a la cola, valor se encuentra al final
+// de la cola.
+bool cola_spsc_encolar(cola_spsc_t *cola, void* valor){
+	size_t fondo = cola->fondo; // solo lo escribe este hilo
+	if (fondo - cola->frente_visto > cola->mascara){
+		cola->frente_visto = __atomic_load_n(&cola->frente, __ATOMIC_ACQUIRE);
+		if (fondo - cola->frente_visto > cola->mascara)
+			return false;
+	}
+	cola->datos[fondo & cola->mascara] = valor;
+	// Publica el dato: el consumidor que vea el fondo nuevo ve el dato.
+	__atomic_store_n(&cola->fondo, fondo + 1, __ATOMIC_RELEASE);
+	return true;
+}
+
+// Obtiene el valor del primer elemento de la cola, o NULL si está vacía.
+// Pre: la cola fue creada. Solo la llama el consumidor.
+void* cola_spsc_ver_primero(const cola_spsc_t *cola){
+	size_t frente = cola->frente;
+	if (frente == __atomic_load_n(&cola->fondo, __ATOMIC_ACQUIRE))
+		return NULL;
+	return cola->datos[frente & cola->mascara];
+}
+
+// Saca el primer elemento de la cola y devuelve su valor, o NULL si la
+// cola está vacía.
+// Pre: la cola fue creada. Solo la llama el consumidor.
+// Post: la cola contiene un elemento menos, si no estaba vacía.
+void* cola_spsc_desencolar(cola_spsc_t *cola){
+	size_t frente = cola->frente; // solo lo escribe este hilo
+	if (frente == cola->fondo_visto){
+		cola->fondo_visto = __atomic_load_n(&cola->fondo, __ATOMIC_ACQUIRE);
+		if (frente == cola->fondo_visto)
+			return NULL;
+	}
+	void* valor = cola->datos[frente & cola->mascara];
+	// Libera la posicion: el productor recien la reusa despues de ver esto.
+	__atomic_store_n(&cola->frente, frente + 1, __ATOMIC_RELEASE);
+	return valor;
+}
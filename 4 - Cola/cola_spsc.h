@@ -0,0 +1,59 @@
+#ifndef COLA_SPSC_H
+#define COLA_SPSC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS
+ * *****************************************************************/
+
+/* Cola de punteros genéricos para pasar datos entre exactamente dos hilos:
+ * uno solo encola (el productor) y otro solo desencola (el consumidor).
+ * Es un arreglo circular de capacidad fija sin mutex: cada operación
+ * termina en una cantidad acotada de pasos sin importar lo que haga el
+ * otro hilo (wait-free). Si la cola está llena, encolar devuelve false
+ * en lugar de esperar.
+ * Como en cola.h, NULL indica una cola vacía, así que no se pueden
+ * encolar datos NULL. */
+
+typedef struct cola_spsc cola_spsc_t;
+
+/* ******************************************************************
+ *                    PRIMITIVAS DE LA COLA
+ * *****************************************************************/
+
+// Crea una cola con lugar para al menos capacidad elementos (se redondea
+// a una potencia de 2).
+// Pre: capacidad es mayor a 0.
+// Post: devuelve una nueva cola vacía, o NULL en caso de error.
+cola_spsc_t* cola_spsc_crear(size_t capacidad);
+
+// Destruye la cola. Si se recibe la función destruir_dato por parámetro,
+// para cada uno de los elementos de la cola llama a destruir_dato.
+// Pre: la cola fue creada y ningún hilo la está usando.
+// Post: se eliminaron todos los elementos de la cola.
+void cola_spsc_destruir(cola_spsc_t *cola, void destruir_dato(void*));
+
+// Devuelve verdadero o falso, según si la cola tiene o no elementos encolados.
+// Solo es exacto para el consumidor: el productor puede agregar más.
+// Pre: la cola fue creada.
+bool cola_spsc_esta_vacia(const cola_spsc_t *cola);
+
+// Agrega un nuevo elemento a la cola. Devuelve falso si la cola está llena.
+// Pre: la cola fue creada, valor no es NULL. Solo la llama el productor.
+// Post: se agregó un nuevo elemento a la cola, valor se encuentra al final
+// de la cola.
+bool cola_spsc_encolar(cola_spsc_t *cola, void* valor);
+
+// Obtiene el valor del primer elemento de la cola, o NULL si está vacía.
+// Pre: la cola fue creada. Solo la llama el consumidor.
+void* cola_spsc_ver_primero(const cola_spsc_t *cola);
+
+// Saca el primer elemento de la cola y devuelve su valor, o NULL si la
+// cola está vacía.
+// Pre: la cola fue creada. Solo la llama el consumidor.
+// Post: la cola contiene un elemento menos, si no estaba vacía.
+void* cola_spsc_desencolar(cola_spsc_t *cola);
+
+#endif // COLA_SPSC_H
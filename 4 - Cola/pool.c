@@ -0,0 +1,158 @@
+#include "pool.h"
+#include <stdlib.h>
+#include <stdbool.h>
+
+// Los bloques empiezan con lugar para OBJETOS_PRIMER_BLOQUE objetos y cada
+// uno duplica al anterior, hasta OBJETOS_MAXIMOS_BLOQUE.
+#define OBJETOS_PRIMER_BLOQUE 64
+#define OBJETOS_MAXIMOS_BLOQUE 4096
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+// Tipo con la alineacion mas estricta que puede necesitar un objeto.
+typedef union alineacion{
+	long double ld;
+	long long ll;
+	void *p;
+	void (*f)(void);
+}alineacion_t;
+
+typedef struct bloque_pool{
+	struct bloque_pool *proximo;
+	alineacion_t objetos[];
+}bloque_pool_t;
+
+// Los objetos devueltos se enlazan usando su propia memoria.
+typedef struct objeto_libre{
+	struct objeto_libre *proximo;
+}objeto_libre_t;
+
+struct pool{
+	size_t tam_objeto;
+	size_t tam_real; // tam_objeto redondeado para respetar la alineacion
+	objeto_libre_t *libres;
+	bloque_pool_t *bloques;
+	char *siguiente; // primer objeto nunca entregado del ultimo bloque
+	char *fin_bloque;
+	size_t objetos_proximo_bloque;
+	size_t pedidos;
+	size_t en_uso;
+	size_t cant_bloques;
+};
+
+/*******************************************************************
+ *                        FUNCIONES AUXILIARES                     *
+ ******************************************************************/
+
+// Pide a malloc un bloque nuevo. Sus objetos se entregan en orden, sin
+// pasar por la lista de libres.
+static bool pool_agregar_bloque(pool_t *pool){
+	size_t cantidad = pool->objetos_proximo_bloque;
+	bloque_pool_t *bloque = malloc(sizeof(bloque_pool_t) + cantidad * pool->tam_real);
+	if (bloque == NULL) return false;
+
+	bloque->proximo = pool->bloques;
+	pool->bloques = bloque;
+	pool->siguiente = (char*)bloque->objetos;
+	pool->fin_bloque = pool->siguiente + cantidad * pool->tam_real;
+	pool->cant_bloques++;
+	if (cantidad < OBJETOS_MAXIMOS_BLOQUE)
+		pool->objetos_proximo_bloque = cantidad * 2;
+	return true;
+}
+
+/*******************************************************************
+ *                        IMPLEMENTACION                           *
+ ******************************************************************/
+
+// Crea un pool de objetos de tam_objeto bytes.
+// Pre: tam_objeto es mayor a 0.
+// Post: devuelve un pool sin objetos pedidos, o NULL en caso de error.
+pool_t *pool_crear(size_t tam_objeto){
+	pool_t *pool = malloc(sizeof(pool_t));
+	if (pool == NULL) return NULL;
+
+	size_t tam = tam_objeto < sizeof(objeto_libre_t) ? sizeof(objeto_libre_t) : tam_objeto;
+	size_t alineacion = sizeof(alineacion_t);
+	pool->tam_objeto = tam_objeto;
+	pool->tam_real = (tam + alineacion - 1) / alineacion * alineacion;
+	pool->libres = NULL;
+	pool->bloques = NULL;
+	pool->siguiente = NULL;
+	pool->fin_bloque = NULL;
+	pool->objetos_proximo_bloque = OBJETOS_PRIMER_BLOQUE;
+	pool->pedidos = 0;
+	pool->en_uso = 0;
+	pool->cant_bloques = 0;
+	return pool;
+}
+
+// Destruye el pool, liberando todos sus objetos (esten o no en uso).
+// Pre: el pool fue creado.
+// Post: los objetos pedidos al pool dejan de ser validos.
+void pool_destruir(pool_t *pool){
+	while (pool->bloques != NULL){
+		bloque_pool_t *proximo = pool->bloques->proximo;
+		free(pool->bloques);
+		pool->bloques = proximo;
+	}
+	free(pool);
+}
+
+// Pide un objeto al pool. Su contenido no esta inicializado.
+// Pre: el pool fue creado.
+// Post: devuelve el objeto, o NULL si no hay memoria.
+void *pool_pedir(pool_t *pool){
+	void *objeto;
+	if (pool->libres != NULL){
+		objeto = pool->libres;
+		pool->libres = pool->libres->proximo;
+	}
+	else{
+		if (pool->siguiente == pool->fin_bloque && !pool_agregar_bloque(pool))
+			return NULL;
+		objeto = pool->siguiente;
+		pool->siguiente += pool->tam_real;
+	}
+	pool->pedidos++;
+	pool->en_uso++;
+	return objeto;
+}
+
+// Devuelve al pool un objeto que ya no se usa. Si objeto es NULL no hace nada.
+// Pre: el pool fue creado y objeto se pidio a este mismo pool.
+// Post: el objeto puede volver a ser entregado por pool_pedir.
+void pool_devolver(pool_t *pool, void *objeto){
+	if (objeto == NULL) return;
+
+	objeto_libre_t *libre = objeto;
+	libre->proximo = pool->libres;
+	pool->libres = libre;
+	pool->en_uso--;
+}
+
+// Devuelve el tamaño de los objetos del pool.
+// Pre: el pool fue creado.
+size_t pool_tam_objeto(const pool_t *pool){
+	return pool->tam_objeto;
+}
+
+// Devuelve cuantas veces se llamo a pool_pedir con exito.
+// Pre: el pool fue creado.
+size_t pool_pedidos(const pool_t *pool){
+	return pool->pedidos;
+}
+
+// Devuelve cuantos objetos estan pedidos y todavia no se devolvieron.
+// Pre: el pool fue creado.
+size_t pool_en_uso(const pool_t *pool){
+	return pool->en_uso;
+}
+
+// Devuelve cuantos bloques se pidieron a malloc (cada uno con muchos objetos).
+// Pre: el pool fue creado.
+size_t pool_bloques(const pool_t *pool){
+	return pool->cant_bloques;
+}
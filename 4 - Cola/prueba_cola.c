@@ -102,6 +102,7 @@ void pruebas_cola_destruir(){
 	cola_destruir(cola, destruir_punto);
 	print_test("Destruir cola con struct punto encolado", true);
 	//22
+	p = malloc(sizeof(punto));
 	cola_t* cola_1 = cola_crear();
 	for(int i = 0; i<500; i++){
 		if (i%2==0)
@@ -115,11 +116,107 @@ void pruebas_cola_destruir(){
 
 }
 
+void pruebas_cola_en_bloque(){
+	//23
+	int valores[1000];
+	void *punteros[1000];
+	for (int i = 0; i < 1000; i++){
+		valores[i] = i;
+		punteros[i] = &valores[i];
+	}
+	cola_t *cola = cola_crear();
+	bool ok = cola_encolar_n(cola, punteros, 10);
+	print_test("Encolar 10 elementos juntos", ok && cola_ver_primero(cola) == &valores[0]);
+	//24
+	void *salida[1000];
+	print_test("Desencolar 5 juntos devuelve 5", cola_desencolar_n(cola, salida, 5) == 5);
+	ok = true;
+	for (int i = 0; i < 5; i++)
+		ok &= salida[i] == &valores[i];
+	print_test("Los 5 desencolados estan en orden", ok);
+	//25
+	for (int i = 10; i < 30; i++)
+		ok &= cola_encolar(cola, &valores[i]);
+	ok &= cola_encolar_n(cola, punteros + 30, 970);
+	print_test("Encolar de a uno y en bloque despues de desencolar", ok);
+	//26
+	ok = true;
+	for (int i = 5; i < 100; i++)
+		ok &= cola_desencolar(cola) == &valores[i];
+	print_test("Desencolar de a uno respeta el orden", ok);
+	//27
+	size_t cantidad = cola_desencolar_n(cola, salida, 1000);
+	ok = cantidad == 900;
+	for (size_t i = 0; i < cantidad && ok; i++)
+		ok &= salida[i] == &valores[100 + i];
+	print_test("Desencolar mas de lo que hay devuelve los que quedan", ok && cola_esta_vacia(cola));
+	//28
+	print_test("Desencolar en bloque una cola vacia devuelve 0", cola_desencolar_n(cola, salida, 10) == 0);
+	print_test("Encolar 0 elementos es true", cola_encolar_n(cola, punteros, 0) && cola_esta_vacia(cola));
+	cola_destruir(cola, NULL);
+}
+
+/* La cola circular no tiene nodos y no usa el pool. */
+#ifndef COLA_CIRCULAR
+void pruebas_cola_con_pool(){
+	//29
+	pool_t *pool = pool_crear(cola_tam_nodo());
+	cola_t *cola = cola_crear_con_pool(pool);
+	cola_t *cola_1 = cola_crear_con_pool(pool);
+	print_test("Crear dos colas que comparten un pool", cola != NULL && cola_1 != NULL);
+	//30
+	int valores[1000];
+	bool ok = true;
+	for (int i = 0; i < 1000; i++){
+		valores[i] = i;
+		ok &= cola_encolar(i % 2 ? cola : cola_1, &valores[i]);
+	}
+	print_test("Encolar 1000 elementos entre las dos colas", ok && pool_en_uso(pool) == 1000);
+	//31
+	print_test("Se pidieron pocos bloques al pool", pool_bloques(pool) < 10);
+	//32
+	ok = true;
+	for (int i = 1; i < 1000; i += 2)
+		ok &= cola_desencolar(cola) == &valores[i];
+	print_test("Desencolar respeta el orden", ok && cola_esta_vacia(cola));
+	print_test("Los nodos volvieron al pool", pool_en_uso(pool) == 500);
+	//33
+	size_t bloques = pool_bloques(pool);
+	for (int i = 0; i < 100000; i++){
+		cola_encolar(cola, &valores[0]);
+		cola_desencolar(cola);
+	}
+	print_test("Encolar y desencolar reutiliza los nodos", pool_bloques(pool) == bloques &&
+		pool_pedidos(pool) == 1000 + 100000);
+	//34
+	cola_destruir(cola_1, NULL);
+	print_test("Destruir una cola devuelve sus nodos", pool_en_uso(pool) == 0);
+	cola_destruir(cola, NULL);
+	pool_destruir(pool);
+	//35
+	pool_t *chico = pool_crear(1);
+	print_test("Crear con un pool de objetos chicos es NULL", cola_crear_con_pool(chico) == NULL);
+	pool_destruir(chico);
+	//36
+	cola = cola_crear_con_pool(NULL);
+	for (int i = 0; i < 1000; i++){
+		punto *p = malloc(sizeof(punto));
+		cola_encolar(cola, p);
+	}
+	cola_destruir(cola, destruir_punto);
+	print_test("Destruir cola con pool propio y 1000 elementos", true);
+}
+#endif
+
 /* Ejecuta todas las pruebas. */
 void pruebas_cola()
 {
 	pruebas_cola_generales();
 	pruebas_cola_destruir();
+	pruebas_cola_en_bloque();
+#ifndef COLA_CIRCULAR
+	pruebas_cola_con_pool();
+#endif
 }
 
 /* Programa principal. */
@@ -0,0 +1,266 @@
+#define _POSIX_C_SOURCE 200809L
+#include "cola.h"
+#include "cola_spsc.h"
+#include "cola_mpmc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#define MAX_HILOS 8
+#define CAPACIDAD 1024
+
+/*******************************************************************
+ *                        PRUEBAS UNITARIAS                        *
+ ******************************************************************/
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+double segundos_desde(struct timespec* inicio)
+{
+	struct timespec fin;
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	return (fin.tv_sec - inicio->tv_sec) + (fin.tv_nsec - inicio->tv_nsec) / 1e9;
+}
+
+// Los elementos de las pruebas son los numeros 1, 2, ..., pasados como
+// punteros, asi no hace falta memoria para ellos.
+#define ELEMENTO(i) ((void*)(uintptr_t)(i))
+#define NUMERO(p) ((size_t)(uintptr_t)(p))
+
+int destruidos = 0;
+
+void contar_destruido(void* dato){
+	destruidos++;
+}
+
+void pruebas_spsc_un_hilo(){
+	printf("INICIO DE PRUEBAS SPSC CON UN HILO\n");
+	cola_spsc_t* cola = cola_spsc_crear(5);
+	print_test("Se creo la cola spsc", cola != NULL);
+	print_test("La cola esta vacia", cola_spsc_esta_vacia(cola));
+	print_test("Desencolar la cola vacia es NULL", cola_spsc_desencolar(cola) == NULL);
+	print_test("Ver primero de la cola vacia es NULL", cola_spsc_ver_primero(cola) == NULL);
+
+	bool ok = true;
+	for (size_t i = 1; i <= 8; i++)
+		ok &= cola_spsc_encolar(cola, ELEMENTO(i));
+	print_test("Entran 8 elementos (la capacidad se redondea)", ok);
+	print_test("Encolar con la cola llena es false", !cola_spsc_encolar(cola, ELEMENTO(9)));
+	print_test("Ver primero es 1", cola_spsc_ver_primero(cola) == ELEMENTO(1));
+
+	ok = true;
+	for (size_t i = 1; i <= 4; i++)
+		ok &= cola_spsc_desencolar(cola) == ELEMENTO(i);
+	for (size_t i = 9; i <= 12; i++)
+		ok &= cola_spsc_encolar(cola, ELEMENTO(i));
+	for (size_t i = 5; i <= 10; i++)
+		ok &= cola_spsc_desencolar(cola) == ELEMENTO(i);
+	print_test("Encolar y desencolar dando la vuelta respeta el orden", ok);
+
+	cola_spsc_destruir(cola, contar_destruido);
+	print_test("Destruir llama a destruir_dato con los 2 restantes", destruidos == 2);
+}
+
+void pruebas_mpmc_un_hilo(){
+	printf("INICIO DE PRUEBAS MPMC CON UN HILO\n");
+	cola_mpmc_t* cola = cola_mpmc_crear(8);
+	print_test("Se creo la cola mpmc", cola != NULL);
+	print_test("La cola esta vacia", cola_mpmc_esta_vacia(cola));
+	print_test("Desencolar la cola vacia es NULL", cola_mpmc_desencolar(cola) == NULL);
+
+	bool ok = true;
+	for (size_t i = 1; i <= 8; i++)
+		ok &= cola_mpmc_encolar(cola, ELEMENTO(i));
+	print_test("Entran 8 elementos", ok && !cola_mpmc_esta_vacia(cola));
+	print_test("Encolar con la cola llena es false", !cola_mpmc_encolar(cola, ELEMENTO(9)));
+
+	ok = true;
+	for (size_t i = 1; i <= 5; i++)
+		ok &= cola_mpmc_desencolar(cola) == ELEMENTO(i);
+	for (size_t i = 9; i <= 13; i++)
+		ok &= cola_mpmc_encolar(cola, ELEMENTO(i));
+	for (size_t i = 6; i <= 12; i++)
+		ok &= cola_mpmc_desencolar(cola) == ELEMENTO(i);
+	print_test("Encolar y desencolar dando la vuelta respeta el orden", ok);
+	print_test("Desencolar esperando con un elemento lo devuelve",
+		cola_mpmc_desencolar_esperando(cola) == ELEMENTO(13));
+
+	cola_mpmc_encolar(cola, ELEMENTO(14));
+	cola_mpmc_cerrar(cola);
+	print_test("Encolar con la cola cerrada es false", !cola_mpmc_encolar(cola, ELEMENTO(15)));
+	print_test("Desencolar esperando con la cola cerrada devuelve lo que queda",
+		cola_mpmc_desencolar_esperando(cola) == ELEMENTO(14));
+	print_test("Desencolar esperando con la cola cerrada y vacia es NULL",
+		cola_mpmc_desencolar_esperando(cola) == NULL);
+
+	cola_mpmc_destruir(cola, NULL);
+	print_test("Se destruyo la cola mpmc", true);
+}
+
+/*******************************************************************
+ *                   PRUEBAS CON VARIOS HILOS                      *
+ ******************************************************************/
+
+// Cola a medir: una de las concurrentes o un cola_t comun protegido por
+// un unico mutex.
+typedef struct cola_medida{
+	cola_spsc_t* spsc;
+	cola_mpmc_t* mpmc;
+	cola_t* cola;
+	pthread_mutex_t mutex;
+} cola_medida_t;
+
+bool medida_encolar(cola_medida_t* cola, void* valor)
+{
+	if (cola->spsc) return cola_spsc_encolar(cola->spsc, valor);
+	if (cola->mpmc) return cola_mpmc_encolar(cola->mpmc, valor);
+
+	pthread_mutex_lock(&cola->mutex);
+	bool ok = cola_encolar(cola->cola, valor);
+	pthread_mutex_unlock(&cola->mutex);
+	return ok;
+}
+
+void* medida_desencolar(cola_medida_t* cola)
+{
+	if (cola->spsc) return cola_spsc_desencolar(cola->spsc);
+	if (cola->mpmc) return cola_mpmc_desencolar(cola->mpmc);
+
+	pthread_mutex_lock(&cola->mutex);
+	void* valor = cola_desencolar(cola->cola);
+	pthread_mutex_unlock(&cola->mutex);
+	return valor;
+}
+
+typedef struct trabajo{
+	cola_medida_t* cola;
+	size_t desde;        // el productor encola desde, ..., hasta - 1
+	size_t hasta;
+	size_t* restantes;   // cuanto falta desencolar entre todos los consumidores
+	unsigned char* vistos; // cuantas veces salio cada elemento
+	size_t anterior;     // ultimo elemento que saco el consumidor
+	bool en_orden;
+} trabajo_t;
+
+void* hilo_productor(void* extra)
+{
+	trabajo_t* trabajo = extra;
+	for (size_t i = trabajo->desde; i < trabajo->hasta; i++)
+		while (!medida_encolar(trabajo->cola, ELEMENTO(i)))
+			sched_yield(); // llena: se espera a los consumidores
+	return NULL;
+}
+
+void* hilo_consumidor(void* extra)
+{
+	trabajo_t* trabajo = extra;
+	trabajo->anterior = 0;
+	trabajo->en_orden = true;
+	while (__atomic_load_n(trabajo->restantes, __ATOMIC_RELAXED) > 0){
+		void* valor;
+		if (trabajo->cola->mpmc)
+			valor = cola_mpmc_desencolar_esperando(trabajo->cola->mpmc);
+		else
+			valor = medida_desencolar(trabajo->cola);
+		if (valor == NULL){
+			sched_yield();
+			continue;
+		}
+		size_t i = NUMERO(valor);
+		trabajo->en_orden &= i > trabajo->anterior;
+		trabajo->anterior = i;
+		__atomic_add_fetch(&trabajo->vistos[i], 1, __ATOMIC_RELAXED);
+		__atomic_sub_fetch(trabajo->restantes, 1, __ATOMIC_RELAXED);
+	}
+	return NULL;
+}
+
+// Corre cant_hilos productores y cant_hilos consumidores sobre la cola, y
+// devuelve los elementos por segundo que pasaron por ella. Verifica que
+// cada elemento salga exactamente una vez y, con un solo productor, que
+// salgan en orden.
+double medir(cola_medida_t* cola, size_t cant_hilos, size_t por_hilo, bool* ok)
+{
+	pthread_t productores[MAX_HILOS], consumidores[MAX_HILOS];
+	trabajo_t trabajos[MAX_HILOS];
+	size_t total = cant_hilos * por_hilo;
+	size_t restantes = total;
+	unsigned char* vistos = calloc(total + 1, 1);
+	if (!vistos){
+		*ok = false;
+		return 0;
+	}
+
+	struct timespec inicio;
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (size_t i = 0; i < cant_hilos; i++){
+		trabajos[i].cola = cola;
+		trabajos[i].desde = 1 + i * por_hilo;
+		trabajos[i].hasta = 1 + (i + 1) * por_hilo;
+		trabajos[i].restantes = &restantes;
+		trabajos[i].vistos = vistos;
+		pthread_create(&consumidores[i], NULL, hilo_consumidor, &trabajos[i]);
+		pthread_create(&productores[i], NULL, hilo_productor, &trabajos[i]);
+	}
+	for (size_t i = 0; i < cant_hilos; i++)
+		pthread_join(productores[i], NULL);
+	// Los consumidores que esperan en la cola mpmc se despiertan al cerrarla.
+	if (cola->mpmc)
+		cola_mpmc_cerrar(cola->mpmc);
+	for (size_t i = 0; i < cant_hilos; i++){
+		pthread_join(consumidores[i], NULL);
+		if (cant_hilos == 1) *ok &= trabajos[i].en_orden;
+	}
+	double segundos = segundos_desde(&inicio);
+
+	for (size_t i = 1; i <= total; i++)
+		*ok &= vistos[i] == 1;
+	free(vistos);
+	return total / segundos;
+}
+
+void pruebas_rendimiento(size_t por_hilo)
+{
+	printf("INICIO DE PRUEBAS CON VARIOS HILOS (%zu elementos por productor)\n", por_hilo);
+	bool ok = true;
+
+	cola_medida_t global = { NULL, NULL, cola_crear() };
+	pthread_mutex_init(&global.mutex, NULL);
+	cola_medida_t spsc = { cola_spsc_crear(CAPACIDAD), NULL, NULL };
+	double ops_global = medir(&global, 1, por_hilo, &ok);
+	double ops_spsc = medir(&spsc, 1, por_hilo, &ok);
+	printf("1 productor y 1 consumidor: mutex %.0f elem/s, spsc %.0f elem/s\n", ops_global, ops_spsc);
+	cola_spsc_destruir(spsc.spsc, NULL);
+	print_test("La cola spsc no pierde, repite ni desordena elementos", ok);
+
+	printf("%10s %18s %18s\n", "hilos", "mutex global", "mpmc");
+	for (size_t cant_hilos = 1; cant_hilos <= MAX_HILOS / 2; cant_hilos *= 2){
+		cola_medida_t mpmc = { NULL, cola_mpmc_crear(CAPACIDAD), NULL };
+		ops_global = medir(&global, cant_hilos, por_hilo, &ok);
+		double ops_mpmc = medir(&mpmc, cant_hilos, por_hilo, &ok);
+		printf("%4zu + %-4zu %13.0f elem/s %13.0f elem/s\n", cant_hilos, cant_hilos, ops_global, ops_mpmc);
+		cola_mpmc_destruir(mpmc.mpmc, NULL);
+	}
+	print_test("La cola mpmc no pierde ni repite elementos", ok);
+
+	cola_destruir(global.cola, NULL);
+	pthread_mutex_destroy(&global.mutex);
+}
+
+/* Programa principal. Recibe opcionalmente cuantos elementos encola cada
+ * productor en las pruebas con varios hilos. */
+int main(int argc, char** argv)
+{
+	pruebas_spsc_un_hilo();
+	pruebas_mpmc_un_hilo();
+	pruebas_rendimiento(argc > 1 ? (size_t)atol(argv[1]) : 1000000);
+	return 0;
+}
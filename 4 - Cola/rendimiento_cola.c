@@ -0,0 +1,104 @@
+#define _POSIX_C_SOURCE 200809L
+#include "cola.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+/*******************************************************************
+ *                  MEDICION DE LA COLA                            *
+ ******************************************************************/
+
+/* Se compila una vez con cola.c y otra con cola_circular.c (definiendo
+ * COLA_CIRCULAR) para comparar las dos implementaciones. */
+#ifdef COLA_CIRCULAR
+#define IMPLEMENTACION "circular"
+#else
+#define IMPLEMENTACION "enlazada"
+#endif
+
+#define CANTIDAD 10000000
+#define FRENTE 1000 // elementos que quedan en la cola en la prueba de recambio
+#define LOTE 64
+
+double segundos_desde(struct timespec* inicio)
+{
+	struct timespec fin;
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	return (fin.tv_sec - inicio->tv_sec) + (fin.tv_nsec - inicio->tv_nsec) / 1e9;
+}
+
+/* Encola todos los elementos y despues los desencola. */
+double medir_llenar_vaciar(cola_t* cola, long* control)
+{
+	struct timespec inicio;
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (long i = 0; i < CANTIDAD; i++)
+		cola_encolar(cola, (void*)i);
+	while (!cola_esta_vacia(cola))
+		*control += (long)cola_desencolar(cola);
+	return segundos_desde(&inicio);
+}
+
+/* Con FRENTE elementos en la cola, encola y desencola alternadamente, como
+ * el recorrido de un BFS o una cola de trabajos. */
+double medir_recambio(cola_t* cola, long* control)
+{
+	for (long i = 0; i < FRENTE; i++)
+		cola_encolar(cola, (void*)i);
+
+	struct timespec inicio;
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (long i = 0; i < CANTIDAD; i++){
+		cola_encolar(cola, (void*)i);
+		*control += (long)cola_desencolar(cola);
+	}
+	double tiempo = segundos_desde(&inicio);
+
+	while (!cola_esta_vacia(cola))
+		cola_desencolar(cola);
+	return tiempo;
+}
+
+/* Lo mismo que medir_recambio pero de a LOTE elementos. */
+double medir_recambio_en_bloque(cola_t* cola, long* control)
+{
+	void* lote[LOTE];
+	for (long i = 0; i < LOTE; i++)
+		lote[i] = (void*)i;
+	for (long i = 0; i < FRENTE; i += LOTE)
+		cola_encolar_n(cola, lote, LOTE);
+
+	struct timespec inicio;
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (long i = 0; i < CANTIDAD; i += LOTE){
+		cola_encolar_n(cola, lote, LOTE);
+		cola_desencolar_n(cola, lote, LOTE);
+		*control += (long)lote[0];
+	}
+	double tiempo = segundos_desde(&inicio);
+
+	while (!cola_esta_vacia(cola))
+		cola_desencolar(cola);
+	return tiempo;
+}
+
+/* Programa principal. */
+int main(void)
+{
+	cola_t* cola = cola_crear();
+	cola_t* cola_pool = cola_crear_con_pool(NULL);
+	if (!cola || !cola_pool) return 1;
+	long control = 0;
+
+	printf("Cola %s, %d operaciones (ms)\n", IMPLEMENTACION, CANTIDAD);
+	printf("%-20s %10.1f\n", "llenar y vaciar", medir_llenar_vaciar(cola, &control) * 1000);
+	printf("%-20s %10.1f\n", "recambio", medir_recambio(cola, &control) * 1000);
+	printf("%-20s %10.1f\n", "recambio con pool", medir_recambio(cola_pool, &control) * 1000);
+	printf("%-20s %10.1f\n", "recambio en bloque", medir_recambio_en_bloque(cola, &control) * 1000);
+	printf("(control %ld)\n", control);
+
+	cola_destruir(cola, NULL);
+	cola_destruir(cola_pool, NULL);
+	return 0;
+}
@@ -14,6 +14,7 @@
 
 typedef struct nodo_lista{
 	void *dato;
+	struct nodo_lista *anterior;
 	struct nodo_lista *proximo;
 }nodo_lista_t;
 
@@ -21,11 +22,16 @@ struct lista{
 	nodo_lista_t *primero;
 	nodo_lista_t *ultimo;
 	size_t largo;
+	pool_t *pool; // de donde salen los nodos, o NULL si se usa malloc
+	bool pool_propio;
 };
 
+// Cuando actual es NULL el iterador esta al final, que es a la vez despues
+// del ultimo y antes del primero.
 struct lista_iter{
+	const lista_t *lista;
 	nodo_lista_t *actual;
-	nodo_lista_t *anterior;
+	size_t indice; // posicion de actual en la lista (largo si esta al final)
 };
 
  /*******************************************************************
@@ -40,18 +46,58 @@ lista_t *lista_crear(){
 	lista->ultimo = NULL;
 	lista->primero = NULL;
 	lista->largo = 0;
+	lista->pool = NULL;
+	lista->pool_propio = false;
 	return lista;
 }
 
-// Crea un nodo.
+// Crea una Lista que pide sus nodos a pool en lugar de hacer un malloc por
+// cada elemento. Si pool es NULL, la lista crea un pool propio.
+// Pre: pool es NULL o fue creado con un tamaño de al menos lista_tam_nodo().
+// Post: devuelve una nueva lista vacia, o NULL en caso de error.
+lista_t *lista_crear_con_pool(pool_t *pool){
+	if (pool != NULL && pool_tam_objeto(pool) < sizeof(nodo_lista_t))
+		return NULL;
+
+	lista_t* lista = lista_crear();
+	if (lista == NULL)
+		return NULL;
+	lista->pool = pool;
+	if (pool == NULL){
+		lista->pool = pool_crear(sizeof(nodo_lista_t));
+		lista->pool_propio = true;
+		if (lista->pool == NULL){
+			free(lista);
+			return NULL;
+		}
+	}
+	return lista;
+}
+
+// Devuelve el tamaño de los nodos de la lista, para crear un pool para ellos.
+size_t lista_tam_nodo(){
+	return sizeof(nodo_lista_t);
+}
+
+// Crea un nodo, pidiendolo al pool de la lista si tiene uno.
 // Post: Devuelve el nodo creado o NULL si no se creo.
-nodo_lista_t *nodo_crear(){
+nodo_lista_t *nodo_crear(lista_t *lista){
+	if (lista->pool != NULL) return pool_pedir(lista->pool);
+
 	nodo_lista_t *nodo = malloc(sizeof(nodo_lista_t));
 	if (nodo == NULL) return NULL;
 
 	return nodo;
 }
 
+// Libera un nodo creado con nodo_crear.
+void nodo_destruir(lista_t *lista, nodo_lista_t *nodo){
+	if (lista->pool != NULL)
+		pool_devolver(lista->pool, nodo);
+	else
+		free(nodo);
+}
+
 // Devuelve verdadero o falso, segun si la lista tiene o no elementos.
 // Pre: la lista fue creada.
 bool lista_esta_vacia(const lista_t *lista){
@@ -65,13 +111,16 @@ bool lista_esta_vacia(const lista_t *lista){
 // de la lista.
 bool lista_insertar_primero(lista_t *lista, void *dato){
 	nodo_lista_t* nodo;
-	if ((nodo = nodo_crear()) == NULL) return false;
+	if ((nodo = nodo_crear(lista)) == NULL) return false;
 
 	nodo->dato = dato;
+	nodo->anterior = NULL;
 	nodo->proximo = lista->primero;
 
 	if (lista_esta_vacia(lista))
 		lista->ultimo = nodo;
+	else
+		lista->primero->anterior = nodo;
 
 	lista->primero = nodo;
 	lista->largo++;
@@ -90,9 +139,10 @@ bool lista_insertar_ultimo(lista_t *lista, void *dato){
 		return ok;
 	}
 	nodo_lista_t* nodo;
-	if ((nodo = nodo_crear()) == NULL) return false;
+	if ((nodo = nodo_crear(lista)) == NULL) return false;
 
 	nodo->dato = dato;
+	nodo->anterior = lista->ultimo;
 	nodo->proximo = NULL;
 	lista->ultimo->proximo = nodo;
 	lista->ultimo = nodo;
@@ -106,12 +156,7 @@ bool lista_insertar_ultimo(lista_t *lista, void *dato){
 void *lista_borrar_primero(lista_t *lista){
 	if (lista_esta_vacia(lista)) return NULL;
 
-	nodo_lista_t *nodo = lista->primero;
-	void* valor = nodo->dato;
-	lista->primero = lista->primero->proximo;
-	free(nodo);
-	lista->largo--;
-	return valor;
+	return lista_borrar_ref(lista, lista->primero);
 }
 
 // Obtiene el valor del primer elemento de la lista y lo devuelve. Si esta vacia,
@@ -136,7 +181,14 @@ size_t lista_largo(const lista_t *lista){
 // los datos de la lista, o NULL en caso de que no se la utilice.
 // Post: se eliminaron todos los elementos de la lista.
 void lista_destruir(lista_t *lista, void destruir_dato(void *)){
-	if (destruir_dato == NULL){
+	if (lista->pool_propio){
+		// Los nodos se liberan todos juntos con el pool.
+		if (destruir_dato != NULL)
+			for (nodo_lista_t *nodo = lista->primero; nodo != NULL; nodo = nodo->proximo)
+				destruir_dato(nodo->dato);
+		pool_destruir(lista->pool);
+	}
+	else if (destruir_dato == NULL){
 		while (lista->primero != NULL)
 			lista_borrar_primero(lista);
 	}
@@ -145,16 +197,77 @@ void lista_destruir(lista_t *lista, void destruir_dato(void *)){
 			nodo_lista_t *nodo = lista->primero;
 			lista->primero = lista->primero->proximo;
 			destruir_dato(nodo->dato);
-			free(nodo);
+			nodo_destruir(lista, nodo);
 		}
 	}
 	free(lista);
 }
 
+ /*******************************************************************
+ *                     IMPLEMENTACION REFERENCIAS                   *
+ *******************************************************************/
+
+// Agrega un nuevo elemento al principio de la lista y devuelve su
+// referencia, o NULL en caso de error.
+// Pre: la lista fue creada.
+lista_ref_t *lista_insertar_primero_ref(lista_t *lista, void *dato){
+	if (!lista_insertar_primero(lista, dato)) return NULL;
+	return lista->primero;
+}
+
+// Agrega un nuevo elemento al final de la lista y devuelve su referencia,
+// o NULL en caso de error.
+// Pre: la lista fue creada.
+lista_ref_t *lista_insertar_ultimo_ref(lista_t *lista, void *dato){
+	if (!lista_insertar_ultimo(lista, dato)) return NULL;
+	return lista->ultimo;
+}
+
+// Devuelve la referencia del elemento actual del iterador, o NULL si esta
+// al final.
+// Pre: el iterador fue creado.
+lista_ref_t *lista_iter_ver_ref(const lista_iter_t *iter){
+	return iter->actual;
+}
+
+// Devuelve el dato del elemento de la referencia.
+// Pre: la referencia es de un elemento que esta en una lista.
+void *lista_ref_ver_dato(const lista_ref_t *ref){
+	return ref->dato;
+}
+
+// Borra de la lista el elemento de la referencia y devuelve su dato.
+// Pre: la lista fue creada y la referencia es de un elemento de la lista.
+// Post: se borro el elemento; la referencia y los iteradores parados en el
+// dejan de ser validos.
+void *lista_borrar_ref(lista_t *lista, lista_ref_t *ref){
+	nodo_lista_t *nodo = ref;
+	void *valor = nodo->dato;
+	if (nodo->anterior == NULL)
+		lista->primero = nodo->proximo;
+	else
+		nodo->anterior->proximo = nodo->proximo;
+	if (nodo->proximo == NULL)
+		lista->ultimo = nodo->anterior;
+	else
+		nodo->proximo->anterior = nodo->anterior;
+
+	nodo_destruir(lista, nodo);
+	lista->largo--;
+	return valor;
+}
+
  /*******************************************************************
  *                        IMPLEMENTACION ITERADOR                   *
  *******************************************************************/
 
+// Devuelve el nodo anterior al actual del iterador (el ultimo si esta al
+// final), o NULL si no hay.
+static nodo_lista_t *iter_anterior(const lista_iter_t *iter){
+	if (iter->actual != NULL) return iter->actual->anterior;
+	return lista_esta_vacia(iter->lista) ? NULL : iter->lista->ultimo;
+}
+
 // Crea un iterador.
 // Pre: la lista fue creada. 
 // Post: devuelve un iterador con acual apuntando al primero de la lista.
@@ -162,11 +275,26 @@ void lista_destruir(lista_t *lista, void destruir_dato(void *)){
  	lista_iter_t* iter = malloc(sizeof(lista_iter_t));
 	if (iter == NULL) return NULL;
 
+	iter->lista = lista;
 	iter->actual = lista->primero;
-	iter->anterior = NULL;
+	iter->indice = 0;
 	return iter;
  }
 
+// Crea un iterador parado en el ultimo elemento de la lista, para
+// recorrerla hacia atras con lista_iter_retroceder.
+// Pre: la lista fue creada.
+// Post: devuelve un iterador con actual apuntando al ultimo de la lista (al
+// final si esta vacia).
+lista_iter_t *lista_iter_crear_final(const lista_t *lista){
+	lista_iter_t* iter = lista_iter_crear(lista);
+	if (iter == NULL) return NULL;
+
+	iter->actual = lista_esta_vacia(lista) ? NULL : lista->ultimo;
+	iter->indice = lista_esta_vacia(lista) ? 0 : lista->largo - 1;
+	return iter;
+}
+
 // Avanza una posicion en el iterador. Devuelve true o false.
 // Pre: el iterador fue creado.
 // Post: Devuele true si la posicion siguiente a actual no es NULL.
@@ -174,8 +302,26 @@ void lista_destruir(lista_t *lista, void destruir_dato(void *)){
 bool lista_iter_avanzar(lista_iter_t *iter){
 	if (iter->actual == NULL) return false;
 
-	iter->anterior = iter->actual;
 	iter->actual = iter->actual->proximo;
+	iter->indice++;
+	return true;
+}
+
+// Retrocede una posicion en el iterador. Desde el primero pasa al final,
+// y desde el final al ultimo.
+// Pre: el iterador fue creado.
+// Post: devuelve false si la lista esta vacia, true en caso contrario.
+bool lista_iter_retroceder(lista_iter_t *iter){
+	if (lista_esta_vacia(iter->lista)) return false;
+
+	if (iter->actual == NULL){
+		iter->actual = iter->lista->ultimo;
+		iter->indice = iter->lista->largo - 1;
+	}
+	else{
+		iter->actual = iter->actual->anterior;
+		iter->indice = iter->actual ? iter->indice - 1 : iter->lista->largo;
+	}
 	return true;
 }
 
@@ -208,36 +354,24 @@ void lista_iter_destruir(lista_iter_t *iter){
 // Post: Inserta un elemento en la posicion del iterador,actual se actualiza.
 // Devuelve true si puede, false si no.
 bool lista_insertar(lista_t *lista, lista_iter_t *iter, void *dato){
-	if (lista_esta_vacia(lista)){
-		if(!lista_insertar_primero(lista, dato)) return false;
-
-		iter->actual = lista->primero;
-		iter->anterior = lista->ultimo;
-		return true;
-	}
 	nodo_lista_t* nodo;
-	if ((nodo = nodo_crear()) == NULL) return false;
+	if ((nodo = nodo_crear(lista)) == NULL) return false;
 
+	nodo_lista_t *anterior = iter_anterior(iter);
 	nodo->dato = dato;
-	lista->largo++;
-	if (lista_iter_ver_actual(iter) == NULL){
-		nodo->proximo = NULL;
-		lista->ultimo->proximo = nodo;
-		iter->anterior = lista->ultimo;
-		lista->ultimo = nodo;
-		iter->actual = lista->ultimo;
-	}
-	else if (iter->actual == lista->primero){
-		nodo->proximo = lista->primero;
-		iter->anterior = NULL;
+	nodo->anterior = anterior;
+	nodo->proximo = iter->actual;
+	if (anterior == NULL)
 		lista->primero = nodo;
-		iter->actual = nodo;
-	}
-	else{
-		nodo->proximo = iter->actual;
-		iter->actual = nodo;
-		iter->anterior->proximo = iter->actual;
-	}
+	else
+		anterior->proximo = nodo;
+	if (iter->actual == NULL)
+		lista->ultimo = nodo;
+	else
+		iter->actual->anterior = nodo;
+
+	iter->actual = nodo;
+	lista->largo++;
 	return true;
 }
 
@@ -249,25 +383,8 @@ void *lista_borrar(lista_t *lista, lista_iter_t *iter){
 	if (lista_esta_vacia(lista) || lista_iter_al_final(iter)) return NULL;
 
 	nodo_lista_t *nodo = iter->actual;
-	void *valor = nodo->dato;
-
-	if (iter->actual == lista->primero){
-		lista->primero = nodo->proximo;
-		iter->actual = lista->primero;
-		iter->anterior = NULL;
-	}
-	else if (lista->ultimo == iter->actual){
-		lista->ultimo = iter->anterior;
-		iter->actual = NULL;
-		iter->anterior->proximo = iter->actual;
-	}
-	else{
-		iter->actual = nodo->proximo;
-		iter->anterior->proximo = iter->actual;
-	}
-	free(nodo);
-	lista->largo--;
-	return valor;
+	iter->actual = nodo->proximo;
+	return lista_borrar_ref(lista, nodo);
 }
 
 // Itera la lista de principio a fin, si visitar no es NULL, se la aplica
@@ -287,3 +404,129 @@ void lista_iterar(lista_t *lista, bool (*visitar)(void *dato, void *extra)
 	return;
 }
 
+ /*******************************************************************
+ *                  IMPLEMENTACION UNIR Y PARTIR                    *
+ *******************************************************************/
+
+// Devuelve si los nodos de una lista se pueden pasar a la otra: tienen
+// que salir del mismo lugar, y no de un pool propio (que se destruye con
+// su lista).
+static bool lista_compatibles(const lista_t *lista, const lista_t *otra){
+	return lista->pool == otra->pool && !lista->pool_propio && !otra->pool_propio;
+}
+
+// Deja la lista vacia, sin tocar sus nodos.
+static void lista_vaciar(lista_t *lista){
+	lista->primero = NULL;
+	lista->ultimo = NULL;
+	lista->largo = 0;
+}
+
+// Pasa todos los elementos de otra al final de lista, en orden.
+// Pre: las listas fueron creadas y son distintas.
+// Post: devuelve true y otra queda vacia, o false si las listas no piden
+// sus nodos al mismo lugar.
+bool lista_concatenar(lista_t *lista, lista_t *otra){
+	if (!lista_compatibles(lista, otra)) return false;
+	if (lista_esta_vacia(otra)) return true;
+
+	if (lista_esta_vacia(lista))
+		lista->primero = otra->primero;
+	else
+		lista->ultimo->proximo = otra->primero;
+	otra->primero->anterior = lista_esta_vacia(lista) ? NULL : lista->ultimo;
+	lista->ultimo = otra->ultimo;
+	lista->largo += otra->largo;
+	lista_vaciar(otra);
+	return true;
+}
+
+// Pasa todos los elementos de otra a lista antes del actual del iterador.
+// Pre: las listas y el iterador (de lista) fueron creados.
+// Post: devuelve true, otra queda vacia y el iterador sigue en el mismo
+// elemento; o false si las listas no piden sus nodos al mismo lugar.
+bool lista_splice(lista_t *lista, lista_iter_t *iter, lista_t *otra){
+	if (!lista_compatibles(lista, otra)) return false;
+	if (lista_esta_vacia(otra)) return true;
+
+	nodo_lista_t *anterior = iter_anterior(iter);
+	otra->primero->anterior = anterior;
+	otra->ultimo->proximo = iter->actual;
+	if (anterior == NULL)
+		lista->primero = otra->primero;
+	else
+		anterior->proximo = otra->primero;
+	if (iter->actual == NULL)
+		lista->ultimo = otra->ultimo;
+	else
+		iter->actual->anterior = otra->ultimo;
+
+	iter->indice += otra->largo;
+	lista->largo += otra->largo;
+	lista_vaciar(otra);
+	return true;
+}
+
+// Saca de lista los elementos desde el actual del iterador hasta el final y
+// los devuelve en una lista nueva.
+// Pre: la lista y el iterador (de lista) fueron creados.
+// Post: devuelve la lista nueva y el iterador queda al final de lista; o
+// NULL si no se pudo.
+lista_t *lista_partir(lista_t *lista, lista_iter_t *iter){
+	if (lista->pool_propio) return NULL;
+	lista_t *nueva = lista_crear();
+	if (nueva == NULL) return NULL;
+	nueva->pool = lista->pool;
+	if (iter->actual == NULL) return nueva;
+
+	nodo_lista_t *anterior = iter->actual->anterior;
+	nueva->primero = iter->actual;
+	nueva->ultimo = lista->ultimo;
+	nueva->largo = lista->largo - iter->indice;
+	nueva->primero->anterior = NULL;
+	if (anterior == NULL)
+		lista->primero = NULL;
+	else
+		anterior->proximo = NULL;
+	lista->ultimo = anterior;
+	lista->largo = iter->indice;
+	iter->actual = NULL;
+	return nueva;
+}
+
+// Intercala los elementos de otra en lista, enlazando los nodos en orden.
+// Pre: las listas fueron creadas y son distintas.
+// Post: devuelve true y otra queda vacia, o false si las listas no piden
+// sus nodos al mismo lugar.
+bool lista_fusionar_ordenado(lista_t *lista, lista_t *otra, int (*cmp)(const void *a, const void *b)){
+	if (!lista_compatibles(lista, otra)) return false;
+	if (lista_esta_vacia(otra)) return true;
+
+	nodo_lista_t *a = lista->primero;
+	nodo_lista_t *b = otra->primero;
+	// enlace apunta al puntero que tiene que apuntar al proximo nodo, y
+	// anterior es el ultimo nodo ya enlazado.
+	nodo_lista_t **enlace = &lista->primero;
+	nodo_lista_t *anterior = NULL;
+	while (a != NULL && b != NULL){
+		if (cmp(a->dato, b->dato) <= 0){
+			*enlace = a;
+			a = a->proximo;
+		}
+		else{
+			*enlace = b;
+			b = b->proximo;
+		}
+		(*enlace)->anterior = anterior;
+		anterior = *enlace;
+		enlace = &anterior->proximo;
+	}
+	*enlace = a != NULL ? a : b;
+	(*enlace)->anterior = anterior;
+	if (b != NULL)
+		lista->ultimo = otra->ultimo;
+
+	lista->largo += otra->largo;
+	lista_vaciar(otra);
+	return true;
+}
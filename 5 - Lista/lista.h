@@ -3,6 +3,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include "pool.h"
 
 /*******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS                 *
@@ -13,6 +14,10 @@
 typedef struct lista lista_t;
 typedef struct lista_iter lista_iter_t;
 
+/* Una referencia identifica a un elemento de la lista mientras este no se
+ * borre, y permite borrarlo sin buscarlo. */
+typedef struct nodo_lista lista_ref_t;
+
 /********************************************************************
  *                    PRIMITIVAS DE LA COLA                         *
  *******************************************************************/
@@ -20,6 +25,17 @@ typedef struct lista_iter lista_iter_t;
 // Post: devuelve una nueva lista vacia.
 lista_t *lista_crear();
 
+// Crea una Lista que pide sus nodos a pool en lugar de hacer un malloc por
+// cada elemento. Varias listas (de un mismo hilo) pueden compartir un pool.
+// Si pool es NULL, la lista crea un pool propio y al destruirla libera todos
+// los nodos de una sola vez.
+// Pre: pool es NULL o fue creado con un tamaño de al menos lista_tam_nodo().
+// Post: devuelve una nueva lista vacia, o NULL en caso de error.
+lista_t *lista_crear_con_pool(pool_t *pool);
+
+// Devuelve el tamaño de los nodos de la lista, para crear un pool para ellos.
+size_t lista_tam_nodo();
+
 // Devuelve verdadero o falso, segun si la lista tiene o no elementos.
 // Pre: la lista fue creada.
 bool lista_esta_vacia(const lista_t *lista);
@@ -70,12 +86,26 @@ void lista_destruir(lista_t *lista, void destruir_dato(void *));
 // Post: devuelve un iterador con acual apuntando al primero de la lista.
 lista_iter_t *lista_iter_crear(const lista_t *lista);
 
+// Crea un iterador parado en el ultimo elemento, para recorrer la lista
+// hacia atras con lista_iter_retroceder.
+// Pre: la lista fue creada.
+// Post: devuelve un iterador con actual apuntando al ultimo de la lista (al
+// final si esta vacia).
+lista_iter_t *lista_iter_crear_final(const lista_t *lista);
+
 // Avanza una posicion en el iterador. Devuelve true o false.
 // Pre: el iterador fue creado.
 // Post: Devuele true si la posicion siguiente a actual no es NULL.
 // En caso contrario, false.
 bool lista_iter_avanzar(lista_iter_t *iter);
 
+// Retrocede una posicion en el iterador. El final de la lista esta a la vez
+// despues del ultimo y antes del primero: desde el primero el iterador pasa
+// al final, y desde el final al ultimo.
+// Pre: el iterador fue creado.
+// Post: devuelve false si la lista esta vacia, true en caso contrario.
+bool lista_iter_retroceder(lista_iter_t *iter);
+
 // Devuelve el elemento actual en donde el iterador esta parado.
 // Pre: el iterador fue creado.
 // Post: devuelve el elemento actual del iterador.
@@ -109,4 +139,79 @@ void *lista_borrar(lista_t *lista, lista_iter_t *iter);
 // Post: Itera la lista de principio a fin o hasta que visitar lo detiene.
 void lista_iterar(lista_t *lista, bool (*visitar)(void *dato, void *extra), void* extra);
 
+/*******************************************************************
+ *                   PRIMITIVAS DE LAS REFERENCIAS                 *
+ ******************************************************************/
+
+/* La lista desenrollada mueve los datos de lugar al insertar y borrar, asi
+ * que no tiene referencias: no implementa estas primitivas, y un programa
+ * que las use con ella no enlaza. */
+
+// Agrega un nuevo elemento al principio de la lista y devuelve su
+// referencia, o NULL en caso de error.
+// Pre: la lista fue creada.
+lista_ref_t *lista_insertar_primero_ref(lista_t *lista, void *dato);
+
+// Agrega un nuevo elemento al final de la lista y devuelve su referencia,
+// o NULL en caso de error.
+// Pre: la lista fue creada.
+lista_ref_t *lista_insertar_ultimo_ref(lista_t *lista, void *dato);
+
+// Devuelve la referencia del elemento actual del iterador, o NULL si esta
+// al final.
+// Pre: el iterador fue creado.
+lista_ref_t *lista_iter_ver_ref(const lista_iter_t *iter);
+
+// Devuelve el dato del elemento de la referencia.
+// Pre: la referencia es de un elemento que esta en una lista.
+void *lista_ref_ver_dato(const lista_ref_t *ref);
+
+// Borra de la lista el elemento de la referencia y devuelve su dato, en O(1).
+// Pre: la lista fue creada y la referencia es de un elemento de la lista
+// (si el elemento paso a esta lista con las primitivas de abajo, la
+// referencia sigue valiendo).
+// Post: se borro el elemento; la referencia y los iteradores parados en el
+// dejan de ser validos.
+void *lista_borrar_ref(lista_t *lista, lista_ref_t *ref);
+
+/*******************************************************************
+ *                PRIMITIVAS PARA UNIR Y PARTIR LISTAS             *
+ ******************************************************************/
+
+/* Estas primitivas mueven los nodos de una lista a otra sin crear ni
+ * destruir nodos. Por eso las dos listas tienen que pedir sus nodos al
+ * mismo lugar: las dos con malloc (lista_crear) o las dos al mismo pool. Una
+ * lista con pool propio (lista_crear_con_pool(NULL)) no se puede unir con
+ * otra ni partir. */
+
+// Pasa todos los elementos de otra al final de lista, en orden.
+// Pre: las listas fueron creadas y son distintas.
+// Post: devuelve true y otra queda vacia, o false (y las listas quedan
+// intactas) si las listas no piden sus nodos al mismo lugar.
+bool lista_concatenar(lista_t *lista, lista_t *otra);
+
+// Pasa todos los elementos de otra a lista, en orden, antes del actual del
+// iterador (al final si el iterador esta al final).
+// Pre: las listas y el iterador (de lista) fueron creados. Las listas son
+// distintas.
+// Post: devuelve true, otra queda vacia y el iterador sigue en el mismo
+// elemento; o false si no se pudo (las listas quedan intactas).
+bool lista_splice(lista_t *lista, lista_iter_t *iter, lista_t *otra);
+
+// Saca de lista los elementos desde el actual del iterador hasta el final y
+// los devuelve en una lista nueva, que pide sus nodos al mismo lugar.
+// Pre: la lista y el iterador (de lista) fueron creados.
+// Post: devuelve la lista nueva (vacia si el iterador estaba al final) y el
+// iterador queda al final de lista; o NULL si no se pudo.
+lista_t *lista_partir(lista_t *lista, lista_iter_t *iter);
+
+// Intercala los elementos de otra en lista. Si las dos estaban ordenadas de
+// menor a mayor segun cmp, lista queda ordenada; ante elementos iguales
+// quedan primero los que ya estaban en lista.
+// Pre: las listas fueron creadas y son distintas. cmp devuelve un numero
+// negativo, 0 o positivo si a es menor, igual o mayor que b.
+// Post: devuelve true y otra queda vacia, o false (y las listas quedan
+// intactas) si las listas no piden sus nodos al mismo lugar.
+bool lista_fusionar_ordenado(lista_t *lista, lista_t *otra, int (*cmp)(const void *a, const void *b));
+
 #endif //LISTA_H
\ No newline at end of file
@@ -0,0 +1,672 @@
+#include "lista.h"
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+/*******************************************************************
+ * Lista desenrollada: implementa la misma interfaz que lista.c,    *
+ * pero cada nodo (bloque) guarda hasta CAPACIDAD_BLOQUE datos      *
+ * seguidos. Recorrerla es casi secuencial y no se pide memoria     *
+ * por cada elemento sino por cada bloque.                          *
+ ******************************************************************/
+
+#define CAPACIDAD_BLOQUE 32
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+// Los datos del bloque son datos[inicio], ..., datos[fin - 1]. Dejar lugar
+// libre a los dos lados permite insertar y borrar en los extremos sin mover
+// el resto. En la lista nunca hay bloques vacios.
+typedef struct bloque{
+	void *datos[CAPACIDAD_BLOQUE];
+	size_t inicio;
+	size_t fin;
+	struct bloque *anterior;
+	struct bloque *proximo;
+}bloque_t;
+
+struct lista{
+	bloque_t *primero;
+	bloque_t *ultimo;
+	size_t largo;
+	pool_t *pool; // de donde salen los bloques, o NULL si se usa malloc
+	bool pool_propio;
+};
+
+// El iterador esta en bloque->datos[pos], que es el elemento numero
+// indice de la lista. Al final de la lista (despues del ultimo y antes del
+// primero), bloque es NULL e indice es el largo.
+struct lista_iter{
+	const lista_t *lista;
+	bloque_t *bloque;
+	size_t pos;
+	size_t indice;
+};
+
+ /*******************************************************************
+ *                        FUNCIONES AUXILIARES                      *
+ *******************************************************************/
+
+static size_t bloque_cantidad(const bloque_t *bloque){
+	return bloque->fin - bloque->inicio;
+}
+
+// Crea un bloque vacio, pidiendolo al pool de la lista si tiene uno. pos
+// indica donde va a estar su primer dato: 0 si se va a llenar hacia
+// adelante, CAPACIDAD_BLOQUE hacia atras.
+static bloque_t *bloque_crear(lista_t *lista, size_t pos){
+	bloque_t *bloque = lista->pool ? pool_pedir(lista->pool) : malloc(sizeof(bloque_t));
+	if (bloque == NULL) return NULL;
+
+	bloque->inicio = pos;
+	bloque->fin = pos;
+	bloque->anterior = NULL;
+	bloque->proximo = NULL;
+	return bloque;
+}
+
+// Libera un bloque creado con bloque_crear.
+static void bloque_destruir(lista_t *lista, bloque_t *bloque){
+	if (lista->pool != NULL)
+		pool_devolver(lista->pool, bloque);
+	else
+		free(bloque);
+}
+
+// Engancha nuevo en la lista despues de bloque (al principio si bloque es NULL).
+static void lista_enlazar(lista_t *lista, bloque_t *bloque, bloque_t *nuevo){
+	nuevo->anterior = bloque;
+	nuevo->proximo = bloque ? bloque->proximo : lista->primero;
+	if (nuevo->proximo)
+		nuevo->proximo->anterior = nuevo;
+	else
+		lista->ultimo = nuevo;
+	if (bloque)
+		bloque->proximo = nuevo;
+	else
+		lista->primero = nuevo;
+}
+
+// Saca el bloque de la lista y lo libera.
+static void lista_desenlazar(lista_t *lista, bloque_t *bloque){
+	if (bloque->anterior)
+		bloque->anterior->proximo = bloque->proximo;
+	else
+		lista->primero = bloque->proximo;
+	if (bloque->proximo)
+		bloque->proximo->anterior = bloque->anterior;
+	else
+		lista->ultimo = bloque->anterior;
+	bloque_destruir(lista, bloque);
+}
+
+// Inserta dato antes de datos[pos] (o al final si pos es fin), moviendo
+// el lado del bloque que tenga menos datos. Devuelve donde quedo el dato.
+// Pre: el bloque no esta lleno, inicio <= pos <= fin.
+static size_t bloque_insertar(bloque_t *bloque, size_t pos, void *dato){
+	bool mover_izquierda = bloque->inicio > 0 &&
+		(bloque->fin == CAPACIDAD_BLOQUE || pos - bloque->inicio < bloque->fin - pos);
+	if (mover_izquierda){
+		memmove(&bloque->datos[bloque->inicio - 1], &bloque->datos[bloque->inicio],
+			(pos - bloque->inicio) * sizeof(void*));
+		bloque->inicio--;
+		pos--;
+	}
+	else{
+		memmove(&bloque->datos[pos + 1], &bloque->datos[pos],
+			(bloque->fin - pos) * sizeof(void*));
+		bloque->fin++;
+	}
+	bloque->datos[pos] = dato;
+	return pos;
+}
+
+// Borra datos[pos] moviendo el lado del bloque que tenga menos datos.
+// Devuelve donde quedo el dato que estaba despues del borrado (fin si
+// no habia ninguno).
+// Pre: inicio <= pos < fin.
+static size_t bloque_borrar(bloque_t *bloque, size_t pos){
+	if (pos - bloque->inicio < bloque->fin - pos - 1){
+		memmove(&bloque->datos[bloque->inicio + 1], &bloque->datos[bloque->inicio],
+			(pos - bloque->inicio) * sizeof(void*));
+		bloque->inicio++;
+		return pos + 1;
+	}
+	memmove(&bloque->datos[pos], &bloque->datos[pos + 1],
+		(bloque->fin - pos - 1) * sizeof(void*));
+	bloque->fin--;
+	return pos;
+}
+
+// Parte un bloque lleno en dos: la segunda mitad de los datos pasa a un
+// bloque nuevo que queda a continuacion. Devuelve el bloque nuevo o NULL
+// si no se pudo crear.
+static bloque_t *lista_partir_bloque(lista_t *lista, bloque_t *bloque){
+	bloque_t *nuevo = bloque_crear(lista, 0);
+	if (nuevo == NULL) return NULL;
+
+	size_t mitad = bloque->inicio + bloque_cantidad(bloque) / 2;
+	nuevo->fin = bloque->fin - mitad;
+	memcpy(nuevo->datos, &bloque->datos[mitad], nuevo->fin * sizeof(void*));
+	bloque->fin = mitad;
+	lista_enlazar(lista, bloque, nuevo);
+	return nuevo;
+}
+
+// Si entre el bloque y el siguiente llenan a lo sumo medio bloque, pasa los
+// datos del siguiente al bloque y lo libera. Asi la lista no se llena de
+// bloques casi vacios al borrar. *pos se actualiza si el bloque se corre.
+static void lista_unir_bloques(lista_t *lista, bloque_t *bloque, size_t *pos){
+	bloque_t *proximo = bloque->proximo;
+	if (proximo == NULL) return;
+	size_t cantidad = bloque_cantidad(bloque);
+	if (cantidad + bloque_cantidad(proximo) > CAPACIDAD_BLOQUE / 2) return;
+
+	if (bloque->fin + bloque_cantidad(proximo) > CAPACIDAD_BLOQUE){
+		memmove(bloque->datos, &bloque->datos[bloque->inicio], cantidad * sizeof(void*));
+		*pos -= bloque->inicio;
+		bloque->inicio = 0;
+		bloque->fin = cantidad;
+	}
+	memcpy(&bloque->datos[bloque->fin], &proximo->datos[proximo->inicio],
+		bloque_cantidad(proximo) * sizeof(void*));
+	bloque->fin += bloque_cantidad(proximo);
+	lista_desenlazar(lista, proximo);
+}
+
+// Borra el dato en bloque->datos[pos] y deja en *bloque_sig y *pos_sig la
+// posicion del dato que le seguia (*bloque_sig es NULL si era el ultimo).
+static void *lista_borrar_en(lista_t *lista, bloque_t *bloque, size_t pos,
+	bloque_t **bloque_sig, size_t *pos_sig){
+	void *dato = bloque->datos[pos];
+	pos = bloque_borrar(bloque, pos);
+	lista->largo--;
+
+	if (bloque_cantidad(bloque) == 0){
+		bloque_t *proximo = bloque->proximo;
+		lista_desenlazar(lista, bloque);
+		bloque = proximo;
+		pos = bloque ? bloque->inicio : 0;
+	}
+	else{
+		lista_unir_bloques(lista, bloque, &pos);
+		if (pos == bloque->fin){
+			bloque = bloque->proximo;
+			pos = bloque ? bloque->inicio : 0;
+		}
+	}
+	*bloque_sig = bloque;
+	*pos_sig = pos;
+	return dato;
+}
+
+ /*******************************************************************
+ *                        IMPLEMENTACION Lista                      *
+ *******************************************************************/
+// Crea una Lista
+// Post: devuelve una nueva lista vacia.
+lista_t *lista_crear(){
+	lista_t* lista = malloc(sizeof(lista_t));
+	if (lista == NULL)
+		return NULL;
+	lista->primero = NULL;
+	lista->ultimo = NULL;
+	lista->largo = 0;
+	lista->pool = NULL;
+	lista->pool_propio = false;
+	return lista;
+}
+
+// Crea una Lista que pide sus bloques a pool en lugar de usar malloc. Si
+// pool es NULL, la lista crea un pool propio.
+// Pre: pool es NULL o fue creado con un tamaño de al menos lista_tam_nodo().
+// Post: devuelve una nueva lista vacia, o NULL en caso de error.
+lista_t *lista_crear_con_pool(pool_t *pool){
+	if (pool != NULL && pool_tam_objeto(pool) < sizeof(bloque_t))
+		return NULL;
+
+	lista_t* lista = lista_crear();
+	if (lista == NULL)
+		return NULL;
+	lista->pool = pool;
+	if (pool == NULL){
+		lista->pool = pool_crear(sizeof(bloque_t));
+		lista->pool_propio = true;
+		if (lista->pool == NULL){
+			free(lista);
+			return NULL;
+		}
+	}
+	return lista;
+}
+
+// Devuelve el tamaño de los nodos (bloques) de la lista, para crear un pool
+// para ellos.
+size_t lista_tam_nodo(){
+	return sizeof(bloque_t);
+}
+
+// Devuelve verdadero o falso, segun si la lista tiene o no elementos.
+// Pre: la lista fue creada.
+bool lista_esta_vacia(const lista_t *lista){
+	return (lista->largo == 0);
+}
+
+// Agrega un nuevo elemento en la primera posicion de la lista.
+// Devuelve falso en caso de error.
+// Pre: la lista fue creada.
+// Post: Se agrego un nuevo elemento a la lista, dato se encuentra al principio
+// de la lista.
+bool lista_insertar_primero(lista_t *lista, void *dato){
+	bloque_t *bloque = lista->primero;
+	if (bloque == NULL || bloque_cantidad(bloque) == CAPACIDAD_BLOQUE){
+		if ((bloque = bloque_crear(lista, CAPACIDAD_BLOQUE)) == NULL) return false;
+		lista_enlazar(lista, NULL, bloque);
+	}
+	bloque_insertar(bloque, bloque->inicio, dato);
+	lista->largo++;
+	return true;
+}
+
+// Agrega un nuevo elemento en la ultima posicion de la lista.
+// Devuelve falso en caso de error.
+// Pre: la lista fue creada.
+// Post: Se agrego un nuevo elemento a la lista, dato se encuentra al final
+// de la lista.
+bool lista_insertar_ultimo(lista_t *lista, void *dato){
+	bloque_t *bloque = lista->ultimo;
+	if (bloque == NULL || bloque_cantidad(bloque) == CAPACIDAD_BLOQUE){
+		if ((bloque = bloque_crear(lista, 0)) == NULL) return false;
+		lista_enlazar(lista, lista->ultimo, bloque);
+	}
+	bloque_insertar(bloque, bloque->fin, dato);
+	lista->largo++;
+	return true;
+}
+
+// Saca el primer elemento de la lista y lo devuelve. Si esta vacia, devuelve NULL.
+// Pre: la lista fue creada.
+// Post: Se devuelve el primer elemento de la lista cuando no esta vacia, tamaño--.
+void *lista_borrar_primero(lista_t *lista){
+	if (lista_esta_vacia(lista)) return NULL;
+
+	bloque_t *bloque;
+	size_t pos;
+	return lista_borrar_en(lista, lista->primero, lista->primero->inicio, &bloque, &pos);
+}
+
+// Obtiene el valor del primer elemento de la lista y lo devuelve. Si esta vacia,
+// devuelve NULL.
+// Pre: la lista fue creada.
+// Post: se devolvio el primer elemento de la lista, cuando no esta vacia.
+void *lista_ver_primero(const lista_t *lista){
+	if (lista_esta_vacia(lista)) return NULL;
+	return lista->primero->datos[lista->primero->inicio];
+}
+
+// Obtiene el largo de la lista.
+// Pre: la lista fue creada.
+// Post: devuelve el largo de la lista, si esta vacia 0.
+size_t lista_largo(const lista_t *lista){
+	return lista->largo;
+}
+
+// Destruye la lista. Si se recibe la funcion destruir_dato por parametro,
+// para cada uno de los elementos de la lista se la llama.
+// Pre: la lista fue creada. destruir_dato es una funcin capaz de destruir
+// los datos de la lista, o NULL en caso de que no se la utilice.
+// Post: se eliminaron todos los elementos de la lista.
+void lista_destruir(lista_t *lista, void destruir_dato(void *)){
+	bloque_t *bloque = lista->primero;
+	while (bloque != NULL){
+		bloque_t *proximo = bloque->proximo;
+		if (destruir_dato != NULL)
+			for (size_t i = bloque->inicio; i < bloque->fin; i++)
+				destruir_dato(bloque->datos[i]);
+		// Con un pool propio los bloques se liberan todos juntos.
+		if (!lista->pool_propio)
+			bloque_destruir(lista, bloque);
+		bloque = proximo;
+	}
+	if (lista->pool_propio)
+		pool_destruir(lista->pool);
+	free(lista);
+}
+
+ /*******************************************************************
+ *                        IMPLEMENTACION ITERADOR                   *
+ *******************************************************************/
+
+// Crea un iterador.
+// Pre: la lista fue creada.
+// Post: devuelve un iterador con acual apuntando al primero de la lista.
+lista_iter_t *lista_iter_crear(const lista_t *lista){
+	lista_iter_t* iter = malloc(sizeof(lista_iter_t));
+	if (iter == NULL) return NULL;
+
+	iter->lista = lista;
+	iter->bloque = lista->primero;
+	iter->pos = lista->primero ? lista->primero->inicio : 0;
+	iter->indice = 0;
+	return iter;
+}
+
+// Crea un iterador parado en el ultimo elemento de la lista.
+// Pre: la lista fue creada.
+// Post: devuelve un iterador con actual apuntando al ultimo de la lista (al
+// final si esta vacia).
+lista_iter_t *lista_iter_crear_final(const lista_t *lista){
+	lista_iter_t* iter = lista_iter_crear(lista);
+	if (iter == NULL) return NULL;
+
+	iter->bloque = lista->ultimo;
+	iter->pos = lista->ultimo ? lista->ultimo->fin - 1 : 0;
+	iter->indice = lista->ultimo ? lista->largo - 1 : 0;
+	return iter;
+}
+
+// Avanza una posicion en el iterador. Devuelve true o false.
+// Pre: el iterador fue creado.
+// Post: Devuele true si la posicion siguiente a actual no es NULL.
+// En caso contrario, false.
+bool lista_iter_avanzar(lista_iter_t *iter){
+	if (iter->bloque == NULL) return false;
+
+	iter->indice++;
+	if (++iter->pos == iter->bloque->fin){
+		iter->bloque = iter->bloque->proximo;
+		iter->pos = iter->bloque ? iter->bloque->inicio : 0;
+	}
+	return true;
+}
+
+// Retrocede una posicion en el iterador. Desde el primero pasa al final,
+// y desde el final al ultimo.
+// Pre: el iterador fue creado.
+// Post: devuelve false si la lista esta vacia, true en caso contrario.
+bool lista_iter_retroceder(lista_iter_t *iter){
+	if (lista_esta_vacia(iter->lista)) return false;
+
+	if (iter->bloque != NULL && iter->pos > iter->bloque->inicio){
+		iter->pos--;
+		iter->indice--;
+		return true;
+	}
+	iter->bloque = iter->bloque ? iter->bloque->anterior : iter->lista->ultimo;
+	iter->pos = iter->bloque ? iter->bloque->fin - 1 : 0;
+	iter->indice = iter->bloque ? iter->indice - 1 : iter->lista->largo;
+	return true;
+}
+
+// Devuelve el elemento actual en donde el iterador esta parado.
+// Pre: el iterador fue creado.
+// Post: devuelve el elemento actual del iterador. Devuelve NULL si se llego
+// al final de la lista.
+void *lista_iter_ver_actual(const lista_iter_t *iter){
+	if (iter->bloque == NULL) return NULL;
+
+	return iter->bloque->datos[iter->pos];
+}
+
+// Devuelve true o false dependiendo si se recorrio todo el iterador.
+// Pre: el iterador fue creado.
+// Post: si se recorrio todo el iterador devuelve true, si no, false.
+bool lista_iter_al_final(const lista_iter_t *iter){
+	return (iter->bloque == NULL);
+}
+
+// Destruye el iterador.
+// Pre: el iterador fue creado.
+// Post: se elimina el iterador.
+void lista_iter_destruir(lista_iter_t *iter){
+	free(iter);
+}
+
+// Inserta un elemento en la posicion actual del iterador. Devuelve true o false.
+// Pre: la lista y el iterador fueron creados.
+// Post: Inserta un elemento en la posicion del iterador,actual se actualiza.
+// Devuelve true si puede, false si no.
+bool lista_insertar(lista_t *lista, lista_iter_t *iter, void *dato){
+	if (lista_iter_al_final(iter)){
+		if (!lista_insertar_ultimo(lista, dato)) return false;
+
+		iter->bloque = lista->ultimo;
+		iter->pos = lista->ultimo->fin - 1;
+		return true;
+	}
+	bloque_t *bloque = iter->bloque;
+	size_t pos = iter->pos;
+	if (bloque_cantidad(bloque) == CAPACIDAD_BLOQUE){
+		bloque_t *nuevo = lista_partir_bloque(lista, bloque);
+		if (nuevo == NULL) return false;
+		if (pos >= bloque->fin){
+			pos = pos - bloque->fin;
+			bloque = nuevo;
+		}
+	}
+	iter->bloque = bloque;
+	iter->pos = bloque_insertar(bloque, pos, dato);
+	lista->largo++;
+	return true;
+}
+
+// Borra un elemento de la lista.
+// Pre: la lista y el iterador fueron creados.
+// Post: Borra y devuelve un elemento de la lista, actual pasa a ser
+// el siguiente del elemento borrado. Devuelve NULL si paso el final o esta vacia.
+void *lista_borrar(lista_t *lista, lista_iter_t *iter){
+	if (lista_esta_vacia(lista) || lista_iter_al_final(iter)) return NULL;
+
+	return lista_borrar_en(lista, iter->bloque, iter->pos, &iter->bloque, &iter->pos);
+}
+
+// Itera la lista de principio a fin, si visitar no es NULL, se la aplica
+// a cada elemento.
+// Pre: la lista fue creada.
+// Post: Itera la lista de principio a fin o hasta que visitar lo detiene.
+void lista_iterar(lista_t *lista, bool (*visitar)(void *dato, void *extra), void *extra){
+	if (visitar == NULL) return;
+
+	for (bloque_t *bloque = lista->primero; bloque != NULL; bloque = bloque->proximo)
+		for (size_t i = bloque->inicio; i < bloque->fin; i++)
+			if (!visitar(bloque->datos[i], extra)) return;
+}
+
+ /*******************************************************************
+ *                     IMPLEMENTACION REFERENCIAS                   *
+ *******************************************************************/
+
+/* Los datos de un bloque se mueven al insertar y borrar, asi que no hay
+ * nada estable que devolver como referencia: las primitivas de las
+ * referencias no estan implementadas, y un programa que las use con esta
+ * lista no enlaza. */
+
+ /*******************************************************************
+ *                  IMPLEMENTACION UNIR Y PARTIR                    *
+ *******************************************************************/
+
+// Devuelve si los bloques de una lista se pueden pasar a la otra: tienen
+// que salir del mismo lugar, y no de un pool propio (que se destruye con
+// su lista).
+static bool lista_compatibles(const lista_t *lista, const lista_t *otra){
+	return lista->pool == otra->pool && !lista->pool_propio && !otra->pool_propio;
+}
+
+// Deja la lista vacia, sin tocar sus bloques.
+static void lista_vaciar(lista_t *lista){
+	lista->primero = NULL;
+	lista->ultimo = NULL;
+	lista->largo = 0;
+}
+
+// Engancha los bloques de otra en lista despues de bloque (al principio si
+// bloque es NULL) y deja otra vacia.
+// Pre: otra no esta vacia.
+static void lista_enlazar_lista(lista_t *lista, bloque_t *bloque, lista_t *otra){
+	bloque_t *proximo = bloque ? bloque->proximo : lista->primero;
+	otra->primero->anterior = bloque;
+	otra->ultimo->proximo = proximo;
+	if (bloque)
+		bloque->proximo = otra->primero;
+	else
+		lista->primero = otra->primero;
+	if (proximo)
+		proximo->anterior = otra->ultimo;
+	else
+		lista->ultimo = otra->ultimo;
+	lista->largo += otra->largo;
+	lista_vaciar(otra);
+}
+
+// Si pos no es el primer dato del bloque, pasa los datos desde pos hasta el
+// final a un bloque nuevo que queda a continuacion. Devuelve el bloque donde
+// quedo datos[pos], o NULL si no se pudo crear el bloque nuevo.
+static bloque_t *lista_cortar_bloque(lista_t *lista, bloque_t *bloque, size_t pos){
+	if (pos == bloque->inicio) return bloque;
+
+	bloque_t *nuevo = bloque_crear(lista, 0);
+	if (nuevo == NULL) return NULL;
+	nuevo->fin = bloque->fin - pos;
+	memcpy(nuevo->datos, &bloque->datos[pos], nuevo->fin * sizeof(void*));
+	bloque->fin = pos;
+	lista_enlazar(lista, bloque, nuevo);
+	return nuevo;
+}
+
+// Pasa todos los elementos de otra al final de lista, en orden.
+// Pre: las listas fueron creadas y son distintas.
+// Post: devuelve true y otra queda vacia, o false si las listas no piden
+// sus bloques al mismo lugar.
+bool lista_concatenar(lista_t *lista, lista_t *otra){
+	if (!lista_compatibles(lista, otra)) return false;
+	if (lista_esta_vacia(otra)) return true;
+
+	bloque_t *ultimo = lista->ultimo;
+	lista_enlazar_lista(lista, ultimo, otra);
+	// Si en la union quedaron dos bloques casi vacios, se juntan.
+	size_t pos = 0;
+	if (ultimo)
+		lista_unir_bloques(lista, ultimo, &pos);
+	return true;
+}
+
+// Pasa todos los elementos de otra a lista antes del actual del iterador.
+// Si el actual esta en el medio de un bloque hay que partirlo: es el unico
+// caso en que se pide memoria.
+// Pre: las listas y el iterador (de lista) fueron creados.
+// Post: devuelve true, otra queda vacia y el iterador sigue en el mismo
+// elemento; o false si no se pudo.
+bool lista_splice(lista_t *lista, lista_iter_t *iter, lista_t *otra){
+	if (!lista_compatibles(lista, otra)) return false;
+	if (lista_esta_vacia(otra)) return true;
+
+	iter->indice += otra->largo;
+	if (lista_iter_al_final(iter)){
+		lista_enlazar_lista(lista, lista->ultimo, otra);
+		return true;
+	}
+	bloque_t *bloque = lista_cortar_bloque(lista, iter->bloque, iter->pos);
+	if (bloque == NULL){
+		iter->indice -= otra->largo;
+		return false;
+	}
+	if (bloque != iter->bloque){
+		iter->bloque = bloque;
+		iter->pos = 0;
+	}
+	lista_enlazar_lista(lista, bloque->anterior, otra);
+	return true;
+}
+
+// Saca de lista los elementos desde el actual del iterador hasta el final y
+// los devuelve en una lista nueva.
+// Pre: la lista y el iterador (de lista) fueron creados.
+// Post: devuelve la lista nueva y el iterador queda al final de lista; o
+// NULL si no se pudo.
+lista_t *lista_partir(lista_t *lista, lista_iter_t *iter){
+	if (lista->pool_propio) return NULL;
+	lista_t *nueva = lista_crear();
+	if (nueva == NULL) return NULL;
+	nueva->pool = lista->pool;
+	if (lista_iter_al_final(iter)) return nueva;
+
+	bloque_t *bloque = lista_cortar_bloque(lista, iter->bloque, iter->pos);
+	if (bloque == NULL){
+		free(nueva);
+		return NULL;
+	}
+	nueva->primero = bloque;
+	nueva->ultimo = lista->ultimo;
+	nueva->largo = lista->largo - iter->indice;
+	lista->ultimo = bloque->anterior;
+	if (bloque->anterior)
+		bloque->anterior->proximo = NULL;
+	else
+		lista->primero = NULL;
+	bloque->anterior = NULL;
+	lista->largo = iter->indice;
+	iter->bloque = NULL;
+	iter->pos = 0;
+	return nueva;
+}
+
+// Intercala los elementos de otra en lista. Los datos se copian en orden a
+// los bloques que ya se terminaron de leer, asi que no se pide memoria y la
+// lista queda con los bloques llenos. Como los bloques pueden no estar
+// llenos, la escritura puede ir hasta dos bloques por delante de los bloques
+// liberados: esos datos esperan en pendientes.
+// Pre: las listas fueron creadas y son distintas.
+// Post: devuelve true y otra queda vacia, o false si las listas no piden
+// sus bloques al mismo lugar.
+bool lista_fusionar_ordenado(lista_t *lista, lista_t *otra, int (*cmp)(const void *a, const void *b)){
+	if (!lista_compatibles(lista, otra)) return false;
+	if (lista_esta_vacia(otra)) return true;
+
+	bloque_t *a = lista->primero, *b = otra->primero;
+	size_t pos_a = a ? a->inicio : 0, pos_b = b->inicio;
+	bloque_t *libres = NULL; // bloques ya leidos, enlazados por proximo
+	void *pendientes[3 * CAPACIDAD_BLOQUE];
+	size_t cant_pendientes = 0;
+	size_t largo = lista->largo + otra->largo;
+	lista_vaciar(lista);
+	lista_vaciar(otra);
+
+	while (a != NULL || b != NULL || cant_pendientes > 0){
+		if (a != NULL || b != NULL){
+			bool de_a = b == NULL || (a != NULL && cmp(a->datos[pos_a], b->datos[pos_b]) <= 0);
+			bloque_t **bloque = de_a ? &a : &b;
+			size_t *pos = de_a ? &pos_a : &pos_b;
+			pendientes[cant_pendientes++] = (*bloque)->datos[(*pos)++];
+			if (*pos == (*bloque)->fin){
+				bloque_t *leido = *bloque;
+				*bloque = leido->proximo;
+				*pos = *bloque ? (*bloque)->inicio : 0;
+				leido->proximo = libres;
+				libres = leido;
+			}
+			if (cant_pendientes < CAPACIDAD_BLOQUE) continue;
+		}
+		// Se pasa un bloque de pendientes (o lo que quede al terminar) a un
+		// bloque libre.
+		if (libres == NULL) continue;
+		bloque_t *bloque = libres;
+		libres = libres->proximo;
+		size_t cantidad = cant_pendientes < CAPACIDAD_BLOQUE ? cant_pendientes : CAPACIDAD_BLOQUE;
+		memcpy(bloque->datos, pendientes, cantidad * sizeof(void*));
+		cant_pendientes -= cantidad;
+		memmove(pendientes, &pendientes[cantidad], cant_pendientes * sizeof(void*));
+		bloque->inicio = 0;
+		bloque->fin = cantidad;
+		bloque->proximo = NULL;
+		lista_enlazar(lista, lista->ultimo, bloque);
+	}
+	while (libres != NULL){
+		bloque_t *proximo = libres->proximo;
+		bloque_destruir(lista, libres);
+		libres = proximo;
+	}
+	lista->largo = largo;
+	return true;
+}
@@ -0,0 +1,64 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+/* El pool entrega objetos de un mismo tamaño. Los pide a malloc de a
+ * bloques de muchos objetos y reutiliza los que se le devuelven, asi pedir
+ * y devolver un objeto es O(1) y no pasa por malloc/free. Destruir el pool
+ * libera todos sus objetos de una sola vez.
+ * El pool no es seguro para usar desde varios hilos a la vez: cada hilo
+ * tiene que usar su propio pool. */
+
+typedef struct pool pool_t;
+
+/*******************************************************************
+ *                    PRIMITIVAS DEL POOL                          *
+ ******************************************************************/
+
+// Crea un pool de objetos de tam_objeto bytes.
+// Pre: tam_objeto es mayor a 0.
+// Post: devuelve un pool sin objetos pedidos, o NULL en caso de error.
+pool_t *pool_crear(size_t tam_objeto);
+
+// Destruye el pool, liberando todos sus objetos (esten o no en uso).
+// Pre: el pool fue creado.
+// Post: los objetos pedidos al pool dejan de ser validos.
+void pool_destruir(pool_t *pool);
+
+// Pide un objeto al pool. Su contenido no esta inicializado.
+// Pre: el pool fue creado.
+// Post: devuelve el objeto, o NULL si no hay memoria.
+void *pool_pedir(pool_t *pool);
+
+// Devuelve al pool un objeto que ya no se usa. Si objeto es NULL no hace nada.
+// Pre: el pool fue creado y objeto se pidio a este mismo pool.
+// Post: el objeto puede volver a ser entregado por pool_pedir.
+void pool_devolver(pool_t *pool, void *objeto);
+
+// Devuelve el tamaño de los objetos del pool.
+// Pre: el pool fue creado.
+size_t pool_tam_objeto(const pool_t *pool);
+
+/*******************************************************************
+ *                    CONTADORES DEL POOL                          *
+ ******************************************************************/
+
+// Devuelve cuantas veces se llamo a pool_pedir con exito.
+// Pre: el pool fue creado.
+size_t pool_pedidos(const pool_t *pool);
+
+// Devuelve cuantos objetos estan pedidos y todavia no se devolvieron.
+// Pre: el pool fue creado.
+size_t pool_en_uso(const pool_t *pool);
+
+// Devuelve cuantos bloques se pidieron a malloc (cada uno con muchos objetos).
+// Pre: el pool fue creado.
+size_t pool_bloques(const pool_t *pool);
+
+#endif // POOL_H
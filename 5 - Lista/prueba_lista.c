@@ -334,6 +334,389 @@ void pruebas_iterador_en_ultimo(){
 
 }
 
+bool contar_hasta_diez(void* dato, void* cont){
+	return ++(*(int*)cont) < 10;
+}
+
+/* Inserta y borra con el iterador en muchas posiciones distintas, para
+ * probar los casos en que los nodos se llenan o se vacian. */
+void pruebas_volumen(){
+	int valores[1000];
+	for (int i = 0; i < 1000; i++)
+		valores[i] = i;
+//63
+	lista_t *lista = lista_crear();
+	for (int i = 1; i < 1000; i += 2)
+		lista_insertar_ultimo(lista, &valores[i]);
+	lista_iter_t *iter = lista_iter_crear(lista);
+	bool ok = true;
+	while (!lista_iter_al_final(iter)){
+		int actual = *(int*)lista_iter_ver_actual(iter);
+		ok &= lista_insertar(lista, iter, &valores[actual - 1]);
+		ok &= lista_iter_ver_actual(iter) == &valores[actual - 1];
+		lista_iter_avanzar(iter);
+		lista_iter_avanzar(iter);
+	}
+	lista_iter_destruir(iter);
+	print_test("Insertar con iter entre cada par de elementos", ok && lista_largo(lista) == 1000);
+//64
+	iter = lista_iter_crear(lista);
+	ok = true;
+	for (int i = 0; i < 1000; i++){
+		ok &= lista_iter_ver_actual(iter) == &valores[i];
+		lista_iter_avanzar(iter);
+	}
+	print_test("Los 1000 elementos quedaron en orden", ok && lista_iter_al_final(iter));
+	lista_iter_destruir(iter);
+//65
+	iter = lista_iter_crear(lista);
+	ok = true;
+	while (!lista_iter_al_final(iter)){
+		int *actual = lista_iter_ver_actual(iter);
+		if (*actual % 3 == 0)
+			ok &= lista_borrar(lista, iter) == actual;
+		else
+			lista_iter_avanzar(iter);
+	}
+	lista_iter_destruir(iter);
+	print_test("Borrar con iter los multiplos de 3", ok && lista_largo(lista) == 666);
+//66
+	iter = lista_iter_crear(lista);
+	ok = true;
+	for (int i = 0; i < 1000; i++){
+		if (i % 3 == 0) continue;
+		ok &= lista_iter_ver_actual(iter) == &valores[i];
+		lista_iter_avanzar(iter);
+	}
+	print_test("Quedan los demas elementos en orden", ok && lista_iter_al_final(iter));
+	lista_iter_destruir(iter);
+//67
+	int cont = 0;
+	lista_iterar(lista, contar_hasta_diez, &cont);
+	print_test("Iterar se detiene cuando visitar devuelve false", cont == 10);
+//68
+	for (int i = 0; i < 100; i++)
+		lista_insertar_primero(lista, &valores[i]);
+	ok = true;
+	for (int i = 99; i >= 0; i--)
+		ok &= lista_borrar_primero(lista) == &valores[i];
+	print_test("Insertar y borrar 100 elementos al principio", ok && lista_largo(lista) == 666);
+//69
+	while (!lista_esta_vacia(lista))
+		lista_borrar_primero(lista);
+	print_test("Borrar todo deja la lista vacia", lista_ver_primero(lista) == NULL);
+	ok = lista_insertar_ultimo(lista, &valores[7]) && lista_insertar_primero(lista, &valores[3]);
+	print_test("Se puede volver a usar la lista vaciada", ok && lista_ver_primero(lista) == &valores[3]);
+	lista_destruir(lista, NULL);
+}
+
+void pruebas_con_pool(){
+	int valores[1000];
+//70
+	pool_t *pool = pool_crear(lista_tam_nodo());
+	lista_t *lista = lista_crear_con_pool(pool);
+	lista_t *lista_1 = lista_crear_con_pool(pool);
+	print_test("Crear dos listas que comparten un pool", lista != NULL && lista_1 != NULL);
+//71
+	bool ok = true;
+	for (int i = 0; i < 1000; i++){
+		valores[i] = i;
+		ok &= lista_insertar_ultimo(i % 2 ? lista : lista_1, &valores[i]);
+	}
+	print_test("Insertar 1000 elementos entre las dos listas", ok && pool_en_uso(pool) > 0);
+	print_test("Se pidieron pocos bloques al pool", pool_bloques(pool) < 10);
+//72
+	lista_iter_t *iter = lista_iter_crear(lista);
+	ok = true;
+	for (int i = 1; i < 1000; i += 2){
+		ok &= lista_borrar(lista, iter) == &valores[i];
+		ok &= lista_insertar(lista, iter, &valores[i]);
+		lista_iter_avanzar(iter);
+	}
+	lista_iter_destruir(iter);
+	print_test("Borrar e insertar con iter usando el pool", ok && lista_largo(lista) == 500);
+//73
+	size_t bloques = pool_bloques(pool);
+	for (int i = 0; i < 100000; i++){
+		lista_insertar_primero(lista, &valores[0]);
+		lista_borrar_primero(lista);
+	}
+	print_test("Insertar y borrar reutiliza los nodos", pool_bloques(pool) == bloques);
+//74
+	lista_destruir(lista_1, NULL);
+	lista_destruir(lista, NULL);
+	print_test("Destruir las listas devuelve sus nodos", pool_en_uso(pool) == 0);
+	pool_destruir(pool);
+//75
+	pool_t *chico = pool_crear(1);
+	print_test("Crear con un pool de objetos chicos es NULL", lista_crear_con_pool(chico) == NULL);
+	pool_destruir(chico);
+//76
+	lista = lista_crear_con_pool(NULL);
+	for (int i = 0; i < 1000; i++)
+		lista_insertar_ultimo(lista, crear_punto());
+	lista_destruir(lista, destruir_punto);
+	print_test("Destruir lista con pool propio y 1000 elementos", true);
+}
+
+int comparar_enteros(const void *a, const void *b){
+	return *(const int*)a - *(const int*)b;
+}
+
+// Devuelve si la lista tiene exactamente los elementos esperados, en orden.
+bool lista_es(lista_t *lista, int **esperados, size_t cantidad){
+	if (lista_largo(lista) != cantidad) return false;
+	lista_iter_t *iter = lista_iter_crear(lista);
+	bool ok = true;
+	for (size_t i = 0; i < cantidad; i++){
+		ok &= lista_iter_ver_actual(iter) == esperados[i];
+		lista_iter_avanzar(iter);
+	}
+	ok &= lista_iter_al_final(iter);
+	lista_iter_destruir(iter);
+	return ok;
+}
+
+void pruebas_unir_y_partir(){
+	int valores[1000];
+	int *esperados[1000];
+	for (int i = 0; i < 1000; i++){
+		valores[i] = i;
+		esperados[i] = &valores[i];
+	}
+//77
+	lista_t *lista = lista_crear();
+	lista_t *otra = lista_crear();
+	for (int i = 0; i < 300; i++)
+		lista_insertar_ultimo(lista, &valores[i]);
+	for (int i = 300; i < 1000; i++)
+		lista_insertar_ultimo(otra, &valores[i]);
+	bool ok = lista_concatenar(lista, otra);
+	print_test("Concatenar dos listas", ok && lista_es(lista, esperados, 1000));
+//78
+	print_test("La otra lista queda vacia", lista_esta_vacia(otra) && lista_ver_primero(otra) == NULL);
+//79
+	ok = lista_concatenar(lista, otra) && lista_concatenar(otra, lista);
+	ok &= lista_esta_vacia(lista) && lista_es(otra, esperados, 1000);
+	print_test("Concatenar con listas vacias", ok);
+//80
+	lista_iter_t *iter = lista_iter_crear(otra);
+	for (int i = 0; i < 450; i++)
+		lista_iter_avanzar(iter);
+	lista_destruir(lista, NULL);
+	lista = lista_partir(otra, iter);
+	ok = lista != NULL && lista_iter_al_final(iter);
+	ok &= lista_es(otra, esperados, 450) && lista_es(lista, &esperados[450], 550);
+	print_test("Partir una lista con el iterador", ok);
+//81
+	ok = lista_insertar_ultimo(otra, &valores[0]) && lista_borrar_primero(lista) == &valores[450];
+	ok &= lista_insertar_primero(lista, &valores[450]) && lista_borrar_primero(otra) == &valores[0];
+	print_test("Las dos partes se pueden seguir usando", ok);
+//82
+	lista_iter_destruir(iter);
+	iter = lista_iter_crear(otra);
+	for (int i = 0; i < 100; i++)
+		lista_iter_avanzar(iter);
+	lista_t *resto = lista_partir(otra, iter);
+	lista_destruir(resto, NULL);
+	lista_iter_destruir(iter);
+	iter = lista_iter_crear(otra);
+	resto = lista_partir(otra, iter);
+	ok = resto != NULL && lista_esta_vacia(otra) && lista_es(resto, &esperados[1], 100);
+	print_test("Partir en el primero pasa toda la lista", ok);
+	lista_destruir(resto, NULL);
+	lista_destruir(lista, NULL);
+	lista_iter_destruir(iter);
+//83
+	lista = lista_crear();
+	for (int i = 0; i < 1000; i += 100)
+		lista_insertar_ultimo(lista, &valores[i]);
+	iter = lista_iter_crear(lista);
+	ok = true;
+	for (int i = 0; i < 1000; i += 100){
+		for (int j = i + 1; j < i + 100; j++)
+			lista_insertar_ultimo(otra, &valores[j]);
+		lista_iter_avanzar(iter);
+		ok &= lista_splice(lista, iter, otra);
+		ok &= lista_iter_al_final(iter) || lista_iter_ver_actual(iter) == &valores[i + 100];
+	}
+	print_test("Splice de cada tramo despues de su primer elemento", ok && lista_es(lista, esperados, 1000));
+//84
+	lista_iter_destruir(iter);
+	iter = lista_iter_crear(lista);
+	for (int i = 0; i < 500; i++)
+		lista_iter_avanzar(iter);
+	lista_t *segunda = lista_partir(lista, iter);
+	lista_iter_destruir(iter);
+	iter = lista_iter_crear(segunda);
+	ok = lista_splice(segunda, iter, lista) && lista_iter_ver_actual(iter) == &valores[500];
+	print_test("Splice al principio", ok && lista_es(segunda, esperados, 1000));
+	lista_iter_destruir(iter);
+//85
+	ok = true;
+	for (int i = 0; i < 1000; i++)
+		ok &= lista_insertar_ultimo(i % 3 ? lista : otra, segunda ? lista_borrar_primero(segunda) : NULL);
+	ok &= lista_fusionar_ordenado(lista, otra, comparar_enteros);
+	print_test("Fusionar dos listas ordenadas", ok && lista_es(lista, esperados, 1000) && lista_esta_vacia(otra));
+//86
+	for (int i = 0; i < 500; i++)
+		lista_insertar_ultimo(otra, lista_borrar_primero(lista));
+	ok = lista_fusionar_ordenado(lista, otra, comparar_enteros);
+	print_test("Fusionar cuando una va toda antes que la otra", ok && lista_es(lista, esperados, 1000));
+//87
+	int iguales[4] = {5, 5, 5, 5};
+	lista_t *unos = lista_crear();
+	lista_insertar_ultimo(segunda, &iguales[0]);
+	lista_insertar_ultimo(segunda, &iguales[1]);
+	lista_insertar_ultimo(unos, &iguales[2]);
+	lista_insertar_ultimo(unos, &iguales[3]);
+	int *orden[4] = {&iguales[0], &iguales[1], &iguales[2], &iguales[3]};
+	ok = lista_fusionar_ordenado(segunda, unos, comparar_enteros);
+	print_test("Fusionar es estable", ok && lista_es(segunda, orden, 4));
+	lista_destruir(unos, NULL);
+	lista_destruir(segunda, NULL);
+	lista_destruir(otra, NULL);
+	lista_destruir(lista, NULL);
+//88
+	pool_t *pool = pool_crear(lista_tam_nodo());
+	lista = lista_crear_con_pool(pool);
+	otra = lista_crear_con_pool(pool);
+	lista_t *propia = lista_crear_con_pool(NULL);
+	lista_t *comun = lista_crear();
+	for (int i = 0; i < 10; i++){
+		lista_insertar_ultimo(lista, &valores[i]);
+		lista_insertar_ultimo(otra, &valores[i + 10]);
+		lista_insertar_ultimo(propia, &valores[i]);
+	}
+	ok = lista_concatenar(lista, otra) && lista_es(lista, esperados, 20);
+	print_test("Concatenar dos listas del mismo pool", ok);
+//89
+	lista_insertar_ultimo(comun, &valores[0]);
+	ok = !lista_concatenar(lista, comun) && !lista_concatenar(comun, propia);
+	ok &= !lista_fusionar_ordenado(lista, propia, comparar_enteros);
+	ok &= lista_largo(lista) == 20 && lista_largo(comun) == 1 && lista_largo(propia) == 10;
+	print_test("No se unen listas con nodos de distinto origen", ok);
+//90
+	iter = lista_iter_crear(propia);
+	print_test("No se parte una lista con pool propio", lista_partir(propia, iter) == NULL);
+	lista_iter_destruir(iter);
+	lista_destruir(comun, NULL);
+	lista_destruir(propia, NULL);
+	lista_destruir(otra, NULL);
+	lista_destruir(lista, NULL);
+//91
+	print_test("Destruir las listas devuelve los nodos al pool", pool_en_uso(pool) == 0);
+	pool_destruir(pool);
+}
+
+void pruebas_recorrido_inverso(){
+	int valores[1000];
+//92
+	lista_t *lista = lista_crear();
+	lista_iter_t *iter = lista_iter_crear_final(lista);
+	bool ok = lista_iter_al_final(iter) && !lista_iter_retroceder(iter);
+	print_test("Iterador desde el final de una lista vacia", ok);
+	lista_iter_destruir(iter);
+//93
+	for (int i = 0; i < 1000; i++)
+		lista_insertar_ultimo(lista, &valores[i]);
+	iter = lista_iter_crear_final(lista);
+	ok = true;
+	for (int i = 999; i >= 0; i--){
+		ok &= lista_iter_ver_actual(iter) == &valores[i];
+		ok &= lista_iter_retroceder(iter);
+	}
+	print_test("Recorrer 1000 elementos hacia atras", ok && lista_iter_al_final(iter));
+//94
+	ok = lista_iter_retroceder(iter) && lista_iter_ver_actual(iter) == &valores[999];
+	ok &= lista_iter_avanzar(iter) && lista_iter_al_final(iter);
+	print_test("Desde el final se retrocede al ultimo", ok);
+	lista_iter_destruir(iter);
+//95
+	iter = lista_iter_crear_final(lista);
+	ok = true;
+	while (!lista_iter_al_final(iter)){
+		int *actual = lista_iter_ver_actual(iter);
+		// Al borrar, actual pasa a ser el siguiente: retrocediendo se llega
+		// al anterior al borrado.
+		if ((actual - valores) % 2 == 0)
+			ok &= lista_borrar(lista, iter) == actual;
+		lista_iter_retroceder(iter);
+	}
+	lista_iter_destruir(iter);
+	iter = lista_iter_crear(lista);
+	for (int i = 1; i < 1000; i += 2){
+		ok &= lista_iter_ver_actual(iter) == &valores[i];
+		lista_iter_avanzar(iter);
+	}
+	print_test("Borrar hacia atras los elementos pares", ok && lista_largo(lista) == 500);
+	lista_iter_destruir(iter);
+//96
+	iter = lista_iter_crear_final(lista);
+	ok = lista_insertar(lista, iter, &valores[0]) && lista_iter_retroceder(iter);
+	ok &= lista_iter_ver_actual(iter) == &valores[997];
+	lista_iter_destruir(iter);
+	iter = lista_iter_crear_final(lista);
+	ok &= lista_iter_ver_actual(iter) == &valores[999];
+	print_test("Insertar con un iterador que retrocede", ok && lista_largo(lista) == 501);
+	lista_iter_destruir(iter);
+	lista_destruir(lista, NULL);
+}
+
+// La lista desenrollada no tiene referencias: con ella esto no enlazaria.
+#ifndef LISTA_DESENROLLADA
+void pruebas_referencias(){
+	int valores[1000];
+	lista_ref_t *refs[1000];
+//97
+	lista_t *lista = lista_crear();
+	bool ok = true;
+	for (int i = 0; i < 1000; i++){
+		refs[i] = lista_insertar_ultimo_ref(lista, &valores[i]);
+		ok &= refs[i] != NULL && lista_ref_ver_dato(refs[i]) == &valores[i];
+	}
+	print_test("Insertar 1000 elementos con referencia", ok);
+//98
+	ok = true;
+	for (int i = 1; i < 1000; i += 2)
+		ok &= lista_borrar_ref(lista, refs[i]) == &valores[i];
+	print_test("Borrar por referencia los impares", ok && lista_largo(lista) == 500);
+//99
+	lista_iter_t *iter = lista_iter_crear(lista);
+	ok = true;
+	for (int i = 0; i < 1000; i += 2){
+		ok &= lista_iter_ver_ref(iter) == refs[i];
+		lista_iter_avanzar(iter);
+	}
+	lista_iter_destruir(iter);
+	iter = lista_iter_crear_final(lista);
+	for (int i = 998; i >= 0; i -= 2){
+		ok &= lista_iter_ver_actual(iter) == &valores[i];
+		lista_iter_retroceder(iter);
+	}
+	lista_iter_destruir(iter);
+	print_test("Quedan los pares en orden, hacia los dos lados", ok);
+//100
+	ok = lista_borrar_ref(lista, refs[0]) == &valores[0] && lista_borrar_ref(lista, refs[998]) == &valores[998];
+	ok &= lista_ver_primero(lista) == &valores[2];
+	ok &= lista_insertar_ultimo(lista, &valores[1]) && lista_largo(lista) == 499;
+	print_test("Borrar por referencia el primero y el ultimo", ok);
+//101
+	lista_t *otra = lista_crear();
+	lista_ref_t *ref = lista_insertar_primero_ref(otra, &valores[3]);
+	ok = lista_concatenar(lista, otra) && lista_borrar_ref(lista, ref) == &valores[3];
+	print_test("La referencia sigue valiendo al pasar a otra lista", ok && lista_largo(lista) == 499);
+	lista_destruir(otra, NULL);
+//102
+	while (!lista_esta_vacia(lista))
+		ok &= lista_borrar_ref(lista, lista_insertar_primero_ref(lista, &valores[0])) == &valores[0] &&
+			lista_borrar_primero(lista) != NULL;
+	ok &= lista_insertar_ultimo(lista, &valores[5]) && lista_ver_primero(lista) == &valores[5];
+	print_test("Vaciar la lista y volver a usarla", ok);
+	lista_destruir(lista, NULL);
+}
+#endif
+
 /* Ejecuta todas las pruebas. */
 void pruebas_lista()
 {
@@ -342,6 +725,13 @@ void pruebas_lista()
 	prueba_insertar_borrar();
 	pruebas_iterador_en_primero();
 	pruebas_iterador_en_ultimo();
+	pruebas_volumen();
+	pruebas_con_pool();
+	pruebas_unir_y_partir();
+	pruebas_recorrido_inverso();
+#ifndef LISTA_DESENROLLADA
+	pruebas_referencias();
+#endif
 
 }
 
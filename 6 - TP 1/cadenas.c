@@ -0,0 +1,61 @@
+#include "cadenas.h"
+#include <stdlib.h>
+#include <string.h>
+#define TAM_BLOQUE 65536
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+// Las cadenas se copian una atras de otra en el bloque actual. Cuando no
+// entra, se pide otro bloque (mas grande si la cadena no entra en uno).
+typedef struct bloque{
+	struct bloque* anterior;
+	size_t tam;
+	size_t usado;
+	char datos[];
+}bloque_t;
+
+struct cadenas{
+	bloque_t* actual;
+};
+
+ /*******************************************************************
+ *                        IMPLEMENTACION                            *
+ *******************************************************************/
+
+cadenas_t* cadenas_crear(){
+	cadenas_t* cadenas = malloc(sizeof(cadenas_t));
+	if (cadenas == NULL) return NULL;
+
+	cadenas->actual = NULL;
+	return cadenas;
+}
+
+void cadenas_destruir(cadenas_t* cadenas){
+	while (cadenas->actual != NULL){
+		bloque_t* anterior = cadenas->actual->anterior;
+		free(cadenas->actual);
+		cadenas->actual = anterior;
+	}
+	free(cadenas);
+}
+
+char* cadenas_guardar(cadenas_t* cadenas, const char* cadena){
+	size_t largo = strlen(cadena) + 1;
+	bloque_t* bloque = cadenas->actual;
+	if (bloque == NULL || bloque->tam - bloque->usado < largo){
+		size_t tam = largo > TAM_BLOQUE ? largo : TAM_BLOQUE;
+		bloque = malloc(sizeof(bloque_t) + tam);
+		if (bloque == NULL) return NULL;
+
+		bloque->anterior = cadenas->actual;
+		bloque->tam = tam;
+		bloque->usado = 0;
+		cadenas->actual = bloque;
+	}
+	char* copia = bloque->datos + bloque->usado;
+	memcpy(copia, cadena, largo);
+	bloque->usado += largo;
+	return copia;
+}
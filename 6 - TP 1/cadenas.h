@@ -0,0 +1,30 @@
+#ifndef CADENAS_H
+#define CADENAS_H
+
+#include <stddef.h>
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+/* Un almacen de cadenas guarda copias de cadenas en bloques grandes, sin
+ * pedir memoria por cada una. Las copias viven hasta que se destruye el
+ * almacen, que las libera todas juntas. */
+
+typedef struct cadenas cadenas_t;
+
+ /*******************************************************************
+ *                           PRIMITIVAS                             *
+ *******************************************************************/
+
+// Crea un almacen de cadenas vacio. Devuelve NULL si falla.
+cadenas_t* cadenas_crear();
+
+// Destruye el almacen y todas las cadenas que guardo.
+void cadenas_destruir(cadenas_t* cadenas);
+
+// Guarda una copia de cadena en el almacen y la devuelve, o NULL si no se
+// pudo pedir memoria.
+char* cadenas_guardar(cadenas_t* cadenas, const char* cadena);
+
+#endif //CADENAS_H
@@ -0,0 +1,69 @@
+#include "donaciones.h"
+#include <stdlib.h>
+#define TAM_INICIAL 4
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+struct donaciones{
+	int* montos;
+	size_t cantidad;
+	size_t tam;
+	long total;
+};
+
+ /*******************************************************************
+ *                        IMPLEMENTACION                            *
+ *******************************************************************/
+
+donaciones_t* donaciones_crear(){
+	donaciones_t* donaciones = malloc(sizeof(donaciones_t));
+	if (donaciones == NULL) return NULL;
+
+	donaciones->montos = NULL;
+	donaciones->cantidad = 0;
+	donaciones->tam = 0;
+	donaciones->total = 0;
+	return donaciones;
+}
+
+void donaciones_destruir(donaciones_t* donaciones){
+	free(donaciones->montos);
+	free(donaciones);
+}
+
+bool donaciones_agregar(donaciones_t* donaciones, int monto){
+	if (donaciones->cantidad == donaciones->tam){
+		size_t tam = donaciones->tam ? donaciones->tam * 2 : TAM_INICIAL;
+		int* aux = realloc(donaciones->montos, tam * sizeof(int));
+		if (aux == NULL) return false;
+		donaciones->montos = aux;
+		donaciones->tam = tam;
+	}
+	donaciones->montos[donaciones->cantidad++] = monto;
+	donaciones->total += monto;
+	return true;
+}
+
+size_t donaciones_cantidad(const donaciones_t* donaciones){
+	return donaciones->cantidad;
+}
+
+long donaciones_total(const donaciones_t* donaciones){
+	return donaciones->total;
+}
+
+void donaciones_mostrar(const donaciones_t* donaciones, salida_t* salida){
+	salida_caracter(salida, '[');
+	for (size_t i = donaciones->cantidad; i > 0; i--){
+		salida_entero(salida, donaciones->montos[i - 1]);
+		if (i > 1) salida_caracter(salida, ',');
+	}
+	salida_caracter(salida, ']');
+}
+
+void donaciones_vaciar(donaciones_t* donaciones){
+	donaciones->cantidad = 0;
+	donaciones->total = 0;
+}
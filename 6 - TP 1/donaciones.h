@@ -0,0 +1,43 @@
+#ifndef DONACIONES_H
+#define DONACIONES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "salida.h"
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+/* Las donaciones de una persona, en el orden en que se hicieron, junto con
+ * su total (que se mantiene al agregar, sin recorrerlas). */
+
+typedef struct donaciones donaciones_t;
+
+ /*******************************************************************
+ *                           PRIMITIVAS                             *
+ *******************************************************************/
+
+// Crea un registro de donaciones vacio. Devuelve NULL si falla.
+donaciones_t* donaciones_crear();
+
+// Destruye el registro.
+void donaciones_destruir(donaciones_t* donaciones);
+
+// Agrega una donacion. Devuelve false si falla.
+bool donaciones_agregar(donaciones_t* donaciones, int monto);
+
+// Devuelve cuantas donaciones hay.
+size_t donaciones_cantidad(const donaciones_t* donaciones);
+
+// Devuelve la suma de todas las donaciones, en O(1).
+long donaciones_total(const donaciones_t* donaciones);
+
+// Escribe en la salida las donaciones de la ultima a la primera, con el
+// formato [d1,d2,...,dn] ([] si no hay ninguna).
+void donaciones_mostrar(const donaciones_t* donaciones, salida_t* salida);
+
+// Borra todas las donaciones.
+void donaciones_vaciar(donaciones_t* donaciones);
+
+#endif //DONACIONES_H
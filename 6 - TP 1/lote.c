@@ -0,0 +1,70 @@
+#include "lote.h"
+#include "lector.h"
+#include <stdlib.h>
+#include <string.h>
+#define DONAR "donar"
+#define NOMINAR "nominar"
+#define TIRAR_BALDE "tirar_balde"
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+// Las lineas las entrega el lector, que las conserva hasta el proximo
+// lote_leer.
+struct lote{
+	lector_t* lector;
+};
+
+ /*******************************************************************
+ *                        IMPLEMENTACION                            *
+ *******************************************************************/
+
+void comando_separar(char* linea, comando_t* comando){
+	comando->nombre = strtok(linea, " ");
+	char* tipo = comando->nombre != NULL ? strtok(NULL, " ") : NULL;
+	comando->argumento = NULL;
+
+	if (tipo == NULL)
+		comando->tipo = COMANDO_INVALIDO;
+	else if (strcmp(tipo, (char*) DONAR) == 0){
+		comando->tipo = COMANDO_DONAR;
+		comando->argumento = strtok(NULL, " ");
+	}
+	else if (strcmp(tipo, (char*) NOMINAR) == 0){
+		comando->tipo = COMANDO_NOMINAR;
+		comando->argumento = strtok(NULL, "\0");
+	}
+	else if (strcmp(tipo, (char*) TIRAR_BALDE) == 0){
+		comando->tipo = COMANDO_TIRAR_BALDE;
+		comando->argumento = strtok(NULL, " ");
+	}
+	else
+		comando->tipo = COMANDO_INVALIDO;
+}
+
+lote_t* lote_abrir(const char* ruta){
+	lote_t* lote = malloc(sizeof(lote_t));
+	if (lote == NULL) return NULL;
+	lote->lector = lector_abrir(ruta);
+	if (lote->lector == NULL){
+		free(lote);
+		return NULL;
+	}
+	lector_conservar(lote->lector);
+	return lote;
+}
+
+void lote_destruir(lote_t* lote){
+	lector_destruir(lote->lector);
+	free(lote);
+}
+
+size_t lote_leer(lote_t* lote, comando_t* comandos, size_t max){
+	lector_soltar(lote->lector);
+	size_t cantidad = 0;
+	char* linea;
+	while (cantidad < max && (linea = lector_linea(lote->lector, NULL)) != NULL)
+		comando_separar(linea, &comandos[cantidad++]);
+	return cantidad;
+}
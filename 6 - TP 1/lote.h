@@ -0,0 +1,52 @@
+#ifndef LOTE_H
+#define LOTE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+typedef enum tipo_comando{
+	COMANDO_DONAR,
+	COMANDO_NOMINAR,
+	COMANDO_TIRAR_BALDE,
+	COMANDO_INVALIDO
+} tipo_comando_t;
+
+// Un comando ya separado. nombre y argumento apuntan a la linea de la que
+// salio (argumento es el monto, los nominados o la eleccion segun el tipo,
+// y puede ser NULL).
+typedef struct comando{
+	tipo_comando_t tipo;
+	char* nombre;
+	char* argumento;
+} comando_t;
+
+/* Un lote es un archivo de comandos que se separa de a muchos comandos por
+ * vez, sin copiar las lineas: las lee un lector (ver lector.h) que las
+ * conserva mientras se usan los comandos. */
+
+typedef struct lote lote_t;
+
+ /*******************************************************************
+ *                           PRIMITIVAS                             *
+ *******************************************************************/
+
+// Separa la linea en nombre, comando y argumento. Modifica la linea.
+void comando_separar(char* linea, comando_t* comando);
+
+// Abre el archivo de comandos ruta. Devuelve NULL si no se pudo abrir.
+lote_t* lote_abrir(const char* ruta);
+
+// Destruye el lote. Los comandos que devolvio dejan de valer.
+void lote_destruir(lote_t* lote);
+
+// Separa hasta max comandos siguientes del lote en comandos y devuelve
+// cuantos separo (0 al llegar al final del archivo).
+// Post: los comandos que se devolvieron en la llamada anterior dejan de
+// valer.
+size_t lote_leer(lote_t* lote, comando_t* comandos, size_t max);
+
+#endif //LOTE_H
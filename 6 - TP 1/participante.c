@@ -1,17 +1,18 @@
 #include "participante.h"
-#include "pila.h"
+#include "donaciones.h"
 #include <stdlib.h>
 #include <stdbool.h>
-#include <string.h>
-#include <stdio.h>
 
 /*******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS                 *
  ******************************************************************/
 
+// El nombre no es de la persona: es del almacen de cadenas del sistema.
+// Las donaciones se crean con la primera: los nominados que nunca donan
+// no piden memoria para ellas.
 struct persona{
 	char* nombre;
-	pila_t *donaciones;
+	donaciones_t* donaciones;
 };
 
  /*******************************************************************
@@ -22,16 +23,14 @@ persona_t *crear_persona(char *nombre){
 	persona_t* persona = malloc(sizeof(persona_t));
 	if (persona == NULL) return NULL;
 
-	pila_t* pila = pila_crear();
-	if (pila == NULL) return NULL;
-
 	persona->nombre = nombre;
-	persona->donaciones = pila;
+	persona->donaciones = NULL;
 	return persona;
 }
 void destruir_persona(void* persona){
 	persona_t *per = (persona_t*) persona;
-	pila_destruir(per->donaciones);
+	if (per->donaciones != NULL)
+		donaciones_destruir(per->donaciones);
 	free(per);
 	return;
 }
@@ -40,34 +39,26 @@ char* ver_nombre(persona_t* persona){
 	return persona->nombre;
 }
 
-pila_t* ver_donaciones(persona_t* persona){
-	return persona->donaciones;
-}
-
-void mostrar_donaciones(pila_t *pila){
-	if (pila_esta_vacia(pila)){
-		puts("OK [] TOTAL: 0");
+void mostrar_donaciones(persona_t* persona, salida_t* salida){
+	if (!participante_dono(persona)){
+		salida_linea(salida, "OK [] TOTAL: 0");
 		return;
 	}
-	else{
-		char donaciones[100] = "\0";
-		strcat(donaciones, (char*) "[");
-		int total = 0;
-		while(!pila_esta_vacia(pila)){
-			char* d = pila_desapilar(pila);
-			strcat(donaciones, d);
-			if (!pila_esta_vacia(pila))
-				strcat(donaciones, (char*) ",");
-			total += atoi(d);
-		}
-		strcat(donaciones, (char*) "]");
-		printf("OK %s TOTAL: %i\n",donaciones, total);
-	}
+	salida_cadena(salida, "OK ");
+	donaciones_mostrar(persona->donaciones, salida);
+	salida_cadena(salida, " TOTAL: ");
+	salida_entero(salida, donaciones_total(persona->donaciones));
+	salida_fin_linea(salida);
+	donaciones_vaciar(persona->donaciones);
 }
-void agregar_donacion(persona_t* persona, char* monto){
-	pila_apilar(persona->donaciones, monto);
+bool agregar_donacion(persona_t* persona, int monto){
+	if (persona->donaciones == NULL){
+		persona->donaciones = donaciones_crear();
+		if (persona->donaciones == NULL) return false;
+	}
+	return donaciones_agregar(persona->donaciones, monto);
 }
 
 bool participante_dono(persona_t* persona){
-	return !pila_esta_vacia(persona->donaciones);
+	return persona->donaciones != NULL && donaciones_cantidad(persona->donaciones) > 0;
 }
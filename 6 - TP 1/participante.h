@@ -3,7 +3,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
-#include "pila.h"
+#include "salida.h"
 
 
 /*******************************************************************
@@ -16,24 +16,22 @@ typedef struct persona persona_t;
  *                           PRIMITIVAS                             *
  *******************************************************************/
 
-// Recibe nombre y crea una persona, inicializa una pila vacia de donaciones.
+// Recibe nombre y crea una persona sin donaciones. El nombre tiene que
+// durar lo mismo que la persona (no se copia ni se libera).
 persona_t *crear_persona(char* nombre);
 
-// Destruye la pila y la estructura.
+// Destruye las donaciones y la estructura.
 void destruir_persona(void* persona);
 
 // Recibe una persona y devuelve su nombre.
 char* ver_nombre(persona_t* persona);
 
-//Recibe una persona y devuelve una pila con sus donaciones.
-pila_t* ver_donaciones(persona_t* persona);
+// Escribe en la salida una lista con la donaciones hechas por la persona
+// en orden inverso y el total de estas. Las donaciones se borran.
+void mostrar_donaciones(persona_t* persona, salida_t* salida);
 
-// Devuelve por pantalla una lista con la donaciones hechas por la persona
-// en orden inverso y el total de estas. Se desapila la pila.
-void mostrar_donaciones(pila_t *pila);
-
-// Se agrega una donacion a la pila de una persona.
-void agregar_donacion(persona_t* persona, char* monto);
+// Se agrega una donacion a las de la persona. Devuelve false si falla.
+bool agregar_donacion(persona_t* persona, int monto);
 
 // Devuelve true si el participante dono, false si no. 
 bool participante_dono(persona_t* persona);
@@ -0,0 +1,107 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+/*******************************************************************
+ *                PRUEBAS DE COMANDOS INCOMPLETOS DEL TP1           *
+ ******************************************************************/
+
+/* Corre ./tp1 con guiones cortos, leyendolos de la entrada estandar y en
+ * modo por lotes (./tp1 archivo), y compara la salida con la esperada.
+ * Un comando sin su argumento tiene que dar su error, no terminar el
+ * programa. */
+
+#define TAM_SALIDA 4096
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+// Corre ./tp1 con el guion ruta como archivo (lote) o como entrada
+// estandar y guarda lo que escribe en salida. Devuelve false si fallo o no
+// termino con 0.
+bool correr(const char* ruta, bool lote, char* salida, size_t tam)
+{
+	int tubo[2];
+	if (pipe(tubo) != 0) return false;
+	pid_t pid = fork();
+	if (pid < 0) return false;
+	if (pid == 0)
+	{
+		close(tubo[0]);
+		dup2(tubo[1], STDOUT_FILENO);
+		if (lote)
+			execl("./tp1", "tp1", ruta, (char*)NULL);
+		else
+		{
+			int entrada = open(ruta, O_RDONLY);
+			dup2(entrada, STDIN_FILENO);
+			execl("./tp1", "tp1", (char*)NULL);
+		}
+		_exit(127);
+	}
+	close(tubo[1]);
+	size_t usado = 0;
+	ssize_t leidos;
+	while (usado < tam - 1 && (leidos = read(tubo[0], salida + usado, tam - 1 - usado)) > 0)
+		usado += (size_t)leidos;
+	salida[usado] = '\0';
+	close(tubo[0]);
+
+	int estado;
+	waitpid(pid, &estado, 0);
+	return WIFEXITED(estado) && WEXITSTATUS(estado) == 0;
+}
+
+// Escribe el guion en un archivo temporal, lo corre de las dos formas y
+// compara con la salida esperada.
+void probar(char* nombre, const char* guion, const char* esperada)
+{
+	char ruta[] = "/tmp/prueba_tp1XXXXXX";
+	int fd = mkstemp(ruta);
+	bool ok = fd >= 0 && write(fd, guion, strlen(guion)) == (ssize_t)strlen(guion);
+	if (fd >= 0) close(fd);
+
+	char salida[TAM_SALIDA];
+	bool entrada = ok && correr(ruta, false, salida, TAM_SALIDA) && strcmp(salida, esperada) == 0;
+	bool lote = ok && correr(ruta, true, salida, TAM_SALIDA) && strcmp(salida, esperada) == 0;
+	unlink(ruta);
+
+	char titulo[256];
+	snprintf(titulo, sizeof(titulo), "%s (entrada estandar)", nombre);
+	print_test(titulo, entrada);
+	snprintf(titulo, sizeof(titulo), "%s (lote)", nombre);
+	print_test(titulo, lote);
+}
+
+void pruebas_comandos_incompletos()
+{
+	probar("Donar sin monto despues de otro comando da ERROR1",
+		"Juan nominar Pedro\nJuan donar\n",
+		"ERROR2\nERROR1\n");
+	probar("Donar sin monto como ultima linea da ERROR1",
+		"Juan donar 10\nJuan donar",
+		"OK\nERROR1\n");
+	probar("Nominar sin nominados no nomina a nadie",
+		"Juan donar 10\nJuan nominar\nJuan nominar Pedro\n",
+		"OK\nOK Pedro\n");
+	probar("Tirar el balde sin eleccion da ERROR6 (o ERROR5 si no le toca)",
+		"Juan donar 10\nPedro tirar_balde\nJuan tirar_balde\nJuan tirar_balde si\n",
+		"OK\nERROR5\nERROR6\nOK [10] TOTAL: 10\n");
+	probar("Una linea sin comando da ERROR7",
+		"Juan\nJuan bailar\n",
+		"ERROR7\nERROR7\n");
+}
+
+int main(void)
+{
+	pruebas_comandos_incompletos();
+	return 0;
+}
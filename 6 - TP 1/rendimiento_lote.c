@@ -0,0 +1,107 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+/*******************************************************************
+ *              MEDICION DEL MODO POR LOTES DEL TP1                 *
+ ******************************************************************/
+
+/* Genera un guion sintetico de comandos y mide cuantos comandos por segundo
+ * ejecuta ./tp1 leyendolos de la entrada estandar y en modo por lotes
+ * (./tp1 archivo). La salida de tp1 se descarta. */
+
+#define COMANDOS 10000000
+#define PERSONAS 200000
+
+double segundos_desde(struct timespec* inicio)
+{
+	struct timespec fin;
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	return (fin.tv_sec - inicio->tv_sec) + (fin.tv_nsec - inicio->tv_nsec) / 1e9;
+}
+
+// Escribe el guion: mayormente donaciones y baldes, algunas nominaciones y
+// algun comando invalido.
+bool generar(const char* ruta, long comandos)
+{
+	FILE* archivo = fopen(ruta, "w");
+	if (!archivo) return false;
+	srand(42);
+	for (long i = 0; i < comandos; i++)
+	{
+		int persona = rand() % PERSONAS;
+		int r = rand() % 100;
+		if (r < 40)
+			fprintf(archivo, "p%d donar %d\n", persona, rand() % 1000);
+		else if (r < 60)
+			fprintf(archivo, "p%d nominar p%d p%d\n", persona, rand() % PERSONAS, rand() % PERSONAS);
+		else if (r < 95)
+			fprintf(archivo, "p%d tirar_balde %s\n", persona, rand() % 4 ? "si" : "no");
+		else
+			fprintf(archivo, "p%d bailar\n", persona);
+	}
+	return fclose(archivo) == 0;
+}
+
+// Corre ./tp1 con el guion como archivo (lote) o como entrada estandar, y
+// devuelve los segundos que tardo, o -1 si fallo.
+double correr(const char* ruta, bool lote)
+{
+	struct timespec inicio;
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	pid_t pid = fork();
+	if (pid < 0) return -1;
+	if (pid == 0)
+	{
+		int nulo = open("/dev/null", O_WRONLY);
+		dup2(nulo, STDOUT_FILENO);
+		if (lote)
+			execl("./tp1", "tp1", ruta, (char*)NULL);
+		else
+		{
+			int entrada = open(ruta, O_RDONLY);
+			dup2(entrada, STDIN_FILENO);
+			execl("./tp1", "tp1", (char*)NULL);
+		}
+		_exit(127);
+	}
+	int estado;
+	waitpid(pid, &estado, 0);
+	if (!WIFEXITED(estado) || WEXITSTATUS(estado) != 0) return -1;
+	return segundos_desde(&inicio);
+}
+
+/* Programa principal. Recibe opcionalmente la cantidad de comandos. */
+int main(int argc, char** argv)
+{
+	long comandos = argc > 1 ? atol(argv[1]) : COMANDOS;
+	char ruta[] = "/tmp/rendimiento_loteXXXXXX";
+	int fd = mkstemp(ruta);
+	if (fd < 0) return 1;
+	close(fd);
+
+	printf("generando %ld comandos...\n", comandos);
+	if (!generar(ruta, comandos))
+	{
+		unlink(ruta);
+		return 1;
+	}
+
+	printf("%-16s %10s %14s\n", "modo", "s", "comandos/s");
+	const char* nombres[] = {"entrada", "lote"};
+	for (int i = 0; i < 2; i++)
+	{
+		double s = correr(ruta, i == 1);
+		if (s < 0)
+			printf("%-16s %10s\n", nombres[i], "fallo");
+		else
+			printf("%-16s %10.2f %14.0f\n", nombres[i], s, comandos / s);
+	}
+	unlink(ruta);
+	return 0;
+}
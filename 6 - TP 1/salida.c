@@ -0,0 +1,110 @@
+#include "salida.h"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#define TAM_BUFFER 65536
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+struct salida{
+	int fd;
+	bool interactiva; // si se vacia en cada fin de linea
+	size_t usado;
+	size_t tam;
+	char buffer[];
+};
+
+ /*******************************************************************
+ *                        IMPLEMENTACION                            *
+ *******************************************************************/
+
+salida_t* salida_crear(int fd){
+	return salida_crear_con_tam(fd, TAM_BUFFER);
+}
+
+salida_t* salida_crear_con_tam(int fd, size_t tam){
+	if (tam == 0) tam = 1;
+	salida_t* salida = malloc(sizeof(salida_t) + tam);
+	if (salida == NULL) return NULL;
+
+	salida->fd = fd;
+	salida->interactiva = isatty(fd);
+	salida->usado = 0;
+	salida->tam = tam;
+	return salida;
+}
+
+void salida_destruir(salida_t* salida){
+	salida_vaciar(salida);
+	free(salida);
+}
+
+bool salida_vaciar(salida_t* salida){
+	size_t escrito = 0;
+	while (escrito < salida->usado){
+		ssize_t n = write(salida->fd, salida->buffer + escrito, salida->usado - escrito);
+		if (n < 0 && errno == EINTR) continue;
+		if (n <= 0){
+			salida->usado = 0;
+			return false;
+		}
+		escrito += (size_t)n;
+	}
+	salida->usado = 0;
+	return true;
+}
+
+// Agrega largo bytes de datos a la salida. Lo que no entra en el buffer
+// vacio se escribe directamente.
+static void salida_escribir(salida_t* salida, const char* datos, size_t largo){
+	if (largo > salida->tam - salida->usado){
+		salida_vaciar(salida);
+		if (largo > salida->tam){
+			while (largo > 0){
+				ssize_t n = write(salida->fd, datos, largo);
+				if (n < 0 && errno == EINTR) continue;
+				if (n <= 0) return;
+				datos += n;
+				largo -= (size_t)n;
+			}
+			return;
+		}
+	}
+	memcpy(salida->buffer + salida->usado, datos, largo);
+	salida->usado += largo;
+}
+
+void salida_cadena(salida_t* salida, const char* cadena){
+	salida_escribir(salida, cadena, strlen(cadena));
+}
+
+void salida_entero(salida_t* salida, long numero){
+	// Los digitos se arman de atras para adelante.
+	char digitos[24];
+	size_t pos = sizeof(digitos);
+	unsigned long valor = numero < 0 ? 0UL - (unsigned long)numero : (unsigned long)numero;
+	do{
+		digitos[--pos] = (char)('0' + valor % 10);
+		valor /= 10;
+	}while (valor > 0);
+	if (numero < 0) digitos[--pos] = '-';
+	salida_escribir(salida, digitos + pos, sizeof(digitos) - pos);
+}
+
+void salida_caracter(salida_t* salida, char caracter){
+	if (salida->usado == salida->tam) salida_vaciar(salida);
+	salida->buffer[salida->usado++] = caracter;
+}
+
+void salida_fin_linea(salida_t* salida){
+	salida_caracter(salida, '\n');
+	if (salida->interactiva) salida_vaciar(salida);
+}
+
+void salida_linea(salida_t* salida, const char* cadena){
+	salida_cadena(salida, cadena);
+	salida_fin_linea(salida);
+}
@@ -0,0 +1,52 @@
+#ifndef SALIDA_H
+#define SALIDA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+/* La salida junta lo que se escribe en un buffer grande y lo manda con
+ * write(2) cuando se llena, al vaciarla o al destruirla. Si escribe en una
+ * terminal se vacia en cada fin de linea, para que se vean las respuestas
+ * a medida que se escriben los comandos. */
+
+typedef struct salida salida_t;
+
+ /*******************************************************************
+ *                           PRIMITIVAS                             *
+ *******************************************************************/
+
+// Crea una salida que escribe en el descriptor fd (1 para la salida
+// estandar). Devuelve NULL si falla.
+salida_t* salida_crear(int fd);
+
+// Como salida_crear, pero con un buffer de tam bytes: con uno grande se
+// hacen menos llamadas a write.
+salida_t* salida_crear_con_tam(int fd, size_t tam);
+
+// Vacia la salida y la destruye. El descriptor no se cierra.
+void salida_destruir(salida_t* salida);
+
+// Agrega la cadena a la salida.
+void salida_cadena(salida_t* salida, const char* cadena);
+
+// Agrega el numero, en decimal, a la salida.
+void salida_entero(salida_t* salida, long numero);
+
+// Agrega un caracter a la salida.
+void salida_caracter(salida_t* salida, char caracter);
+
+// Agrega un fin de linea a la salida.
+void salida_fin_linea(salida_t* salida);
+
+// Agrega la cadena y un fin de linea, como puts.
+void salida_linea(salida_t* salida, const char* cadena);
+
+// Escribe todo lo que quedaba en el buffer. Devuelve false si hubo un error
+// al escribir.
+bool salida_vaciar(salida_t* salida);
+
+#endif //SALIDA_H
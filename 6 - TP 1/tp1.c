@@ -1,131 +1,139 @@
 #include "tp1.h"
 #include "participante.h"
-#include "lectura.h"
+#include "lector.h"
 #include "cola.h"
 #include "pila.h"
 #include "lista.h"
+#include "hash.h"
+#include "cadenas.h"
+#include "salida.h"
+#include "lote.h"
 #include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
-#include <stdio.h>
-#define DONAR "donar"
-#define NOMINAR "nominar"
-#define TIRAR_BALDE "tirar_balde"
+#include <unistd.h>
+#define COMANDOS_POR_LOTE 65536
+#define TAM_SALIDA_LOTE (8 * 1024 * 1024)
 
 /*******************************************************************
  *                DEFINICION DE LOS TIPOS DE DATOS                 *
  ******************************************************************/
 
+// lista tiene a las personas en orden de inscripcion, y personas las
+// mismas personas indexadas por nombre. Los nombres se copian a nombres
+// (las lineas leidas no se guardan), y el hash usa esas mismas copias. Las respuestas se escriben en salida.
 struct sistema{
 	lista_t* lista;
-	lista_t* lista_usuario;
+	hash_t* personas;
+	cadenas_t* nombres;
 	cola_t* cola;
+	salida_t* salida;
 };
 
  /*******************************************************************
  *                        IMPLEMENTACION                            *
  *******************************************************************/
-sistema_t* crear_sistema(){
+sistema_t* crear_sistema(salida_t* salida){
+	if (salida == NULL) return NULL;
 	sistema_t* sistema = malloc(sizeof(sistema_t));
-	if (sistema == NULL) return NULL;
-
 	lista_t* lista = lista_crear();
-	if (lista == NULL) return NULL;
-
-	lista_t* lista_usuario = lista_crear();
-	if (lista_usuario == NULL) return NULL;
-
 	cola_t* cola = cola_crear();
-	if (cola == NULL) return NULL;
+	hash_t* personas = hash_crear(NULL);
+	cadenas_t* nombres = cadenas_crear();
+	if (sistema == NULL || lista == NULL || cola == NULL || personas == NULL || nombres == NULL){
+		free(sistema);
+		if (lista != NULL) lista_destruir(lista, NULL);
+		if (cola != NULL) cola_destruir(cola, NULL);
+		if (personas != NULL) hash_destruir(personas);
+		if (nombres != NULL) cadenas_destruir(nombres);
+		salida_destruir(salida);
+		return NULL;
+	}
 
 	sistema->lista = lista;
-	sistema->lista_usuario = lista_usuario;
+	sistema->personas = personas;
+	sistema->nombres = nombres;
 	sistema->cola = cola;
+	sistema->salida = salida;
 
 	return sistema;
 }
 
 void sistema_destruir(sistema_t* sistema){
-	lista_destruir(sistema->lista_usuario, free);
 	cola_destruir(sistema->cola, NULL);
+	hash_destruir(sistema->personas);
 	lista_destruir(sistema->lista, destruir_persona);
+	cadenas_destruir(sistema->nombres);
+	salida_destruir(sistema->salida);
 	free(sistema);
 }
 
-persona_t* esta_en_sistema(char *nombre, lista_t *lista){
-	if (lista_esta_vacia(lista)) return NULL;
-	persona_t* persona;
-	bool ok = false;
-	lista_iter_t *iter = lista_iter_crear(lista);
-	if (iter == NULL) return NULL;
-
-	while (!lista_iter_al_final(iter)){
-		persona = lista_iter_ver_actual(iter);
-		char *actual = ver_nombre(persona);
-		if(strcmp(actual, nombre) == 0){
-			ok = true;
-			break;
-		}
-
-		lista_iter_avanzar(iter);
-	}
-	lista_iter_destruir(iter);
-	if (ok) return persona;
-
-	return NULL;
+persona_t* esta_en_sistema(char *nombre, sistema_t* sistema){
+	return hash_obtener(sistema->personas, nombre);
 }
 
-void inscripcion(persona_t* persona, char* monto, sistema_t* sistema){
-	if (monto != NULL) 
-		agregar_donacion(persona, monto);
+// Crea una persona con una copia de nombre guardada en el sistema.
+static persona_t* crear_inscripto(char* nombre, sistema_t* sistema){
+	char* copia = cadenas_guardar(sistema->nombres, nombre);
+	if (copia == NULL) return NULL;
+	return crear_persona(copia);
+}
 
-	lista_insertar_ultimo(sistema->lista, persona);
-	cola_encolar(sistema->cola, ver_nombre(persona));
+bool inscripcion(persona_t* persona, int monto, sistema_t* sistema){
+	// Primero la lista, que es la duena de la persona: si despues falla
+	// algo, la persona se libera al destruir el sistema.
+	if (!lista_insertar_ultimo(sistema->lista, persona)){
+		destruir_persona(persona);
+		return false;
+	}
+	if (!cola_encolar(sistema->cola, ver_nombre(persona))) return false;
+	if (!hash_guardar_prestada(sistema->personas, ver_nombre(persona), persona)) return false;
+	return monto == 0 || agregar_donacion(persona, monto);
 }
 
 bool donar(char *nombre, char* monto, sistema_t* sistema){
 	int donacion = 0;
-	if (!(donacion = atoi(monto)) || donacion < 0){
-		puts("ERROR1");
+	if (monto == NULL || !(donacion = atoi(monto)) || donacion < 0){
+		salida_linea(sistema->salida, "ERROR1");
 		return true;
 	}
 	else
-		puts("OK");
+		salida_linea(sistema->salida, "OK");
 
-	persona_t* persona = esta_en_sistema(nombre, sistema->lista);
+	persona_t* persona = esta_en_sistema(nombre, sistema);
 	if (persona != NULL)
-		agregar_donacion(persona, monto);
+		return agregar_donacion(persona, donacion);
 
-	else{
-		persona_t *p = crear_persona(nombre);
-		if (p == NULL) return false;
+	persona_t *p = crear_inscripto(nombre, sistema);
+	if (p == NULL) return false;
 
-		inscripcion(p, monto, sistema);
-	}
-	return true;
+	return inscripcion(p, donacion, sistema);
 }
 
 
 bool nominar(char* nombre, char* nominados, sistema_t* sistema){
-	persona_t* persona = esta_en_sistema(nombre, sistema->lista);
+	persona_t* persona = esta_en_sistema(nombre, sistema);
 	if (persona == NULL){
-		puts("ERROR2");
+		salida_linea(sistema->salida, "ERROR2");
 		return true;
 	}
 	if(!participante_dono(persona)){
-		puts("ERROR3");
+		salida_linea(sistema->salida, "ERROR3");
 		return true;
 	}
-	char* n = strtok(nominados, " ");
+	char* n = nominados != NULL ? strtok(nominados, " ") : NULL;
 	while (n != NULL){
-		if (esta_en_sistema(n, sistema->lista) != NULL)
-			printf("ERROR4 %s\n",n);
+		if (esta_en_sistema(n, sistema) != NULL){
+			salida_cadena(sistema->salida, "ERROR4 ");
+			salida_linea(sistema->salida, n);
+		}
 		else{
-			printf("OK %s\n",n);
-			persona_t *persona = crear_persona(n);
+			salida_cadena(sistema->salida, "OK ");
+			salida_linea(sistema->salida, n);
+			persona_t *persona = crear_inscripto(n, sistema);
 			if (persona == NULL) return false;
 
-			inscripcion(persona, NULL, sistema);
+			if (!inscripcion(persona, 0, sistema)) return false;
 		}
 		n = strtok(NULL, " ");
 	}
@@ -134,64 +142,97 @@ bool nominar(char* nombre, char* nominados, sistema_t* sistema){
 
 void tirar_balde(char* nombre, char* eleccion, sistema_t* sistema){
 	if (cola_esta_vacia(sistema->cola) || strcmp(cola_ver_primero(sistema->cola), nombre) != 0){
-		puts("ERROR5");
+		salida_linea(sistema->salida, "ERROR5");
 		return;
 	}
-	persona_t* p = esta_en_sistema(nombre, sistema->lista);
-	if (p == NULL){
-		puts("ERROR6");
+	persona_t* p = esta_en_sistema(nombre, sistema);
+	if (p == NULL || eleccion == NULL){
+		salida_linea(sistema->salida, "ERROR6");
 		return;
 	}
 	if (!participante_dono(p) && (strcmp(eleccion, (char*) "no") == 0)){
-		puts("ERROR6");
+		salida_linea(sistema->salida, "ERROR6");
 		return;
 	}
 	if ((strcmp(cola_ver_primero(sistema->cola), nombre) == 0) && (strcmp(eleccion, (char*) "si") == 0)){
-		mostrar_donaciones(ver_donaciones(p));
+		mostrar_donaciones(p, sistema->salida);
 		cola_desencolar(sistema->cola);
 		return;
 	}
 	else if (strcmp(eleccion, (char*) "no") == 0){
 		cola_desencolar(sistema->cola);
-		puts("ERROR8");
+		salida_linea(sistema->salida, "ERROR8");
 	}
 }
 
 
+// Ejecuta un comando ya separado. Devuelve false si fallo la creacion de
+// alguna estructura.
+static bool ejecutar(comando_t* comando, sistema_t* sistema){
+	switch (comando->tipo){
+		case COMANDO_DONAR:
+			return donar(comando->nombre, comando->argumento, sistema);
+		case COMANDO_NOMINAR:
+			return nominar(comando->nombre, comando->argumento, sistema);
+		case COMANDO_TIRAR_BALDE:
+			tirar_balde(comando->nombre, comando->argumento, sistema);
+			return true;
+		default:
+			salida_linea(sistema->salida, "ERROR7");
+			return true;
+	}
+}
+
 void ingreso_al_sistema(){
-	sistema_t* sistema = crear_sistema();
+	sistema_t* sistema = crear_sistema(salida_crear(STDOUT_FILENO));
 	if (sistema == NULL) return;
+	lector_t* lector = lector_crear(STDIN_FILENO);
+	if (lector == NULL){
+		sistema_destruir(sistema);
+		return;
+	}
 
 	bool ok = true;
-	while (true){
-		char* usuario = leer_linea();
-		lista_insertar_ultimo(sistema->lista_usuario, usuario);
-		if(feof(stdin)) break;
-
-		char* nombre = strtok(usuario, " ");
-		char* comando = strtok(NULL, " "); 
-		if (strcmp(comando, (char*) DONAR) == 0){
-			char* monto = strtok(NULL, " ");
-			ok = donar(nombre, monto, sistema);
-		}
-		else if (strcmp(comando, (char*) NOMINAR) == 0){
-			char* nomindados = strtok(NULL, "\0");
-			ok = nominar(nombre, nomindados, sistema);
-		}
-		else if (strcmp(comando, (char*) TIRAR_BALDE) == 0){
-			char* eleccion = (strtok(NULL, " "));
-			tirar_balde(nombre, eleccion, sistema);
-		}
-		else
-			puts("ERROR7");
+	char* usuario;
+	comando_t comando;
+	// La linea solo vale hasta leer la siguiente: de ella se guardan los
+	// nombres (en el almacen del sistema) y las donaciones (como numeros).
+	while (ok && (usuario = lector_linea(lector, NULL)) != NULL){
+		comando_separar(usuario, &comando);
+		ok = ejecutar(&comando, sistema);
+	}
+
+	lector_destruir(lector);
+	sistema_destruir(sistema);
+}
 
-		if (!ok) break;
+bool procesar_lote(const char* ruta){
+	lote_t* lote = lote_abrir(ruta);
+	if (lote == NULL) return false;
+	comando_t* comandos = malloc(COMANDOS_POR_LOTE * sizeof(comando_t));
+	sistema_t* sistema = crear_sistema(salida_crear_con_tam(STDOUT_FILENO, TAM_SALIDA_LOTE));
+	if (comandos == NULL || sistema == NULL){
+		if (sistema != NULL) sistema_destruir(sistema);
+		free(comandos);
+		lote_destruir(lote);
+		return false;
 	}
 
+	bool ok = true;
+	size_t cantidad;
+	while (ok && (cantidad = lote_leer(lote, comandos, COMANDOS_POR_LOTE)) > 0)
+		for (size_t i = 0; ok && i < cantidad; i++)
+			ok = ejecutar(&comandos[i], sistema);
+
 	sistema_destruir(sistema);
+	free(comandos);
+	lote_destruir(lote);
+	return ok;
 }
 
-int main(){
+int main(int argc, char** argv){
+	if (argc > 1)
+		return procesar_lote(argv[1]) ? 0 : 1;
 	ingreso_al_sistema();
 	return 0;
-}
\ No newline at end of file
+}
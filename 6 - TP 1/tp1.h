@@ -6,7 +6,10 @@
 #include "cola.h"
 #include "pila.h"
 #include "lista.h"
+#include "hash.h"
+#include "cadenas.h"
 #include "participante.h"
+#include "salida.h"
 
 
 /*******************************************************************
@@ -18,29 +21,34 @@ typedef struct sistema sistema_t;
  /*******************************************************************
  *                           PRIMITIVAS                             *
  *******************************************************************/
-// Crea las estructuras necesarias para guardar la informacion. Si alguna falla
-// devuelve NULL.
-sistema_t* crear_sistema();
+// Crea las estructuras necesarias para guardar la informacion. Las
+// respuestas se escriben en salida, que pasa a ser del sistema. Si alguna
+// falla devuelve NULL.
+sistema_t* crear_sistema(salida_t* salida);
 // Cuando se falla en la creacion de alguna estructura o cuando el usuario
 // decide terminar la ejecucion del programa se destruye el sistema.
 void sistema_destruir(sistema_t* sistema);
 
 // Verifica si la persona se encuentra en el sistema. Devuele la persona 
 // si se encuentra, NULL si no.
-persona_t* esta_en_sistema(char* nombre, lista_t *lista);
+persona_t* esta_en_sistema(char* nombre, sistema_t* sistema);
 
-// Inscribe personas cuando son nominadas por alguien. Las agrega a la lista
-// y a la cola para tirarse el balde.
-void inscripcion(persona_t* persona, char* monto, sistema_t* sistema);
+// Inscribe personas cuando son nominadas por alguien (monto 0) o cuando
+// donan sin estar inscriptas. Las agrega a la lista, al hash de personas y
+// a la cola para tirarse el balde.
+// Devuelve false si no se pudo guardar a la persona (o su donacion). La
+// persona pasa a ser del sistema aunque falle.
+bool inscripcion(persona_t* persona, int monto, sistema_t* sistema);
 
 // Recibe un nombre, un monto, una cola y una lista. Si los datos son validos
 // lo ingresa al sistema, guarda su donacion y lo pone en el ultimo lugar en la cola.
-// Si es invalido, devuelve por pantalla ERROR1.
+// Si es invalido (o falta), devuelve por pantalla ERROR1.
 // Si falla la creacion de alguna estructura devuelve false. Si todo sale bien, true.
 bool donar(char *nombre, char* monto, sistema_t* sistema);
 
 // Recibe el nombre del nominador y los nominados. Verifica que
-// los nominados no esten en el sistema y los agrega. En caso contrario,
+// los nominados (que pueden ser NULL, si no hay) no esten en el sistema y
+// los agrega. En caso contrario,
 // avisa por pantalla cual de los nominados presenta un error.
 // Devuelve false si falla la crecion de alguna estructura. Si todo sale bien, true.
 bool nominar(char* nombre, char* nominados, sistema_t* sistema);
@@ -48,14 +56,20 @@ bool nominar(char* nombre, char* nominados, sistema_t* sistema);
 // Recibe el nombre de la persona, su decision, una lista y una cola.
 // Verifica si puede tirarse el balde o no. 
 // Devuelve diferentes errores dependiendo de la eleccion y la posicion de la
-// persona en la cola.
+// persona en la cola (si le toca pero falta la eleccion, ERROR6).
 void tirar_balde(char* nombre, char* eleccion, sistema_t* sistema);
 
-// El usuario ingresa una linea de texto. Si es EOF sale del ciclo y libera memoria
+// Lee las lineas de la entrada estandar. Al llegar a EOF sale del ciclo y libera memoria
 // Si no es EOF se separa la cadena en nombre, comando y una tercer variable que
 // depende del comando.
 void ingreso_al_sistema();
 
+// Modo por lotes: ejecuta los comandos del archivo ruta, separandolos de a
+// muchos por vez, y junta las respuestas en un buffer grande.
+// Devuelve false si no se pudo abrir el archivo o si fallo la creacion de
+// alguna estructura.
+bool procesar_lote(const char* ruta);
+
 
 
 
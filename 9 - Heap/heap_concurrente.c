@@ -0,0 +1,206 @@
+#define _POSIX_C_SOURCE 200809L
+#include "heap_concurrente.h"
+#include "heap.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#define HEAPS_POR_HILO 2
+#define TAM_LINEA_CACHE 64
+// Intentos sin bloquearse antes de esperar por los heaps. Con mas hilos que
+// procesadores, o casi sin elementos, seguir probando al azar solo gasta el
+// turno del hilo.
+#define MAX_INTENTOS 8
+
+/*******************************************************************
+ *                DEFINICION DE LOS TIPOS DE DATOS                 *
+ ******************************************************************/
+
+// Cada heap interno va en su propia linea de cache para que dos hilos
+// trabajando sobre heaps distintos no se molesten entre si.
+typedef struct heap_interno{
+	pthread_mutex_t mutex;
+	heap_t* heap;
+} __attribute__((aligned(TAM_LINEA_CACHE))) heap_interno_t;
+
+struct heap_concurrente{
+	heap_interno_t* heaps;
+	size_t cant_heaps;
+	size_t cant; // se accede solo con operaciones atomicas
+	cmp_func_t heap_cmp;
+};
+
+/*******************************************************************
+ *                        FUNCIONES AUXILIARES                     *
+ ******************************************************************/
+
+// Devuelve un numero pseudoaleatorio (xorshift). Cada hilo tiene su propia
+// semilla, asi que no hay contencion al elegir heaps.
+static size_t aleatorio(void){
+	static __thread uint64_t semilla = 0;
+	if (semilla == 0) semilla = (uint64_t)(uintptr_t)&semilla | 1;
+
+	semilla ^= semilla << 13;
+	semilla ^= semilla >> 7;
+	semilla ^= semilla << 17;
+	return (size_t)semilla;
+}
+
+// Intenta tomar dos heaps internos distintos elegidos al azar sin bloquearse.
+// Devuelve true si los dos quedaron tomados.
+static bool tomar_dos_heaps(heap_concurrente_t* heap, heap_interno_t** a, heap_interno_t** b){
+	size_t i = aleatorio() % heap->cant_heaps;
+	size_t j = aleatorio() % (heap->cant_heaps - 1);
+	if (j >= i) j++; // j != i
+
+	*a = &heap->heaps[i];
+	*b = &heap->heaps[j];
+	if (pthread_mutex_trylock(&(*a)->mutex) != 0) return false;
+	if (pthread_mutex_trylock(&(*b)->mutex) != 0){
+		pthread_mutex_unlock(&(*a)->mutex);
+		return false;
+	}
+	return true;
+}
+
+/*******************************************************************
+ *                        IMPLEMENTACION                           *
+ ******************************************************************/
+
+/* Crea un heap concurrente. Recibe la función de comparación (la misma que
+ * usaria heap_crear) y la cantidad de hilos que lo van a usar, con la que se
+ * dimensiona la cantidad de heaps internos. Devuelve NULL en caso de error.
+ * Pre: cant_hilos es mayor a 0.
+ */
+heap_concurrente_t *heap_concurrente_crear(cmp_func_t cmp, size_t cant_hilos){
+	heap_concurrente_t* heap = malloc(sizeof(heap_concurrente_t));
+	if (!heap) return NULL;
+
+	// Al menos dos heaps, para que desencolar siempre pueda elegir un par.
+	heap->cant_heaps = cant_hilos * HEAPS_POR_HILO;
+	if (heap->cant_heaps < 2) heap->cant_heaps = 2;
+
+	heap->heaps = NULL;
+	if (posix_memalign((void**)&heap->heaps, TAM_LINEA_CACHE,
+			heap->cant_heaps * sizeof(heap_interno_t)) != 0){
+		free(heap);
+		return NULL;
+	}
+
+	for (size_t i = 0; i < heap->cant_heaps; i++){
+		heap->heaps[i].heap = heap_crear(cmp);
+		if (!heap->heaps[i].heap){
+			while (i--){
+				heap_destruir(heap->heaps[i].heap, NULL);
+				pthread_mutex_destroy(&heap->heaps[i].mutex);
+			}
+			free(heap->heaps);
+			free(heap);
+			return NULL;
+		}
+		pthread_mutex_init(&heap->heaps[i].mutex, NULL);
+	}
+
+	heap->cant = 0;
+	heap->heap_cmp = cmp;
+	return heap;
+}
+
+/* Elimina el heap, llamando a la función dada para cada elemento del mismo.
+ * El puntero a la función puede ser NULL, en cuyo caso no se llamará.
+ * Pre: ningun otro hilo esta usando el heap.
+ * Post: el heap dejó de ser válido. */
+void heap_concurrente_destruir(heap_concurrente_t *heap, void destruir_elemento(void *e)){
+	for (size_t i = 0; i < heap->cant_heaps; i++){
+		heap_destruir(heap->heaps[i].heap, destruir_elemento);
+		pthread_mutex_destroy(&heap->heaps[i].mutex);
+	}
+	free(heap->heaps);
+	free(heap);
+}
+
+/* Devuelve la cantidad de elementos que hay en el heap. Con otros hilos
+ * operando en simultaneo el valor es solo una aproximacion. */
+size_t heap_concurrente_cantidad(const heap_concurrente_t *heap){
+	return __atomic_load_n(&heap->cant, __ATOMIC_RELAXED);
+}
+
+/* Devuelve true si el heap no tiene elementos. Misma salvedad que
+ * heap_concurrente_cantidad. */
+bool heap_concurrente_esta_vacio(const heap_concurrente_t *heap){
+	return heap_concurrente_cantidad(heap) == 0;
+}
+
+/* Agrega un elemento al heap. El elemento no puede ser NULL.
+ * Devuelve true si fue una operación exitosa, o false en caso de error.
+ * Puede llamarse desde varios hilos a la vez.
+ * Pre: el heap fue creado.
+ */
+bool heap_concurrente_encolar(heap_concurrente_t *heap, void *elem){
+	// Se prueba con algunos heaps libres, y si estan todos ocupados se
+	// espera por el ultimo.
+	heap_interno_t* interno = &heap->heaps[aleatorio() % heap->cant_heaps];
+	for (size_t intentos = 1; pthread_mutex_trylock(&interno->mutex) != 0; intentos++){
+		interno = &heap->heaps[aleatorio() % heap->cant_heaps];
+		if (intentos == MAX_INTENTOS){
+			pthread_mutex_lock(&interno->mutex);
+			break;
+		}
+	}
+
+	// La cuenta sube antes de soltar el heap: si no, un desencolar podria
+	// sacar el elemento y bajarla antes, y pasaria por debajo de 0.
+	bool ok = heap_encolar(interno->heap, elem);
+	if (ok) __atomic_add_fetch(&heap->cant, 1, __ATOMIC_RELEASE);
+	pthread_mutex_unlock(&interno->mutex);
+	return ok;
+}
+
+/* Elimina un elemento de alta prioridad (ver relajacion arriba) y lo
+ * devuelve. Si el heap esta vacío, devuelve NULL.
+ * Puede llamarse desde varios hilos a la vez.
+ * Pre: el heap fue creado.
+ */
+void *heap_concurrente_desencolar(heap_concurrente_t *heap){
+	for (size_t intentos = 0; intentos < MAX_INTENTOS && __atomic_load_n(&heap->cant, __ATOMIC_ACQUIRE) > 0; intentos++){
+		heap_interno_t *a, *b;
+		if (!tomar_dos_heaps(heap, &a, &b)) continue;
+
+		// Con los dos heaps tomados, sus topes no pueden cambiar.
+		void* max_a = heap_ver_max(a->heap);
+		void* max_b = heap_ver_max(b->heap);
+		heap_interno_t* elegido = a;
+		if (!max_a || (max_b && heap->heap_cmp(max_b, max_a) > 0))
+			elegido = b;
+
+		void* elem = heap_desencolar(elegido->heap);
+		pthread_mutex_unlock(&a->mutex);
+		pthread_mutex_unlock(&b->mutex);
+
+		if (elem){
+			__atomic_sub_fetch(&heap->cant, 1, __ATOMIC_RELEASE);
+			return elem;
+		}
+		// Los dos estaban vacios: los elementos estan en otros heaps.
+	}
+
+	// Si no alcanzo, se recorren todos desde uno al azar, esperando por
+	// cada uno (de a uno, asi no se traba con nadie), y sale el tope del
+	// primero que tenga algo.
+	while (__atomic_load_n(&heap->cant, __ATOMIC_ACQUIRE) > 0){
+		size_t inicio = aleatorio() % heap->cant_heaps;
+		for (size_t i = 0; i < heap->cant_heaps; i++){
+			heap_interno_t* interno = &heap->heaps[(inicio + i) % heap->cant_heaps];
+			pthread_mutex_lock(&interno->mutex);
+			void* elem = heap_desencolar(interno->heap);
+			pthread_mutex_unlock(&interno->mutex);
+			if (elem){
+				__atomic_sub_fetch(&heap->cant, 1, __ATOMIC_RELEASE);
+				return elem;
+			}
+		}
+	}
+	return NULL;
+}
@@ -0,0 +1,61 @@
+#ifndef _HEAP_CONCURRENTE_H
+#define _HEAP_CONCURRENTE_H
+
+#include <stdbool.h>  /* bool */
+#include <stddef.h>	  /* size_t */
+#include "heap.h"     /* cmp_func_t */
+
+/*
+ * Cola de prioridad concurrente ("MultiQueue") construida sobre heap_t.
+ *
+ * Internamente se usan varios heaps secuenciales, cada uno protegido por su
+ * propio mutex. Encolar guarda el elemento en un heap elegido al azar y
+ * desencolar toma dos heaps al azar y saca el maximo del que tenga el mejor
+ * tope. Si un heap esta ocupado se prueba con otro, y solo despues de
+ * algunos intentos fallidos se espera a que se libere.
+ *
+ * Relajacion: heap_concurrente_desencolar NO garantiza devolver el maximo
+ * global, sino un elemento "cercano" a el. En promedio, el elemento devuelto
+ * esta entre los primeros O(cantidad de heaps internos) elementos de la cola.
+ * Todo elemento encolado se desencola exactamente una vez.
+ */
+
+/* Tipo utilizado para el heap concurrente. */
+typedef struct heap_concurrente heap_concurrente_t;
+
+/* Crea un heap concurrente. Recibe la función de comparación (la misma que
+ * usaria heap_crear) y la cantidad de hilos que lo van a usar, con la que se
+ * dimensiona la cantidad de heaps internos. Devuelve NULL en caso de error.
+ * Pre: cant_hilos es mayor a 0.
+ */
+heap_concurrente_t *heap_concurrente_crear(cmp_func_t cmp, size_t cant_hilos);
+
+/* Elimina el heap, llamando a la función dada para cada elemento del mismo.
+ * El puntero a la función puede ser NULL, en cuyo caso no se llamará.
+ * Pre: ningun otro hilo esta usando el heap.
+ * Post: el heap dejó de ser válido. */
+void heap_concurrente_destruir(heap_concurrente_t *heap, void destruir_elemento(void *e));
+
+/* Devuelve la cantidad de elementos que hay en el heap. Con otros hilos
+ * operando en simultaneo el valor es solo una aproximacion. */
+size_t heap_concurrente_cantidad(const heap_concurrente_t *heap);
+
+/* Devuelve true si el heap no tiene elementos. Misma salvedad que
+ * heap_concurrente_cantidad. */
+bool heap_concurrente_esta_vacio(const heap_concurrente_t *heap);
+
+/* Agrega un elemento al heap. El elemento no puede ser NULL.
+ * Devuelve true si fue una operación exitosa, o false en caso de error.
+ * Puede llamarse desde varios hilos a la vez.
+ * Pre: el heap fue creado.
+ */
+bool heap_concurrente_encolar(heap_concurrente_t *heap, void *elem);
+
+/* Elimina un elemento de alta prioridad (ver relajacion arriba) y lo
+ * devuelve. Si el heap esta vacío, devuelve NULL.
+ * Puede llamarse desde varios hilos a la vez.
+ * Pre: el heap fue creado.
+ */
+void *heap_concurrente_desencolar(heap_concurrente_t *heap);
+
+#endif // _HEAP_CONCURRENTE_H
@@ -0,0 +1,239 @@
+#define _POSIX_C_SOURCE 200809L
+#include "heap.h"
+#include "heap_concurrente.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include <time.h>
+
+#define MAX_HILOS 16
+
+/* ******************************************************************
+ *                      FUNCIONES AUXILIARES
+ * *****************************************************************/
+
+/* Función auxiliar para imprimir si estuvo OK o no. */
+void print_test(char* name, bool result)
+{
+	printf("%s: %s\n", name, result? "OK" : "ERROR");
+}
+
+int intcmp(const void* int_1, const void* int_2)
+{
+	int a = *(int*)int_1, b = *(int*)int_2;
+	return (a > b) - (a < b);
+}
+
+double segundos_desde(struct timespec* inicio)
+{
+	struct timespec fin;
+	clock_gettime(CLOCK_MONOTONIC, &fin);
+	return (fin.tv_sec - inicio->tv_sec) + (fin.tv_nsec - inicio->tv_nsec) / 1e9;
+}
+
+/* ******************************************************************
+ *                        PRUEBAS UNITARIAS
+ * *****************************************************************/
+
+void prueba_heap_concurrente_vacio()
+{
+	heap_concurrente_t* heap = heap_concurrente_crear(intcmp, 4);
+
+	print_test("Prueba heap concurrente crear heap vacio", heap);
+	print_test("Prueba heap concurrente la cantidad de elementos es 0", heap_concurrente_cantidad(heap) == 0);
+	print_test("Prueba heap concurrente esta vacio", heap_concurrente_esta_vacio(heap));
+	print_test("Prueba heap concurrente desencolar es NULL", !heap_concurrente_desencolar(heap));
+
+	heap_concurrente_destruir(heap, NULL);
+}
+
+void prueba_heap_concurrente_un_hilo(size_t largo)
+{
+	heap_concurrente_t* heap = heap_concurrente_crear(intcmp, 1);
+	int* valores = malloc(largo * sizeof(int));
+	bool* vistos = calloc(largo, sizeof(bool));
+	if (!heap || !valores || !vistos) return;
+
+	bool ok = true;
+	for (size_t i = 0; i < largo; i++){
+		valores[i] = (int)i;
+		ok &= heap_concurrente_encolar(heap, &valores[i]);
+	}
+	print_test("Prueba heap concurrente encolar muchos elementos", ok);
+	print_test("Prueba heap concurrente la cantidad es correcta", heap_concurrente_cantidad(heap) == largo);
+
+	// Con un solo hilo hay dos heaps internos: el primero que sale tiene
+	// que ser alguno de los dos topes, es decir, uno de los mas grandes.
+	int* primero = heap_concurrente_desencolar(heap);
+	vistos[*primero] = true;
+	print_test("Prueba heap concurrente el primero es de los mas grandes", *primero >= (int)largo - 64);
+
+	for (size_t i = 1; i < largo; i++){
+		int* elem = heap_concurrente_desencolar(heap);
+		if (!elem || vistos[*elem]){
+			ok = false;
+			break;
+		}
+		vistos[*elem] = true;
+	}
+	print_test("Prueba heap concurrente cada elemento sale una vez", ok);
+	print_test("Prueba heap concurrente queda vacio", heap_concurrente_esta_vacio(heap));
+
+	heap_concurrente_destruir(heap, NULL);
+	free(valores);
+	free(vistos);
+}
+
+void prueba_heap_concurrente_destruir()
+{
+	heap_concurrente_t* heap = heap_concurrente_crear(intcmp, 2);
+	for (int i = 0; i < 100; i++){
+		int* valor = malloc(sizeof(int));
+		*valor = i;
+		heap_concurrente_encolar(heap, valor);
+	}
+	heap_concurrente_destruir(heap, free);
+	print_test("Prueba heap concurrente el destructor se ocupa de los elementos", true);
+}
+
+/* ******************************************************************
+ *                   PRUEBAS CON VARIOS HILOS
+ * *****************************************************************/
+
+// Cola de prioridad a medir: el heap concurrente o un heap_t comun
+// protegido por un unico mutex global.
+typedef struct cola_prioridad{
+	heap_concurrente_t* concurrente;
+	heap_t* heap;
+	pthread_mutex_t mutex;
+} cola_prioridad_t;
+
+typedef struct trabajo{
+	cola_prioridad_t* cola;
+	int* valores;       // lo que encola este hilo
+	size_t cant;        // cuanto encola este hilo
+	size_t* restantes;  // cuanto falta desencolar entre todos los hilos
+	long long suma;     // suma de lo que desencolo este hilo
+} trabajo_t;
+
+bool cola_encolar(cola_prioridad_t* cola, void* elem)
+{
+	if (cola->concurrente) return heap_concurrente_encolar(cola->concurrente, elem);
+
+	pthread_mutex_lock(&cola->mutex);
+	bool ok = heap_encolar(cola->heap, elem);
+	pthread_mutex_unlock(&cola->mutex);
+	return ok;
+}
+
+void* cola_desencolar(cola_prioridad_t* cola)
+{
+	if (cola->concurrente) return heap_concurrente_desencolar(cola->concurrente);
+
+	pthread_mutex_lock(&cola->mutex);
+	void* elem = heap_desencolar(cola->heap);
+	pthread_mutex_unlock(&cola->mutex);
+	return elem;
+}
+
+// Cada hilo alterna entre encolar lo suyo y desencolar lo que encuentre,
+// hasta que entre todos sacaron todo lo que se encolo.
+void* hilo_trabajador(void* extra)
+{
+	trabajo_t* trabajo = extra;
+	size_t encolados = 0;
+	trabajo->suma = 0;
+
+	while (__atomic_load_n(trabajo->restantes, __ATOMIC_RELAXED) > 0){
+		if (encolados < trabajo->cant)
+			cola_encolar(trabajo->cola, &trabajo->valores[encolados++]);
+
+		int* elem = cola_desencolar(trabajo->cola);
+		if (!elem) continue;
+		trabajo->suma += *elem;
+		__atomic_sub_fetch(trabajo->restantes, 1, __ATOMIC_RELAXED);
+	}
+	return NULL;
+}
+
+// Corre la prueba con cant_hilos hilos sobre la cola y devuelve las
+// operaciones (encolar + desencolar) por segundo. Verifica que cada
+// elemento haya salido exactamente una vez comparando las sumas.
+double medir(cola_prioridad_t* cola, size_t cant_hilos, size_t por_hilo, bool* ok)
+{
+	pthread_t hilos[MAX_HILOS];
+	trabajo_t trabajos[MAX_HILOS];
+	size_t restantes = cant_hilos * por_hilo;
+	int* valores = malloc(restantes * sizeof(int));
+	if (!valores){
+		*ok = false;
+		return 0;
+	}
+
+	long long esperado = 0;
+	for (size_t i = 0; i < restantes; i++){
+		valores[i] = rand();
+		esperado += valores[i];
+	}
+
+	struct timespec inicio;
+	clock_gettime(CLOCK_MONOTONIC, &inicio);
+	for (size_t i = 0; i < cant_hilos; i++){
+		trabajos[i].cola = cola;
+		trabajos[i].valores = valores + i * por_hilo;
+		trabajos[i].cant = por_hilo;
+		trabajos[i].restantes = &restantes;
+		pthread_create(&hilos[i], NULL, hilo_trabajador, &trabajos[i]);
+	}
+	long long suma = 0;
+	for (size_t i = 0; i < cant_hilos; i++){
+		pthread_join(hilos[i], NULL);
+		suma += trabajos[i].suma;
+	}
+	double segundos = segundos_desde(&inicio);
+
+	*ok &= (suma == esperado);
+	free(valores);
+	return 2.0 * cant_hilos * por_hilo / segundos;
+}
+
+void prueba_heap_concurrente_rendimiento(size_t por_hilo)
+{
+	printf("%8s %18s %18s\n", "hilos", "mutex global", "heap concurrente");
+
+	bool ok = true;
+	for (size_t cant_hilos = 1; cant_hilos <= MAX_HILOS; cant_hilos *= 2){
+		cola_prioridad_t global = { NULL, heap_crear(intcmp) };
+		pthread_mutex_init(&global.mutex, NULL);
+		cola_prioridad_t multi = { heap_concurrente_crear(intcmp, cant_hilos), NULL };
+
+		double ops_global = medir(&global, cant_hilos, por_hilo, &ok);
+		double ops_multi = medir(&multi, cant_hilos, por_hilo, &ok);
+		printf("%8zu %14.0f op/s %14.0f op/s\n", cant_hilos, ops_global, ops_multi);
+
+		heap_destruir(global.heap, NULL);
+		pthread_mutex_destroy(&global.mutex);
+		heap_concurrente_destruir(multi.concurrente, NULL);
+	}
+	print_test("Prueba heap concurrente con varios hilos no pierde ni repite elementos", ok);
+}
+
+/* ******************************************************************
+ *                        PROGRAMA PRINCIPAL
+ * *****************************************************************/
+
+int main(int argc, char** argv)
+{
+	if (argc < 2){
+		prueba_heap_concurrente_vacio();
+		prueba_heap_concurrente_un_hilo(5000);
+		prueba_heap_concurrente_destruir();
+		prueba_heap_concurrente_rendimiento(20000);
+	} else {
+		size_t por_hilo = atoi(argv[1]);
+		prueba_heap_concurrente_rendimiento(por_hilo);
+	}
+	return 0;
+}